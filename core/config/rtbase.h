@@ -422,7 +422,7 @@
 /*
  * Generic types
  * rt_32mMxN, rt_64mMxN and rt_matMxN, where M and N are integers {1, 2, 3, 4},
- * are reserved for rectangular matrices of rt_fp32, rt_fp64 and rt_real types.
+ * are reserved for rectangular matrices of rt_fp32, rt_fp64 and rt_geom types.
  * rt_fp16 and rt_f128 are reserved for half and quad precision floating point.
  * rt_s128 and rt_u128 are reserved for signed and unsigned 128b integer types.
  */
@@ -455,6 +455,29 @@ typedef rt_fp64             rt_64m4[4][4];
 
 typedef rt_fp32             rt_real;
 
+#elif RT_ELEMENT == 64
+
+typedef rt_fp64             rt_real;
+
+#else  /* RT_ELEMENT */
+
+#error "unsupported element size, check RT_ELEMENT in makefiles"
+
+#endif /* RT_ELEMENT */
+
+/*
+ * Geometry floating point types (engine-side positions and transforms)
+ * follow SIMD element size unless RT_GEOMETRY is given, RT_GEOMETRY=64
+ * with RT_ELEMENT=32 selects mixed-precision: fp64 engine, fp32 kernels.
+ */
+#ifndef RT_GEOMETRY
+#define RT_GEOMETRY RT_ELEMENT
+#endif /* RT_GEOMETRY: 32, 64; not below RT_ELEMENT */
+
+#if   RT_GEOMETRY == 32 && RT_ELEMENT == 32
+
+typedef rt_fp32             rt_geom;
+
 typedef rt_fp32             rt_vec2[2];
 typedef rt_fp32             rt_mat2[2][2];
 
@@ -464,9 +487,9 @@ typedef rt_fp32             rt_mat3[3][3];
 typedef rt_fp32             rt_vec4[4];
 typedef rt_fp32             rt_mat4[4][4];
 
-#elif RT_ELEMENT == 64
+#elif RT_GEOMETRY == 64
 
-typedef rt_fp64             rt_real;
+typedef rt_fp64             rt_geom;
 
 typedef rt_fp64             rt_vec2[2];
 typedef rt_fp64             rt_mat2[2][2];
@@ -477,11 +500,11 @@ typedef rt_fp64             rt_mat3[3][3];
 typedef rt_fp64             rt_vec4[4];
 typedef rt_fp64             rt_mat4[4][4];
 
-#else  /* RT_ELEMENT */
+#else  /* RT_GEOMETRY */
 
-#error "unsupported element size, check RT_ELEMENT in makefiles"
+#error "unsupported geometry size, check RT_GEOMETRY in makefiles"
 
-#endif /* RT_ELEMENT */
+#endif /* RT_GEOMETRY */
 
 /* fixed-size integer types */
 typedef char                rt_si08;
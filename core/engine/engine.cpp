@@ -420,38 +420,76 @@ rt_void print_lst(rt_pstr mgn, rt_ELEM *elm)
 /*****************************   MULTI-THREADING   ****************************/
 /******************************************************************************/
 
+/*
+ * Run task "cmd" for worker-thread with given "index" in system thread pool.
+ */
+static
+rt_void pool_task(rt_pntr data, rt_si32 index, rt_si32 cmd)
+{
+    rt_Scene *scn = ((rt_Platform *)data)->get_cur_scene();
+
+    switch (cmd & 0x3)
+    {
+        case 1:
+        scn->update_slice(index, (cmd >> 2) & 0xFF);
+        break;
+
+        case 2:
+        scn->render_slice(index, (cmd >> 2) & 0xFF);
+        break;
+
+        default:
+        break;
+    };
+}
+
 /*
  * Initialize platform-specific pool of "thnum" threads (< 0 - no feedback).
- * Local stub below is used when platform threading functions are not provided
- * or during state-logging.
+ * Local version below is used when platform threading functions are not
+ * provided, it creates system thread pool if more than one thread is needed.
  */
 static
 rt_void* init_threads(rt_si32 thnum, rt_Platform *pfm)
 {
     if (thnum > 0)
     {
-        pfm->set_thnum(thnum); /* dummy feedback, pass core-count in platform */
+        /* feedback limits the pool to available cores */
+        thnum = RT_MIN(thnum, rt_ThreadPool::get_cpus());
+        thnum = pfm->set_thnum(RT_MAX(thnum, 1));
+    }
+    else
+    {
+        thnum = -thnum;
     }
 
-    return pfm;
+    if (thnum == 1)
+    {
+        return pfm;
+    }
+
+    return new(pfm) rt_ThreadPool(pfm, thnum, pool_task, pfm);
 }
 
 /*
  * Terminate platform-specific pool of "thnum" threads.
- * Local stub below is used when platform threading functions are not provided
- * or during state-logging.
+ * Local version below is used when platform threading functions are not
+ * provided.
  */
 static
 rt_void term_threads(rt_void *tdata, rt_si32 thnum)
 {
-
+    if (thnum > 1)
+    {
+        delete (rt_ThreadPool *)tdata;
+    }
 }
 
 /*
  * Task platform-specific pool of "thnum" threads to update scene,
  * block until finished.
- * Local stub below is used when platform threading functions are not provided
- * or during state-logging. Simulate threading with sequential run.
+ * Local version below is used when platform threading functions are not
+ * provided or during state-logging, when it simulates threading with
+ * sequential run (thnum < 0).
  */
 static
 rt_void update_scene(rt_void *tdata, rt_si32 thnum, rt_si32 phase)
@@ -464,6 +502,12 @@ rt_void update_scene(rt_void *tdata, rt_si32 thnum, rt_si32 phase)
         thnum = -thnum;
     }
     else
+    if (thnum > 1)
+    {
+        ((rt_ThreadPool *)tdata)->run(1 | ((phase & 0xFF) << 2));
+        return;
+    }
+    else
     {
         scn = ((rt_Platform *)tdata)->get_cur_scene();
     }
@@ -479,8 +523,9 @@ rt_void update_scene(rt_void *tdata, rt_si32 thnum, rt_si32 phase)
 /*
  * Task platform-specific pool of "thnum" threads to render scene,
  * block until finished.
- * Local stub below is used when platform threading functions are not provided
- * or during state-logging. Simulate threading with sequential run.
+ * Local version below is used when platform threading functions are not
+ * provided or during state-logging, when it simulates threading with
+ * sequential run (thnum < 0).
  */
 static
 rt_void render_scene(rt_void *tdata, rt_si32 thnum, rt_si32 phase)
@@ -493,6 +538,12 @@ rt_void render_scene(rt_void *tdata, rt_si32 thnum, rt_si32 phase)
         thnum = -thnum;
     }
     else
+    if (thnum > 1)
+    {
+        ((rt_ThreadPool *)tdata)->run(2 | ((phase & 0xFF) << 2));
+        return;
+    }
+    else
     {
         scn = ((rt_Platform *)tdata)->get_cur_scene();
     }
@@ -564,6 +615,9 @@ rt_Platform::rt_Platform(rt_FUNC_ALLOC f_alloc, rt_FUNC_FREE f_free,
     thnum = this->thnum;
     this->thnum = thnum < 0 ? -thnum : thnum; /* always > 0 upon feedback */
 
+    /* init platform-specific timer */
+    f_timer = RT_NULL;
+
     /* init tile dimensions */
     tile_w = RT_MAX(RT_TILE_W, 1);
     tile_h = RT_MAX(RT_TILE_H, 1);
@@ -571,7 +625,11 @@ rt_Platform::rt_Platform(rt_FUNC_ALLOC f_alloc, rt_FUNC_FREE f_free,
 
     /* init rendering backend,
      * default SIMD runtime target will be chosen */
+    t_mask[0] = t_mask[1] = 0;
+    t_mode[0] = t_mode[1] = 0;
     fsaa = RT_FSAA_NO;
+    sched = RT_SCHED_TILES;
+    parts = RT_PARTS_CHUNKS;
     set_simd(0);
 }
 
@@ -596,6 +654,15 @@ rt_si32 rt_Platform::set_thnum(rt_si32 thnum)
     return this->thnum;
 }
 
+/*
+ * Set platform's high-resolution timer (in nanoseconds),
+ * required for recording render costs.
+ */
+rt_void rt_Platform::set_timer(rt_FUNC_TIMER f_timer)
+{
+    this->f_timer = f_timer;
+}
+
 /*
  * Initialize SIMD target-selection variable from parameters.
  */
@@ -656,6 +723,85 @@ rt_si32 rt_Platform::set_simd(rt_si32 simd)
     return simd;
 }
 
+/*
+ * Set the fastest of SIMD runtime targets allowed by "simd" (as in set_simd)
+ * by timing a few frames of scene "scn" at a given "time" with each of them,
+ * as the widest target isn't always the fastest (clock throttling, ports).
+ * The winner is cached per render domain (regular or path-tracer frames)
+ * until the set of allowed targets changes. Requires platform's timer.
+ */
+rt_si32 rt_Platform::tune_simd(rt_Scene *scn, rt_time time, rt_si32 simd)
+{
+    if (f_timer == RT_NULL || scn == RT_NULL)
+    {
+        return set_simd(simd);
+    }
+
+    rt_si32 pton = scn->get_pton();
+    rt_si32 i, j, d = pton != 0;
+    rt_si32 mask = mask_init(simd) & s_mask;
+    rt_time t, tm, best = 0;
+
+    if (t_mask[d] == mask && t_mode[d] != 0)
+    {
+        return set_simd(from_mask(t_mode[d]));
+    }
+
+    t_mask[d] = mask;
+    t_mode[d] = 0;
+
+    for (i = 0; i < 32; i++)
+    {
+        if ((mask & (1 << i)) == 0)
+        {
+            continue;
+        }
+
+        set_simd(from_mask(1 << i));
+
+        /* skip target if blocked by current AA mode */
+        if (s_mode != (1 << i))
+        {
+            continue;
+        }
+
+        /* 1st frame warms up caches (and pipeline) */
+        scn->render(time);
+
+        /* shortest frame is the least noisy */
+        for (j = 0, tm = 0; j < RT_TUNE_FRAMES; j++)
+        {
+            t = f_timer();
+            scn->render(time);
+            t = f_timer() - t;
+
+            tm = j == 0 || t < tm ? t : tm;
+        }
+
+        if (t_mode[d] == 0 || tm < best)
+        {
+            t_mode[d] = (1 << i);
+            best = tm;
+        }
+    }
+
+    /* drop samples and timings gathered while tuning */
+    if (pton != 0)
+    {
+        scn->set_pton(0);
+        scn->set_pton(pton);
+    }
+
+    scn->set_buff(scn->get_buff());
+
+    if (t_mode[d] == 0)
+    {
+        return set_simd(simd);
+    }
+
+    return set_simd(from_mask(t_mode[d]));
+}
+
 /*
  * Set current antialiasing mode.
  */
@@ -698,6 +844,52 @@ rt_si32 rt_Platform::get_fsaa_max()
     return RT_FSAA_NO;
 }
 
+/*
+ * Set current render scheduling mode.
+ */
+rt_si32 rt_Platform::set_sched(rt_si32 sched)
+{
+    if (sched != RT_SCHED_ROWS)
+    {
+        sched = RT_SCHED_TILES;
+    }
+
+    this->sched = sched;
+
+    return sched;
+}
+
+/*
+ * Get current render scheduling mode.
+ */
+rt_si32 rt_Platform::get_sched()
+{
+    return sched;
+}
+
+/*
+ * Set current update partitioning mode.
+ */
+rt_si32 rt_Platform::set_parts(rt_si32 parts)
+{
+    if (parts != RT_PARTS_MODULO && parts != RT_PARTS_COSTS)
+    {
+        parts = RT_PARTS_CHUNKS;
+    }
+
+    this->parts = parts;
+
+    return parts;
+}
+
+/*
+ * Get current update partitioning mode.
+ */
+rt_si32 rt_Platform::get_parts()
+{
+    return parts;
+}
+
 /*
  * Return tile width in pixels.
  */
@@ -917,6 +1109,12 @@ rt_SceneThread::rt_SceneThread(rt_Scene *scene, rt_si32 index) :
     RT_SIMD_SET(s_inf->cos_6, -0.0013888888888888888888888888888888888888888);
     RT_SIMD_SET(s_inf->cos_8, +0.0000248015873015873015873015873015873015873);
 
+    /* init fp16 color-planes conversion constants */
+    RT_SIMD_SET(s_inf->hlf_e, +1.9259299443872358530559779425849273e-34);
+    RT_SIMD_SET(s_inf->hlf_d, +5.1922968585348276285304963292200960e+33);
+    RT_SIMD_SET(s_inf->hlf_m, +65504.0);
+    RT_SIMD_SET(s_inf->hlf_r, (rt_uelm)0x1000);
+
 #if RT_DEBUG >= 1
 
     /* init polynomial constants for asin, acos */
@@ -947,12 +1145,21 @@ rt_SceneThread::rt_SceneThread(rt_Scene *scene, rt_si32 index) :
     mpool = RT_NULL;
     /* estimates are done in Scene once all counters have been initialized */
     msize = 0;
+    cpool = RT_NULL;
 
     /* allocate misc arrays for tiling */
     txmin = (rt_si32 *)alloc(sizeof(rt_si32) * scene->tiles_in_col, RT_ALIGN);
     txmax = (rt_si32 *)alloc(sizeof(rt_si32) * scene->tiles_in_col, RT_ALIGN);
     verts = (rt_VERT *)alloc(sizeof(rt_VERT) * 
                              (2 * RT_VERTS_LIMIT + RT_EDGES_LIMIT), RT_ALIGN);
+
+    /* allocate misc arrays for BVH */
+    bvh_e = (rt_ELEM **)alloc(sizeof(rt_ELEM *) * scene->srf_num, RT_ALIGN);
+    bvh_c = (rt_si32 *)alloc(sizeof(rt_si32) * (2 * scene->srf_num + 1),
+                                                                RT_ALIGN);
+
+    memset(bvh_e, 0, sizeof(rt_ELEM *) * scene->srf_num);
+    memset(bvh_c, 0, sizeof(rt_si32) * (2 * scene->srf_num + 1));
 }
 
 #define RT_UPDATE_TILES_BOUNDS(cy, x1, x2)                                  \
@@ -990,7 +1197,7 @@ while (0) /* "do {...} while (0)" to enforce semicolon ";" at the end */
  */
 rt_void rt_SceneThread::tiling(rt_vec2 p1, rt_vec2 p2)
 {
-    rt_real *pt, n1[3][2], n2[3][2];
+    rt_geom *pt, n1[3][2], n2[3][2];
     rt_real dx, dy, xx, yy, rt, px;
     rt_si32 x1, y1, x2, y2, i, n, t;
 
@@ -1763,6 +1970,244 @@ rt_ELEM* rt_SceneThread::filter(rt_Object *obj, rt_ELEM **ptr)
     return elm;
 }
 
+/*
+ * Chain surface elements picked from the list in "sbvh"
+ * for BVH node "n" after "tail" in BVH order and
+ * head them with a bvnode element if node's both children are present
+ * and there are more of them than fit in a leaf.
+ * Return last leaf element of the node's sub-list (recursive).
+ */
+rt_ELEM* rt_SceneThread::bvnode(rt_si32 n, rt_ELEM *tail)
+{
+    rt_BVHNODE *nd = &scene->bvh_arr[n];
+    rt_ELEM *elm, *prv = tail;
+    rt_si32 k, c = bvh_c[n];
+
+    bvh_c[n] = 0;
+
+    if (nd->num != 0)
+    {
+        for (k = nd->kid[0]; k < nd->kid[0] + nd->num; k++)
+        {
+            elm = bvh_e[k];
+            if (elm != RT_NULL)
+            {
+                bvh_e[k] = RT_NULL;
+                tail->next = elm;
+                tail = elm;
+            }
+        }
+
+        return tail;
+    }
+
+    rt_si32 c0 = bvh_c[nd->kid[0]];
+    rt_si32 c1 = bvh_c[nd->kid[1]];
+
+    if (c0 != 0)
+    {
+        tail = bvnode(nd->kid[0], tail);
+    }
+    if (c1 != 0)
+    {
+        tail = bvnode(nd->kid[1], tail);
+    }
+
+    if (c0 != 0 && c1 != 0 && c > RT_BVHSAH_LEAF)
+    {
+        /* alloc new bvnode element heading node's sub-list */
+        elm = (rt_ELEM *)alloc(sizeof(rt_ELEM), RT_QUAD_ALIGN);
+        elm->data = (rt_cell)tail | 1; /* node's type */
+        elm->simd = nd->s_bvh;
+        elm->temp = RT_NULL;
+        /* insert element after "prv" */
+        elm->next = prv->next;
+        prv->next = elm;
+    }
+
+    return tail;
+}
+
+/*
+ * Return index of element's surface in BVH order,
+ * -1 if element is not a surface or its surface is not in BVH's leaves,
+ * -2 if element is a node heading a sub-list.
+ */
+static
+rt_si32 bvh_index(rt_ELEM *elm)
+{
+    rt_Object *obj = elm->temp == RT_NULL ? RT_NULL :
+                     (rt_Object *)((rt_BOUND *)elm->temp)->obj;
+
+    if (obj == RT_NULL || RT_IS_ARRAY(obj))
+    {
+        return RT_GET_PTR(elm->data) != RT_NULL ? -2 : -1;
+    }
+
+    return RT_IS_SURFACE(obj) ? ((rt_Surface *)obj)->bvh_i : -1;
+}
+
+/*
+ * Reorder flat list "ptr" suitable for rendering backend
+ * along the scene's SAH-built BVH by picking its surfaces found in
+ * BVH's leaves and rechaining them under bvnode elements of inner nodes,
+ * the rest of the list (trnode sub-lists included) follows intact.
+ */
+rt_void rt_SceneThread::sbvh(rt_ELEM **ptr)
+{
+    if (scene->bvh_top < 0 || ptr == RT_NULL)
+    {
+        return;
+    }
+
+    rt_ELEM *elm, *nxt, *end, *rst = RT_NULL, **prs = &rst;
+    rt_si32 k, n;
+
+    for (elm = *ptr; elm != RT_NULL; elm = nxt)
+    {
+        k = bvh_index(elm);
+
+        nxt = elm->next;
+
+        /* pick surface if found in BVH's leaves */
+        if (k >= 0 && bvh_e[k] == RT_NULL)
+        {
+            bvh_e[k] = elm;
+
+            for (n = scene->bvh_lnd[k]; n >= 0; n = scene->bvh_arr[n].up)
+            {
+                bvh_c[n]++;
+            }
+
+            continue;
+        }
+
+        end = k == -2 ? RT_GET_PTR(elm->data) : elm;
+
+        /* drop bvnode element if its whole sub-list
+         * can be picked, as BVH takes over its role */
+        if (k == -2 && RT_GET_FLG(elm->data) == 1)
+        {
+            for (n = 1; n != 0; nxt = nxt->next)
+            {
+                k = bvh_index(nxt);
+
+                n = (k >= 0 && bvh_e[k] == RT_NULL)
+                 || (k == -2 && RT_GET_FLG(nxt->data) == 1);
+
+                if (nxt == end)
+                {
+                    break;
+                }
+            }
+
+            nxt = elm->next;
+
+            if (n != 0)
+            {
+                continue;
+            }
+        }
+
+        /* keep node's sub-list in one piece */
+        nxt = end->next;
+
+       *prs = elm;
+        prs = &end->next;
+    }
+
+   *prs = RT_NULL;
+
+    rt_ELEM top;
+
+    top.next = RT_NULL;
+    elm = &top;
+
+    if (bvh_c[scene->bvh_top] != 0)
+    {
+        elm = bvnode(scene->bvh_top, elm);
+    }
+
+    elm->next = rst;
+   *ptr = top.next;
+}
+
+/*
+ * Return sub-list's last element if "elm" is a node (trnode/bvnode)
+ * heading a sub-list within the same list, NULL otherwise.
+ */
+static
+rt_ELEM* flat_last(rt_ELEM *elm)
+{
+    /* BVH's bvnode elements don't have an object */
+    if (elm->temp == RT_NULL)
+    {
+        return elm->simd == RT_NULL ? RT_NULL : RT_GET_PTR(elm->data);
+    }
+
+    rt_Object *obj = (rt_Object *)((rt_BOUND *)elm->temp)->obj;
+
+    return RT_IS_ARRAY(obj) ? RT_GET_PTR(elm->data) : RT_NULL;
+}
+
+/*
+ * Copy list "ptr" suitable for rendering backend into a contiguous array
+ * allocated in one piece from the temporary memory pool, where each
+ * element's "next" is the adjacent one, and retarget nodes' last elements,
+ * so that the backend walks the list with sequential loads.
+ * The list is left as is if nodes' sub-lists can't be matched.
+ */
+rt_void rt_SceneThread::sflat(rt_ELEM **ptr)
+{
+    rt_ELEM *elm, *arr, *lst[RT_FLATTEN_DEPTH];
+    rt_si32 i, n, k = 0, idx[RT_FLATTEN_DEPTH];
+
+    if (ptr == RT_NULL || *ptr == RT_NULL || (*ptr)->next == RT_NULL)
+    {
+        return;
+    }
+
+    for (n = 0, elm = *ptr; elm != RT_NULL; elm = elm->next)
+    {
+        n++;
+    }
+
+    arr = (rt_ELEM *)alloc(sizeof(rt_ELEM) * n, RT_QUAD_ALIGN);
+
+    for (i = 0, elm = *ptr; elm != RT_NULL; elm = elm->next, i++)
+    {
+        arr[i].data = elm->data;
+        arr[i].simd = elm->simd;
+        arr[i].temp = elm->temp;
+        arr[i].next = i + 1 < n ? &arr[i + 1] : RT_NULL;
+
+        /* remember node until its last element is copied,
+         * nested sub-lists end before (or with) outer ones */
+        lst[k] = flat_last(elm);
+
+        if (lst[k] != RT_NULL)
+        {
+            if (k == RT_FLATTEN_DEPTH - 1)
+            {
+                return;
+            }
+
+            idx[k++] = i;
+        }
+
+        while (k > 0 && lst[k - 1] == elm)
+        {
+            k--;
+            RT_SET_PTR(arr[idx[k]].data, rt_cell, &arr[i]);
+        }
+    }
+
+    if (k == 0)
+    {
+       *ptr = arr;
+    }
+}
+
 /*
  * Build trnode/bvnode list for a given surface "srf"
  * after all transform flags have been set in "update_fields",
@@ -1976,6 +2421,13 @@ rt_void rt_SceneThread::sclip(rt_Surface *srf)
             }
         }
     }
+
+#if RT_OPTS_FLATTEN != 0
+    if ((scene->opts & RT_OPTS_FLATTEN) != 0)
+    {
+        sflat(ptr);
+    }
+#endif /* RT_OPTS_FLATTEN */
 }
 
 /*
@@ -2446,6 +2898,46 @@ rt_ELEM* rt_SceneThread::ssort(rt_Object *obj)
     }
 #endif /* RT_OPTS_INSERT, RT_OPTS_TARRAY, RT_OPTS_VARRAY */
 
+#if RT_OPTS_BVHSAH != 0
+    if ((scene->opts & RT_OPTS_BVHSAH) != 0)
+    {
+        if (pto != RT_NULL && *pto != RT_NULL)
+        {
+            sbvh(pto);
+        }
+        if (pti != RT_NULL && *pti != RT_NULL)
+        {
+            sbvh(pti);
+        }
+        /* camera's list is handled per tile if tiling is enabled */
+        if (*ptr != RT_NULL && obj != RT_NULL /* don't touch "hlist/slist" */
+        && ((scene->opts & RT_OPTS_TILING) == 0 || !RT_IS_CAMERA(obj)))
+        {
+            sbvh(ptr);
+        }
+    }
+#endif /* RT_OPTS_BVHSAH */
+
+#if RT_OPTS_FLATTEN != 0
+    if ((scene->opts & RT_OPTS_FLATTEN) != 0)
+    {
+        if (pto != RT_NULL)
+        {
+            sflat(pto);
+        }
+        if (pti != RT_NULL)
+        {
+            sflat(pti);
+        }
+        /* camera's list is handled per tile if tiling is enabled */
+        if (obj != RT_NULL /* don't touch "hlist/slist" */
+        && ((scene->opts & RT_OPTS_TILING) == 0 || !RT_IS_CAMERA(obj)))
+        {
+            sflat(ptr);
+        }
+    }
+#endif /* RT_OPTS_FLATTEN */
+
     if (srf == RT_NULL)
     {
         return lst;
@@ -2747,25 +3239,63 @@ rt_ELEM* rt_SceneThread::lsort(rt_Object *obj)
         }
 #endif /* RT_OPTS_INSERT, RT_OPTS_TARRAY, RT_OPTS_VARRAY */
 
-        if (g_print)
+#if RT_OPTS_BVHSAH != 0
+        if ((scene->opts & RT_OPTS_BVHSAH) != 0)
         {
             if (pso != RT_NULL && *pso != RT_NULL)
             {
-                RT_PRINT_SHW_OUTER(*pso);
+                sbvh(pso);
             }
             if (psi != RT_NULL && *psi != RT_NULL)
             {
-                RT_PRINT_SHW_INNER(*psi);
+                sbvh(psi);
             }
             if (psr != RT_NULL && *psr != RT_NULL)
             {
-                RT_PRINT_SHW(*psr);
+                sbvh(psr);
             }
         }
-#endif /* RT_OPTS_SHADOW */
-    }
+#endif /* RT_OPTS_BVHSAH */
 
-    if (srf == RT_NULL)
+#if RT_OPTS_FLATTEN != 0
+        if ((scene->opts & RT_OPTS_FLATTEN) != 0)
+        {
+            sflat(pso);
+            sflat(psi);
+            sflat(psr);
+        }
+#endif /* RT_OPTS_FLATTEN */
+
+        if (g_print)
+        {
+            if (pso != RT_NULL && *pso != RT_NULL)
+            {
+                RT_PRINT_SHW_OUTER(*pso);
+            }
+            if (psi != RT_NULL && *psi != RT_NULL)
+            {
+                RT_PRINT_SHW_INNER(*psi);
+            }
+            if (psr != RT_NULL && *psr != RT_NULL)
+            {
+                RT_PRINT_SHW(*psr);
+            }
+        }
+#endif /* RT_OPTS_SHADOW */
+    }
+
+#if RT_OPTS_FLATTEN != 0
+    /* light elements refer to
+     * shadow lists flattened above */
+    if ((scene->opts & RT_OPTS_FLATTEN) != 0)
+    {
+        sflat(pto);
+        sflat(pti);
+        sflat(ptr);
+    }
+#endif /* RT_OPTS_FLATTEN */
+
+    if (srf == RT_NULL)
     {
         return lst;
     }
@@ -2810,6 +3340,35 @@ rt_void rt_Scene::operator delete(rt_pntr ptr)
     ((rt_Scene *)ptr)->pfm->obj_free(ptr);
 }
 
+/*
+ * Check if framebuffer can be used by the backend directly:
+ * SIMD-aligned, whole number of SIMD widths in stride,
+ * within 32-bit address range if enabled in makefiles.
+ */
+static
+rt_si32 frame_check(rt_ui32 *frame, rt_si32 x_row, rt_si32 y_res)
+{
+    if (((rt_word)frame & (RT_SIMD_ALIGN - 1)) != 0 || frame == RT_NULL
+    || (RT_ABS32(x_row) & (RT_SIMD_WIDTH - 1)) != 0)
+    {
+        return 0;
+    }
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    /* frame's end (for either sign of the stride)
+     * must stay clear of the sign bit in 32-bit addresses */
+    if ((rt_full)(frame + (x_row > 0 ? x_row * y_res : -x_row))
+                                               > (rt_full)0x80000000)
+    {
+        return 0;
+    }
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+    return 1;
+}
+
 /*
  * Instantiate scene.
  * Can only be called from single (main) thread.
@@ -2828,6 +3387,33 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
 
     thnum = pfm->thnum;
     tdata = pfm->tdata;
+    tline = 0;
+    oline = 0;
+
+    cost_on = RT_FALSE;
+    cost_t = RT_NULL;
+    cost_r = RT_NULL;
+    cost_l = RT_NULL;
+    cost_h = RT_NULL;
+    cost_w = RT_NULL;
+    cost_b = RT_NULL;
+    cost_m = RT_NULL;
+
+    memset(phase_t, 0, sizeof(phase_t));
+    phase_s = 0;
+
+    prof_n = 0;
+    prof_m = 0;
+    prof_i = 0;
+    prof_t = RT_NULL;
+    prof_h = RT_NULL;
+
+    pipe_on = 0;
+    pipe = RT_NULL;
+    pipe_f = RT_NULL;
+    pipe_r = RT_NULL;
+    pipe_u = RT_NULL;
+    pipe_t = 0;
 
     thr_num = thnum; /* for registry of object hierarchy */
 
@@ -2853,16 +3439,9 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
         throw rt_Exception("frambuffer's dimensions are not valid");
     }
 
-#if (RT_POINTER - RT_ADDRESS) != 0
-
-    /* always reallocate frame in custom heap for 64-bit
-     * if 32-bit address range is enabled in makefiles */
-    frame = RT_NULL;
-
-#endif /* (RT_POINTER - RT_ADDRESS) */
-
-    if (((rt_word)frame & (RT_SIMD_ALIGN - 1)) != 0 || frame == RT_NULL
-    || (RT_ABS32(x_row) & (RT_SIMD_WIDTH - 1)) != 0)
+    /* reallocate frame in custom heap if not usable directly,
+     * 64-bit with 32-bit address range keeps frames within it */
+    if (frame_check(frame, x_row, y_res) == 0)
     {
         rt_si32 y_sgn = RT_SIGN(x_row);
 
@@ -2911,12 +3490,12 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
     if ((opts & RT_OPTS_PT) == 0 || (opts & RT_OPTS_BUFFERS) == 0)
     {
         /* alloc framebuffer's color-planes for path-tracer */
-        ptr_r = (rt_real *)
-                alloc(4 * x_row * y_res * sizeof(rt_real), RT_SIMD_ALIGN);
-        ptr_g = (rt_real *)
-                alloc(4 * x_row * y_res * sizeof(rt_real), RT_SIMD_ALIGN);
-        ptr_b = (rt_real *)
-                alloc(4 * x_row * y_res * sizeof(rt_real), RT_SIMD_ALIGN);
+        ptr_r = (rt_pelm *)
+                alloc(4 * x_row * y_res * sizeof(rt_pelm), RT_SIMD_ALIGN);
+        ptr_g = (rt_pelm *)
+                alloc(4 * x_row * y_res * sizeof(rt_pelm), RT_SIMD_ALIGN);
+        ptr_b = (rt_pelm *)
+                alloc(4 * x_row * y_res * sizeof(rt_pelm), RT_SIMD_ALIGN);
 
                 /* ptr_* is initialized in reset_color() */
     }
@@ -2933,9 +3512,28 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
                 /* pseed is initialized in reset_pseed() */
     }
 
+    pt_sd = 1;
     pts_c = 0.0f;
+    pt_ld = 0;
     pt_on = RT_FALSE;
 
+    cv_thr = 0.0f;
+    cv_cnt = RT_NULL;
+    cv_err = RT_NULL;
+    cv_num = 0;
+    cv_spt = 0;
+    cv_tmp = RT_NULL;
+
+    tn_on = RT_TONE_NONE;
+    tn_exp = 1.0f;
+    tn_all = 0;
+
+    bf_md = RT_BUFF_AUTO;
+    bf_on = 0;
+    bf_fr = 0;
+    bf_tm[0] = 0;
+    bf_tm[1] = 0;
+
     fsaa = pfm->fsaa;
 
     /* instantiate object hierarchy */
@@ -2958,9 +3556,83 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
         throw rt_Exception("scene doesn't contain camera");
     }
 
+    /* flatten object lists for update partitioning,
+     * surfaces go last to be shared by phases 2 and 3 */
+    obj_num = arr_num + cam_num + lgt_num + srf_num;
+    oarr = (rt_Object **)alloc(sizeof(rt_Object *) * obj_num, RT_ALIGN);
+
+    rt_si32 i = 0;
+
+    rt_Array   *arr;
+    rt_Light   *lgt;
+    rt_Surface *srf;
+
+    for (arr = arr_head; arr != RT_NULL; arr = arr->next)
+    {
+        oarr[i++] = arr;
+    }
+    for (cam = cam_head; cam != RT_NULL; cam = cam->next)
+    {
+        oarr[i++] = cam;
+    }
+    for (lgt = lgt_head; lgt != RT_NULL; lgt = lgt->next)
+    {
+        oarr[i++] = lgt;
+    }
+    for (srf = srf_head; srf != RT_NULL; srf = srf->next)
+    {
+        oarr[i++] = srf;
+        srf->bvh_i = -1;
+    }
+
     cam = cam_head;
     cam_idx = 0;
 
+    /* init per-surface costs and even per-thread ranges */
+    srf_c = (rt_si32 *)alloc(sizeof(rt_si32) * srf_num, RT_ALIGN);
+    srf_p = (rt_si32 *)alloc(sizeof(rt_si32) * (thnum + 1), RT_ALIGN);
+
+    for (i = 0; i < srf_num; i++)
+    {
+        srf_c[i] = 1;
+    }
+    for (i = 0; i <= thnum; i++)
+    {
+        srf_p[i] = srf_num * i / thnum;
+    }
+
+    /* init SAH-built BVH over surfaces,
+     * inner nodes never outnumber surfaces */
+    bvh_num = 0;
+    bvh_arr = (rt_BVHNODE *)
+              alloc(sizeof(rt_BVHNODE) * (2 * srf_num + 1), RT_ALIGN);
+    bvh_top = -1;
+    bvh_srf = (rt_Surface **)alloc(sizeof(rt_Surface *) * srf_num, RT_ALIGN);
+    bvh_lnd = (rt_si32 *)alloc(sizeof(rt_si32) * srf_num, RT_ALIGN);
+    bvh_nin = 0;
+    bvh_smd = (rt_SIMD_SURFACE **)
+              alloc(sizeof(rt_SIMD_SURFACE *) * srf_num, RT_ALIGN);
+
+    for (i = 0; i < srf_num; i++)
+    {
+        /* inner nodes use root's bvnode materials */
+        rt_SIMD_SURFACE *s_bvh = (rt_SIMD_SURFACE *)
+                alloc(sizeof(rt_SIMD_SURFACE), RT_SIMD_ALIGN);
+
+        memset(s_bvh, 0, sizeof(rt_SIMD_SURFACE));
+        s_bvh->srf_t[3] = RT_TAG_SURFACE_MAX;
+
+        s_bvh->mat_p[0] = root->s_bvb->mat_p[0];
+        s_bvh->mat_p[1] = root->s_bvb->mat_p[1];
+        s_bvh->mat_p[2] = root->s_bvb->mat_p[2];
+        s_bvh->mat_p[3] = root->s_bvb->mat_p[3];
+
+        RT_SIMD_SET(s_bvh->d_eps, RT_DEPS_THRESHOLD);
+        RT_SIMD_SET(s_bvh->t_eps, RT_TEPS_THRESHOLD);
+
+        bvh_smd[i] = s_bvh;
+    }
+
     /* lock scene data, when scene's constructor can no longer fail */
     scn->lock = this;
 
@@ -2968,8 +3640,6 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
     tharr = (rt_SceneThread **)
             alloc(sizeof(rt_SceneThread *) * thnum, RT_ALIGN);
 
-    rt_si32 i;
-
     for (i = 0; i < thnum; i++)
     {
         tharr[i] = new(this) rt_SceneThread(this, i);
@@ -2981,9 +3651,22 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
              (srf_num + arr_num * 2 + /* plus lights and shadows */
              (srf_num + arr_num * 2 + 1) * lgt_num) * 2) * /* for both sides */
             sizeof(rt_ELEM) * (srf_num + thnum - 1) / thnum; /* per thread */
+
+        /* retain released chunks to reuse them in the next frame */
+        tharr[i]->set_hwm(RT_TRUE);
     }
 
+    set_hwm(RT_TRUE);
+
     pending = 0;
+    cpool = RT_NULL;
+    uplvl = RT_UPDATE_FULL;
+    cam_upd = RT_NULL;
+
+    /* hierarchy starts at world's origin */
+    RT_VEC3_SET_VAL1(rbase, 0.0f);
+    rbase[RT_W] = 0.0f;
+    memcpy(rbmtx, iden4, sizeof(rt_mat4));
 
     /* init memory pool in the heap for temporary per-frame allocs */
     mpool = RT_NULL; /* rough estimate for surface relations/templates */
@@ -3006,21 +3689,167 @@ rt_Scene::rt_Scene(rt_SCENE *scn, /* "frame" must be SIMD-aligned or NULL */
 rt_void rt_Scene::update(rt_time time, rt_si32 action)
 {
     cam->update_action(time, action);
+
+    /* twin's camera shares transform in scene data,
+     * unknown action only marks it as changed */
+    if (pipe != RT_NULL)
+    {
+        pipe->cam->update_action(time, -1);
+    }
 }
 
 /*
  * Update backend data structures and render frame for a given "time".
+ * In pipelined mode the frame is rendered within the next call.
  */
 rt_void rt_Scene::render(rt_time time)
+{
+    if (pipe_on && !pt_on && !g_print)
+    {
+        render_pipe(pipe_f == this ? pipe : this, time);
+        return;
+    }
+
+    /* drop frame pending render in pipelined mode,
+     * its allocs are released by the next update */
+    if (pipe_f != RT_NULL)
+    {
+        pipe_f->pending = 1;
+        pipe_f = RT_NULL;
+    }
+
+    update_frame(time);
+    render_frame();
+    finish_frame();
+}
+
+/*
+ * Render frame pending in pipelined mode (if any), while the 1st render
+ * thread updates instance "upd" (if not NULL) for a given "time",
+ * which then becomes pending.
+ */
+rt_void rt_Scene::render_pipe(rt_Scene *upd, rt_time time)
+{
+    rt_Scene *fnt = pipe_f;
+
+    pipe_f = upd;
+
+    /* pipeline is empty, only update the frame */
+    if (fnt == RT_NULL)
+    {
+        if (upd != RT_NULL)
+        {
+            upd->update_frame(time);
+        }
+
+        return;
+    }
+
+    /* render threads are tasked with current scene,
+     * "upd" is not current and is updated sequentially */
+    if (pfm->cur == this)
+    {
+        pfm->cur = fnt;
+    }
+
+    fnt->pipe_u = upd;
+    fnt->pipe_t = time;
+
+    fnt->mark_phase(-1);
+    fnt->render_frame();
+    fnt->finish_frame();
+
+    fnt->pipe_u = RT_NULL;
+
+    if (pfm->cur == fnt)
+    {
+        pfm->cur = this;
+    }
+
+    pipe_r = fnt;
+}
+
+/*
+ * Update backend data structures for a given "time".
+ */
+rt_void rt_Scene::update_frame(rt_time time)
 {
     rt_si32 i;
 
+    /* start timing frame's phases,
+     * skipped ones are left at zero */
+    memset(phase_t, 0, sizeof(phase_t));
+    mark_phase(-1);
+
+    /* pick profiler's slot for current frame,
+     * per-thread times are written by threads */
+    if (prof_n != 0)
+    {
+        prof_h = prof_t + (prof_i % prof_n) * (RT_PHASE_NUM
+                                            +  RT_PHASE_THR * thnum);
+
+        memset(prof_h, 0, (RT_PHASE_NUM + RT_PHASE_THR * thnum)
+                                                     * sizeof(rt_time));
+        prof_h += RT_PHASE_NUM;
+    }
+
 #if RT_OPTS_UPDATE_EXT0 != 0
     if ((opts & RT_OPTS_UPDATE_EXT0) == 0 || rootobj.time == -1)
     { /* -->---->-- skip update1 -->---->-- */
 #endif /* RT_OPTS_UPDATE_EXT0 */
 
-    if (pending)
+    rt_si32 flags = 0;
+
+#if RT_REBASE_CELL != 0
+    /* rebase hierarchy to camera's position (from the last update)
+     * snapped to a grid, moving the origin updates the whole hierarchy */
+    for (i = 0; i < 3 && cam_upd != RT_NULL; i++)
+    {
+        rt_geom c = (rt_geom)RT_REBASE_CELL;
+        rt_geom p = (rt_geom)RT_FLOOR64((cam->pos[i] + rbase[i]) / c + 0.5);
+
+        if (rbase[i] != p * c)
+        {
+            rbase[i] = p * c;
+            rbmtx[3][i] = -p * c;
+            flags = RT_UPDATE_FLAG_OBJ;
+        }
+    }
+#endif /* RT_REBASE_CELL */
+
+    /* phase 0.5, hierarchical update of arrays' transform matrices */
+    root->update_object(time, flags, RT_NULL, rbmtx);
+
+    /* determine incremental update level,
+     * lists from the last frame can be reused if they are still
+     * in memory and nothing has changed apart from the cameras */
+    uplvl = RT_UPDATE_FULL;
+
+#if RT_OPTS_REUSE != 0
+    if ((opts & RT_OPTS_REUSE) != 0 && pending && !g_print)
+    {
+        uplvl = root->scn_changed || cam != cam_upd ?
+                RT_UPDATE_CAMERA : RT_UPDATE_NONE;
+
+        /* cameras are placed after arrays in the flattened array */
+        for (i = 0; i < obj_num && root->scn_changed; i++)
+        {
+            if (i == arr_num)
+            {
+                i += cam_num - 1;
+                continue;
+            }
+
+            if (oarr[i]->obj_changed)
+            {
+                uplvl = RT_UPDATE_FULL;
+                break;
+            }
+        }
+    }
+#endif /* RT_OPTS_REUSE */
+
+    if (pending && uplvl == RT_UPDATE_FULL)
     {
         pending = 0;
 
@@ -3032,15 +3861,35 @@ rt_void rt_Scene::render(rt_time time)
 
         release(mpool);
     }
+    else
+    if (pending && uplvl == RT_UPDATE_CAMERA)
+    {
+        pending = 0;
+
+        /* release memory for camera-dependent allocs only */
+        for (i = 0; i < thnum; i++)
+        {
+            tharr[i]->release(tharr[i]->cpool);
+        }
 
-    /* reserve memory for temporary per-frame allocs */
-    mpool = reserve(msize, RT_QUAD_ALIGN);
+        release(cpool);
+    }
 
-    for (i = 0; i < thnum; i++)
+    if (uplvl == RT_UPDATE_FULL)
     {
-        tharr[i]->mpool = tharr[i]->reserve(tharr[i]->msize, RT_QUAD_ALIGN);
+        /* reserve memory for temporary per-frame allocs,
+         * pre-size pools from the last frame's usage */
+        mpool = reserve(RT_MAX(msize, get_peak()), RT_QUAD_ALIGN);
+
+        for (i = 0; i < thnum; i++)
+        {
+            tharr[i]->mpool = tharr[i]->reserve(RT_MAX(tharr[i]->msize,
+                                 tharr[i]->get_peak()), RT_QUAD_ALIGN);
+        }
     }
 
+    mark_phase(RT_PHASE_UPDATE0);
+
     /* print state init */
     if (g_print)
     {
@@ -3048,33 +3897,42 @@ rt_void rt_Scene::render(rt_time time)
         RT_PRINT_TIME(time);
     }
 
-    /* phase 0.5, hierarchical update of arrays' transform matrices */
-    root->update_object(time, 0, RT_NULL, iden4);
-
-    if (pt_on && (root->scn_changed || pfm->fsaa != fsaa))
+    if (pt_on && (root->scn_changed || pfm->fsaa != fsaa) && !pt_ld)
     {
         reset_color();
     }
 
+    /* samples loaded with load_accum() are kept only once */
+    pt_ld = 0;
+
     /* update current antialiasing mode per scene */
     fsaa = pfm->fsaa;
 
+    /* reset object-chunk counter */
+    oline = 0;
+
     /* 1st phase of multi-threaded update */
+    if (uplvl != RT_UPDATE_NONE)
+    {
 #if RT_OPTS_THREAD != 0
-    if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene() && !g_print
+        if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene()
+        &&  !g_print
 #if RT_OPTS_UPDATE_EXT1 != 0
-    &&  (opts & RT_OPTS_UPDATE_EXT1) == 0
+        &&  (opts & RT_OPTS_UPDATE_EXT1) == 0
 #endif /* RT_OPTS_UPDATE_EXT1 */
-       )
-    {
-        this->f_update(tdata, thnum, 1);
-    }
-    else
+           )
+        {
+            this->f_update(tdata, thnum, 1);
+        }
+        else
 #endif /* RT_OPTS_THREAD */
-    {
-        update_scene(this, -thnum, 1);
+        {
+            update_scene(this, -thnum, 1);
+        }
     }
 
+    mark_phase(RT_PHASE_UPDATE1);
+
     /* update ray positioning and steppers */
     rt_real h, v;
 
@@ -3100,49 +3958,119 @@ rt_void rt_Scene::render(rt_time time)
     RT_VEC3_MUL_VAL1(htl, hor, h);
     RT_VEC3_MUL_VAL1(vtl, ver, v);
 
+    /* split surfaces into contiguous per-thread ranges
+     * of roughly equal costs measured in the last frame */
+    if (pfm->parts == RT_PARTS_COSTS && uplvl != RT_UPDATE_NONE)
+    {
+        rt_si32 c_all = 0, c_sum = 0, j = 1;
+
+        for (i = 0; i < srf_num; i++)
+        {
+            c_all += srf_c[i];
+        }
+        for (i = 0; i < srf_num && j < thnum; i++)
+        {
+            c_sum += srf_c[i];
+
+            while (j < thnum && c_sum * thnum >= c_all * j)
+            {
+                srf_p[j++] = i + 1;
+            }
+        }
+        for (; j <= thnum; j++)
+        {
+            srf_p[j] = srf_num;
+        }
+    }
+
+    /* reset object-chunk counter */
+    oline = 0;
+
     /* 2nd phase of multi-threaded update */
+    if (uplvl != RT_UPDATE_NONE)
+    {
 #if RT_OPTS_THREAD != 0
-    if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene() && !g_print
+        if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene()
+        &&  !g_print
 #if RT_OPTS_UPDATE_EXT2 != 0
-    &&  (opts & RT_OPTS_UPDATE_EXT2) == 0
+        &&  (opts & RT_OPTS_UPDATE_EXT2) == 0
 #endif /* RT_OPTS_UPDATE_EXT2 */
-       )
-    {
-        this->f_update(tdata, thnum, 2);
-    }
-    else
+           )
+        {
+            this->f_update(tdata, thnum, 2);
+        }
+        else
 #endif /* RT_OPTS_THREAD */
-    {
-        update_scene(this, -thnum, 2);
+        {
+            update_scene(this, -thnum, 2);
+        }
     }
 
-    /* phase 2.5, hierarchical update of arrays' bounds from surfaces */
-    root->update_bounds();
-
-    rt_Surface *srf;
+    mark_phase(RT_PHASE_UPDATE2);
 
-    /* update surfaces' node lists */
-    for (srf = srf_head; srf != RT_NULL; srf = srf->next)
+    if (uplvl == RT_UPDATE_FULL)
     {
-        /* rebuild surface's node list (per-surface)
-         * based on transform flags and arrays' bounds */
-        tharr[0]->snode(srf);
-    }
+        /* phase 2.5, hierarchical update of arrays' bounds from surfaces */
+        root->update_bounds();
+
+        /* rebuild BVH over surfaces' bounds
+         * or drop it for lists to stay as is */
+        bvh_top = -1;
+
+#if RT_OPTS_BVHSAH != 0
+        if ((opts & RT_OPTS_BVHSAH) != 0)
+        {
+            build_bvh();
+        }
+#endif /* RT_OPTS_BVHSAH */
+
+        mark_phase(RT_PHASE_BOUNDS);
+
+        rt_Surface *srf;
+
+        /* update surfaces' node lists */
+        for (srf = srf_head; srf != RT_NULL; srf = srf->next)
+        {
+            /* rebuild surface's node list (per-surface)
+             * based on transform flags and arrays' bounds */
+            tharr[0]->snode(srf);
+        }
+
+        mark_phase(RT_PHASE_SNODE);
 
-    /* rebuild global hierarchical list */
-    hlist = tharr[0]->ssort(RT_NULL);
+        /* rebuild global hierarchical list */
+        hlist = tharr[0]->ssort(RT_NULL);
 
-    /* rebuild global surface/node list */
-    slist = tharr[0]->ssort(RT_NULL);
-    tharr[0]->filter(RT_NULL, &slist);
+        /* rebuild global surface/node list */
+        slist = tharr[0]->ssort(RT_NULL);
 
-    /* rebuild global light/shadow list,
-     * "slist" is needed inside */
-    llist = tharr[0]->lsort(RT_NULL);
+        mark_phase(RT_PHASE_SSORT);
 
-    /* rebuild camera's surface/node list,
-     * "slist" is needed inside */
-    clist = tharr[0]->ssort(cam);
+        tharr[0]->filter(RT_NULL, &slist);
+        tharr[0]->sbvh(&slist);
+
+#if RT_OPTS_FLATTEN != 0
+        if ((opts & RT_OPTS_FLATTEN) != 0)
+        {
+            tharr[0]->sflat(&slist);
+        }
+#endif /* RT_OPTS_FLATTEN */
+
+        mark_phase(RT_PHASE_FILTER);
+
+        /* rebuild global light/shadow list,
+         * "slist" is needed inside */
+        llist = tharr[0]->lsort(RT_NULL);
+
+        mark_phase(RT_PHASE_LSORT);
+    }
+
+    if (uplvl != RT_UPDATE_NONE)
+    {
+        /* rebuild camera's surface/node list,
+         * "slist" is needed inside */
+        clist = tharr[0]->ssort(cam);
+    }
 
     if (g_print)
     {
@@ -3153,27 +4081,48 @@ rt_void rt_Scene::render(rt_time time)
         RT_PRINT_SRF_LST(clist);
     }
 
+    mark_phase(RT_PHASE_CSORT);
+
+    /* reset object-chunk counter */
+    oline = 0;
+
     /* 3rd phase of multi-threaded update */
+    if (uplvl == RT_UPDATE_FULL)
+    {
 #if RT_OPTS_THREAD != 0
-    if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene() && !g_print
+        if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene()
+        &&  !g_print
 #if RT_OPTS_UPDATE_EXT3 != 0
-    &&  (opts & RT_OPTS_UPDATE_EXT3) == 0
+        &&  (opts & RT_OPTS_UPDATE_EXT3) == 0
 #endif /* RT_OPTS_UPDATE_EXT3 */
-       )
-    {
-        this->f_update(tdata, thnum, 3);
-    }
-    else
+           )
+        {
+            this->f_update(tdata, thnum, 3);
+        }
+        else
 #endif /* RT_OPTS_THREAD */
-    {
-        update_scene(this, -thnum, 3);
+        {
+            update_scene(this, -thnum, 3);
+        }
+
+        /* set checkpoints for camera-dependent allocs,
+         * which are released by camera-only updates */
+        cpool = reserve(sizeof(rt_ELEM), RT_QUAD_ALIGN);
+
+        for (i = 0; i < thnum; i++)
+        {
+            tharr[i]->cpool =
+                tharr[i]->reserve(sizeof(rt_ELEM), RT_QUAD_ALIGN);
+        }
     }
 
+    mark_phase(RT_PHASE_UPDATE3);
+
     /* screen tiling */
     rt_si32 tline, j;
 
 #if RT_OPTS_TILING != 0
-    if ((opts & RT_OPTS_TILING) != 0)
+    if ((opts & RT_OPTS_TILING) != 0 && uplvl != RT_UPDATE_NONE)
     {
         memset(tiles, 0, sizeof(rt_ELEM *) * tiles_in_row * tiles_in_col);
 
@@ -3275,10 +4224,34 @@ rt_void rt_Scene::render(rt_time time)
             }
         }
 
-        if (g_print)
+#if RT_OPTS_BVHSAH != 0
+        /* reorder tile lists along BVH
+         * for primary rays */
+        for (i = 0; bvh_top >= 0 && i < tiles_in_row * tiles_in_col; i++)
         {
-            rt_si32 i = 0, j = 0;
-
+            if (tiles[i] == RT_NULL || tiles[i]->next == RT_NULL)
+            {
+                continue;
+            }
+
+            tharr[0]->sbvh(&tiles[i]);
+        }
+#endif /* RT_OPTS_BVHSAH */
+
+#if RT_OPTS_FLATTEN != 0
+        /* copy tile lists into
+         * contiguous arrays */
+        for (i = 0; (opts & RT_OPTS_FLATTEN) != 0
+                    && i < tiles_in_row * tiles_in_col; i++)
+        {
+            tharr[0]->sflat(&tiles[i]);
+        }
+#endif /* RT_OPTS_FLATTEN */
+
+        if (g_print)
+        {
+            rt_si32 i = 0, j = 0;
+
             tline = i * tiles_in_row;
 
             RT_PRINT_TLS_LST(tiles[tline + j], i, j);
@@ -3286,6 +4259,7 @@ rt_void rt_Scene::render(rt_time time)
     }
     else
 #endif /* RT_OPTS_TILING */
+    if (uplvl != RT_UPDATE_NONE)
     {
         for (i = 0; i < tiles_in_col; i++)
         {
@@ -3298,6 +4272,10 @@ rt_void rt_Scene::render(rt_time time)
         }
     }
 
+    cam_upd = cam;
+
+    mark_phase(RT_PHASE_TILING);
+
     /* aim rays at pixel centers */
     RT_VEC3_MUL_VAL1(hor, hor, factor);
     RT_VEC3_MUL_VAL1(ver, ver, factor);
@@ -3320,8 +4298,13 @@ rt_void rt_Scene::render(rt_time time)
 #if RT_OPTS_UPDATE_EXT0 != 0
     } /* --<----<-- skip update1 --<----<-- */
 #endif /* RT_OPTS_UPDATE_EXT0 */
+}
 
-
+/*
+ * Render frame from backend data structures of the last update.
+ */
+rt_void rt_Scene::render_frame()
+{
 #if RT_OPTS_RENDER_EXT0 != 0
     if ((opts & RT_OPTS_RENDER_EXT0) == 0)
     { /* -->---->-- skip render0 -->---->-- */
@@ -3331,6 +4314,51 @@ rt_void rt_Scene::render(rt_time time)
     reset_color();
 #endif /* enable for SIMD-buffers as a debug option if needed */
 
+    /* path-tracer always renders through SIMD-buffers,
+     * in auto mode regular frames use the faster choice
+     * after probing both, the other one is probed again
+     * periodically as rays' coherence changes with view */
+    if (pt_on != 0)
+    {
+        bf_on = 1;
+    }
+    else
+    if ((opts & RT_OPTS_BUFFERS) != 0
+    ||  (bf_md == RT_BUFF_AUTO && pfm->f_timer == RT_NULL))
+    {
+        bf_on = 0;
+    }
+    else
+    if (bf_md != RT_BUFF_AUTO)
+    {
+        bf_on = bf_md == RT_BUFF_ON;
+    }
+    else
+    {
+        bf_on = bf_tm[1] < bf_tm[0];
+        bf_on = bf_tm[0] == 0 ? 0 : bf_tm[1] == 0 ? 1 :
+                bf_fr % RT_BUFF_PROBE == RT_BUFF_PROBE - 1 ? 1 - bf_on : bf_on;
+        bf_fr++;
+    }
+
+    /* reset tile-row counter */
+    tline = 0;
+
+    /* count tiles left to converge in adaptive mode,
+     * spread frame's sample budget among them */
+    if (pt_on != 0 && cv_thr > 0.0f)
+    {
+        rt_si32 i, n = tiles_in_row * tiles_in_col;
+
+        for (i = 0, cv_num = 0; i < n; i++)
+        {
+            cv_num += cv_cnt[i] < RT_CONV_MIN || cv_err[i] >= cv_thr;
+        }
+
+        cv_spt = cv_num == 0 ? 0 :
+                 RT_MIN(pt_on * n / cv_num, pt_on * RT_CONV_MAX);
+    }
+
     /* multi-threaded render */
 #if RT_OPTS_THREAD != 0
     if ((opts & RT_OPTS_THREAD) != 0 && this == pfm->get_cur_scene()
@@ -3347,12 +4375,42 @@ rt_void rt_Scene::render(rt_time time)
         render_scene(this, -thnum, 1);
     }
 
-    pts_c = tharr[0]->s_inf->pts_c[0];
+    mark_phase(RT_PHASE_RENDER);
+
+    /* average render time of the choice in auto mode */
+    if (pt_on == 0 && bf_md == RT_BUFF_AUTO && pfm->f_timer != RT_NULL)
+    {
+        rt_time t = RT_MAX(phase_t[RT_PHASE_RENDER], 1);
+
+        bf_tm[bf_on] = bf_tm[bf_on] == 0 ? t : (bf_tm[bf_on] * 3 + t) / 4;
+    }
+
+    tn_all = 0;
+
+    /* store frame's phases in profiler's slot */
+    if (prof_n != 0)
+    {
+        memcpy(prof_h - RT_PHASE_NUM, phase_t, sizeof(phase_t));
+        prof_i++;
+    }
+
+    /* sample count of adaptive mode is kept per tile */
+    if (pt_on == 0 || cv_thr <= 0.0f)
+    {
+        pts_c = tharr[0]->s_inf->pts_c[0];
+    }
 
 #if RT_OPTS_RENDER_EXT0 != 0
     } /* --<----<-- skip render0 --<----<-- */
 #endif /* RT_OPTS_RENDER_EXT0 */
+}
 
+/*
+ * Release or keep temporary per-frame allocs after render.
+ */
+rt_void rt_Scene::finish_frame()
+{
+    rt_si32 i;
 
 #if RT_OPTS_UPDATE_EXT0 != 0
     if ((opts & RT_OPTS_UPDATE_EXT0) == 0)
@@ -3366,13 +4424,24 @@ rt_void rt_Scene::render(rt_time time)
         g_print = RT_FALSE;
     }
 
-    /* release memory for temporary per-frame allocs */
-    for (i = 0; i < thnum; i++)
+#if RT_OPTS_REUSE != 0
+    if ((opts & RT_OPTS_REUSE) != 0)
     {
-        tharr[i]->release(tharr[i]->mpool);
+        /* keep temporary per-frame allocs for incremental update,
+         * released there (fully or partially) if needed */
+        pending = 1;
     }
+    else
+#endif /* RT_OPTS_REUSE */
+    {
+        /* release memory for temporary per-frame allocs */
+        for (i = 0; i < thnum; i++)
+        {
+            tharr[i]->release(tharr[i]->mpool);
+        }
 
-    release(mpool);
+        release(mpool);
+    }
 
 #if RT_OPTS_UPDATE_EXT0 != 0
     } /* --<----<-- skip update2 --<----<-- */
@@ -3383,128 +4452,166 @@ rt_void rt_Scene::render(rt_time time)
 #endif /* RT_OPTS_UPDATE_EXT0 */
 }
 
+/*
+ * Count top-level elements in a given list.
+ */
+static
+rt_si32 count_lst(rt_pntr lst)
+{
+    rt_ELEM *elm;
+    rt_si32 n = 0;
+
+    for (elm = RT_GET_PTR(lst); elm != RT_NULL; elm = elm->next)
+    {
+        n++;
+    }
+
+    return n;
+}
+
 /*
  * Update portion of the scene with given "index"
  * as part of the multi-threaded update.
  */
 rt_void rt_Scene::update_slice(rt_si32 index, rt_si32 phase)
 {
-    rt_si32 i;
+    rt_si32 i, k;
+
+    /* timestamp for profiler */
+    rt_time t_beg = prof_n != 0 ? pfm->f_timer() : 0;
+
+    /* objects are either interleaved by thread index,
+     * claimed in chunks by any thread or split by costs
+     * into ranges (surfaces only, chunks are used for
+     * the 1st phase as it covers all types of objects) */
+    rt_si32 o_beg = phase == 1 ? 0 : obj_num - srf_num;
+    rt_si32 i_beg, i_end, i_inc = 1;
+    rt_si32 parts = pfm->parts;
+
+    if (parts == RT_PARTS_COSTS && phase == 1)
+    {
+        parts = RT_PARTS_CHUNKS;
+    }
+
+    if (parts == RT_PARTS_MODULO)
+    {
+        i_inc = thnum;
+    }
 
-    rt_Array   *arr;
-    rt_Camera  *cam;
-    rt_Light   *lgt;
     rt_Surface *srf;
 
-    if (phase == 1)
+    for (k = 0; ; k++)
     {
-        for (arr = arr_head, i = 0; arr != RT_NULL; arr = arr->next, i++)
+        if (parts == RT_PARTS_MODULO)
         {
-            if ((i % thnum) != index)
+            if (k > 0)
             {
-                continue;
+                break;
             }
 
-            /* update array's fields from transform matrix
-             * updated in sequential phase 0.5 */
-            arr->update_fields();
+            i_beg = o_beg + index;
+            i_end = obj_num;
         }
-
-        for (cam = cam_head, i = 0; cam != RT_NULL; cam = cam->next, i++)
+        else
+        if (parts == RT_PARTS_COSTS)
         {
-            if ((i % thnum) != index)
+            if (k > 0)
             {
-                continue;
+                break;
             }
 
-            /* update camera's fields and transform matrix
-             * from parent array's transform matrix
-             * updated in sequential phase 0.5 */
-            cam->update_fields();
+            i_beg = o_beg + srf_p[index];
+            i_end = o_beg + srf_p[index + 1];
         }
-
-        for (lgt = lgt_head, i = 0; lgt != RT_NULL; lgt = lgt->next, i++)
+        else
         {
-            if ((i % thnum) != index)
+            i_beg = o_beg + RT_ATOMIC_ADD(&oline, RT_PARTS_STEP);
+
+            if (i_beg >= obj_num)
             {
-                continue;
+                break;
             }
 
-            /* update light's fields and transform matrix
-             * from parent array's transform matrix
-             * updated in sequential phase 0.5 */
-            lgt->update_fields();
+            i_end = RT_MIN(i_beg + RT_PARTS_STEP, obj_num);
         }
 
-        for (srf = srf_head, i = 0; srf != RT_NULL; srf = srf->next, i++)
+        for (i = i_beg; i < i_end; i += i_inc)
         {
-            if ((i % thnum) != index)
+            if (phase == 1)
             {
-                continue;
-            }
+                /* update object's fields and transform matrix
+                 * from parent array's transform matrix
+                 * updated in sequential phase 0.5 */
+                oarr[i]->update_fields();
 
-            /* update surface's fields and transform matrix
-             * from parent array's transform matrix
-             * updated in sequential phase 0.5 */
-            srf->update_fields();
-        }
-    }
-    else
-    if (phase == 2)
-    {
-        for (srf = srf_head, i = 0; srf != RT_NULL; srf = srf->next, i++)
-        {
-            if ((i % thnum) != index)
-            {
                 continue;
             }
 
-            /* rebuild surface's clip list (cross-surface)
-             * based on transform flags updated in 1st phase above */
-            tharr[index]->sclip(srf);
-
-            /* update surface's bounds taking into account surfaces
-             * from custom clippers list updated above */
-            srf->update_bounds();
+            srf = (rt_Surface *)oarr[i];
 
-            /* rebuild surface's tile list (per-surface)
-             * based on surface bounds updated above */
-            tharr[index]->stile(srf);
-        }
-    }
-    else
-    if (phase == 3)
-    {
-        for (srf = srf_head, i = 0; srf != RT_NULL; srf = srf->next, i++)
-        {
-            if ((i % thnum) != index)
+            if (phase == 2 && uplvl == RT_UPDATE_FULL)
             {
-                continue;
-            }
+                /* rebuild surface's clip list (cross-surface)
+                 * based on transform flags updated in 1st phase above */
+                tharr[index]->sclip(srf);
+
+                /* update surface's bounds taking into account surfaces
+                 * from custom clippers list updated above */
+                srf->update_bounds();
 
-            if (g_print)
+                /* rebuild surface's tile list (per-surface)
+                 * based on surface bounds updated above */
+                tharr[index]->stile(srf);
+            }
+            else
+            if (phase == 2)
             {
-                RT_PRINT_SRF(srf);
+                /* rebuild surface's tile list only (per-surface)
+                 * as surface bounds haven't changed since last frame */
+                tharr[index]->stile(srf);
             }
+            else
+            if (phase == 3)
+            {
+                if (g_print)
+                {
+                    RT_PRINT_SRF(srf);
+                }
 
-            /* rebuild surface's rfl/rfr surface lists (cross-surface)
-             * based on surface bounds updated in 2nd phase above
-             * and array bounds updated in sequential phase 2.5 */
-            tharr[index]->ssort(srf);
+                /* rebuild surface's rfl/rfr surface lists (cross-surface)
+                 * based on surface bounds updated in 2nd phase above
+                 * and array bounds updated in sequential phase 2.5 */
+                tharr[index]->ssort(srf);
 
-            /* rebuild surface's light/shadow lists (cross-surface)
-             * based on surface bounds updated in 2nd phase above
-             * and array bounds updated in sequential phase 2.5 */
-            tharr[index]->lsort(srf);
+                /* rebuild surface's light/shadow lists (cross-surface)
+                 * based on surface bounds updated in 2nd phase above
+                 * and array bounds updated in sequential phase 2.5 */
+                tharr[index]->lsort(srf);
 
-            /* update surface's backend-related parts */
-            pfm->update0(srf->s_srf);
+                /* update surface's backend-related parts */
+                pfm->update0(srf->s_srf);
 
 #if 0 /* SIMD-buffers don't normally require reset between frames */
-            memset(srf->s_srf->msc_p[0], 255, RT_BUFFER_POOL*thnum);
+                memset(srf->s_srf->msc_p[0], 255, RT_BUFFER_POOL*thnum);
 #endif /* enable for SIMD-buffers as a debug option if needed */
+
+                /* record surface's cost for the next frame's ranges
+                 * from the sizes of its clip and light/shadow lists */
+                if (pfm->parts == RT_PARTS_COSTS)
+                {
+                    srf_c[i - o_beg] = 1 + count_lst(srf->s_srf->msc_p[2])
+                                         + count_lst(srf->s_srf->lst_p[0])
+                                         + count_lst(srf->s_srf->lst_p[2]);
+                }
+            }
         }
     }
+
+    /* record thread's time of the update phase */
+    if (prof_n != 0)
+    {
+        prof_h[index * RT_PHASE_THR + phase - 1] = pfm->f_timer() - t_beg;
+    }
 }
 
 /*
@@ -3513,10 +4620,36 @@ rt_void rt_Scene::update_slice(rt_si32 index, rt_si32 phase)
  */
 rt_void rt_Scene::render_slice(rt_si32 index, rt_si32 phase)
 {
+    /* in pipelined mode the 1st thread updates the next frame
+     * before joining others in rendering the current one */
+    if (index == 0 && pipe_u != RT_NULL)
+    {
+        pipe_u->update_frame(pipe_t);
+    }
+
     /* adjust ray steppers according to antialiasing mode */
     rt_real fha[RT_SIMD_WIDTH], fhi[RT_SIMD_WIDTH], fhu; /* h - hor */
     rt_real fva[RT_SIMD_WIDTH], fvi[RT_SIMD_WIDTH], fvu; /* v - ver */
-    rt_si32 i, n;
+    rt_si32 i, n, k, m, t = 0;
+
+    /* adaptive path-tracer samples tiles separately */
+    rt_bool cv_on = pt_on != 0 && cv_thr > 0.0f;
+    rt_bool tl_on = cost_on || cv_on;
+
+    /* rows are either interleaved by thread index
+     * or claimed as whole tile-rows by any thread,
+     * single tiles are used if costs are recorded
+     * or path-tracer's sampling is adaptive */
+    rt_si32 y_beg = index, y_end = y_res;
+    rt_si32 x_beg = 0, x_end = x_res;
+    rt_si32 y_inc = pfm->sched == RT_SCHED_ROWS && !tl_on ? thnum : 1;
+    rt_si32 y_blk = pfm->tile_h * RT_SCHED_STEP;
+
+    /* timestamps for render costs */
+    rt_time t_beg = 0, t_til = 0, t_bsy = 0;
+
+    /* timestamp for profiler */
+    rt_time t_prf = prof_n != 0 ? pfm->f_timer() : 0;
 
     if (pfm->fsaa == RT_FSAA_NO)
     {
@@ -3526,11 +4659,11 @@ rt_void rt_Scene::render_slice(rt_si32 index, rt_si32 phase)
             fva[i] = 0.0f;
 
             fhi[i] = (rt_real)i;
-            fvi[i] = (rt_real)index;
+            fvi[i] = 0.0f;
         }
 
         fhu = (rt_real)(pfm->simd_width);
-        fvu = (rt_real)thnum;
+        fvu = (rt_real)y_inc;
     }
     else
     if (pfm->fsaa == RT_FSAA_2X) /* alternating */
@@ -3559,14 +4692,14 @@ rt_void rt_Scene::render_slice(rt_si32 index, rt_si32 phase)
             fhi[i*4+2] = (rt_real)(i*2+1);
             fhi[i*4+3] = (rt_real)(i*2+1);
 
-            fvi[i*4+0] = (rt_real)index;
-            fvi[i*4+1] = (rt_real)index;
-            fvi[i*4+2] = (rt_real)index;
-            fvi[i*4+3] = (rt_real)index;
+            fvi[i*4+0] = 0.0f;
+            fvi[i*4+1] = 0.0f;
+            fvi[i*4+2] = 0.0f;
+            fvi[i*4+3] = 0.0f;
         }
 
         fhu = (rt_real)(pfm->simd_width / 2);
-        fvu = (rt_real)thnum;
+        fvu = (rt_real)y_inc;
     }
     else
     if (pfm->fsaa == RT_FSAA_4X)
@@ -3595,14 +4728,14 @@ rt_void rt_Scene::render_slice(rt_si32 index, rt_si32 phase)
             fhi[i*4+2] = (rt_real)i;
             fhi[i*4+3] = (rt_real)i;
 
-            fvi[i*4+0] = (rt_real)index;
-            fvi[i*4+1] = (rt_real)index;
-            fvi[i*4+2] = (rt_real)index;
-            fvi[i*4+3] = (rt_real)index;
+            fvi[i*4+0] = 0.0f;
+            fvi[i*4+1] = 0.0f;
+            fvi[i*4+2] = 0.0f;
+            fvi[i*4+3] = 0.0f;
         }
 
         fhu = (rt_real)(pfm->simd_width / 4);
-        fvu = (rt_real)thnum;
+        fvu = (rt_real)y_inc;
     }
     else
     if (pfm->fsaa == RT_FSAA_8X) /* 8x reserved */
@@ -3668,30 +4801,167 @@ rt_void rt_Scene::render_slice(rt_si32 index, rt_si32 phase)
     s_inf->fsaa  = pfm->fsaa;
 
     s_inf->pt_on = pt_on;
+    s_inf->bf_on = bf_on;
+
+    /* squared pixel footprint per unit of distance,
+     * used with camera position for texture's mip-level */
+    rt_real lod_s = RT_VEC3_DOT(hor, hor) /
+                   (RT_VEC3_DOT(nrm, nrm) * cam->pov * cam->pov);
 
-    RT_SIMD_SET(s_inf->pts_c, pts_c);
+    RT_SIMD_SET(s_inf->pos_x, pos[RT_X]);
+    RT_SIMD_SET(s_inf->pos_y, pos[RT_Y]);
+    RT_SIMD_SET(s_inf->pos_z, pos[RT_Z]);
+    RT_SIMD_SET(s_inf->lod_s, lod_s);
 
-    for (n = RT_MAX(1, pt_on); n > 0; n--)
+    /* backend skips frame output if resolved below */
+    s_inf->frm_o = pt_on != 0 && tn_on != RT_TONE_NONE;
+
+    s_inf->frm_u = y_inc;
+
+    if (cost_on)
     {
-        /* use of integer indices for primary rays update
-         * makes related fp-math independent from SIMD width */
-        for (i = 0; i < pfm->simd_width; i++)
+        t_beg = pfm->f_timer();
+    }
+
+    for (k = 0; ; k++)
+    {
+        if (tl_on)
+        {
+            t = pfm->sched == RT_SCHED_ROWS ? index + k * thnum :
+                RT_ATOMIC_ADD(&tline, 1);
+
+            if (t >= tiles_in_row * tiles_in_col)
+            {
+                break;
+            }
+
+            y_beg = (t / tiles_in_row) * pfm->tile_h;
+            y_end = RT_MIN(y_beg + pfm->tile_h, y_res);
+            x_beg = (t % tiles_in_row) * pfm->tile_w;
+            x_end = RT_MIN(x_beg + pfm->tile_w, x_res);
+        }
+        else
+        if (pfm->sched == RT_SCHED_ROWS)
+        {
+            if (k > 0)
+            {
+                break;
+            }
+        }
+        else
+        {
+            y_beg = RT_ATOMIC_ADD(&tline, 1) * y_blk;
+
+            if (y_beg >= y_res)
+            {
+                break;
+            }
+
+            y_end = RT_MIN(y_beg + y_blk, y_res);
+        }
+
+        if (cost_on)
+        {
+            t_til = pfm->f_timer();
+        }
+
+        s_inf->frm_s = y_beg;
+        s_inf->frm_e = y_end;
+        s_inf->frm_l = x_beg;
+        s_inf->frm_r = x_end;
+
+        m = RT_MAX(1, pt_on);
+
+        /* in adaptive mode each tile keeps its own sample count,
+         * converged tiles are skipped, others share the frame's budget */
+        if (cv_on)
+        {
+            m = cv_cnt[t] >= RT_CONV_MIN && cv_err[t] < cv_thr ? 0 : cv_spt;
+
+            if (m > 0)
+            {
+                conv_save(index, t);
+            }
+
+            RT_SIMD_SET(s_inf->pts_c, cv_cnt[t]);
+        }
+        else
+        {
+            RT_SIMD_SET(s_inf->pts_c, pts_c);
+        }
+
+        for (n = m; n > 0; n--)
         {
-            s_cam->index[i] = i;
-            s_inf->hor_c[i] = fhi[i];
+            /* use of integer indices for primary rays update
+             * makes related fp-math independent from SIMD width */
+            for (i = 0; i < pfm->simd_width; i++)
+            {
+                s_cam->index[i] = i + (x_beg << pfm->fsaa);
+                s_inf->hor_c[i] = fhi[i] + (rt_real)x_beg;
+
+                s_inf->hor_i[i] = fhi[i] + (rt_real)x_beg;
+                s_inf->ver_i[i] = fvi[i] + (rt_real)y_beg;
+
+                s_cam->hor_a[i] = fha[i];
+                s_cam->ver_a[i] = fva[i];
+            }
+
+            s_inf->depth = depth;
+            RT_SIMD_SET(s_ctx->wmask, -1);
+
+            /* render frame based on tilebuffer */
+            pfm->render0(s_inf);
+        }
+
+        if (cv_on && m > 0)
+        {
+            cv_cnt[t] = s_inf->pts_c[0];
+            cv_err[t] = conv_error(index, t, m);
+        }
+
+        /* resolve color-planes into the frame once per frame,
+         * skipped tiles only if tonemap settings have changed */
+        if (s_inf->frm_o != 0 && (m > 0 || tn_all != 0))
+        {
+            resolve(y_beg, y_end, y_inc, x_beg, x_end);
+        }
+
+        if (cost_on)
+        {
+            rt_ELEM *elm;
+
+            t_til = pfm->f_timer() - t_til;
+            t_bsy += t_til;
 
-            s_inf->hor_i[i] = fhi[i];
-            s_inf->ver_i[i] = fvi[i];
+            cost_t[t] = t_til;
+            cost_r[t] = ((y_end - y_beg) * (x_end - x_beg) << pfm->fsaa) * m;
+            cost_h[t] = index;
 
-            s_cam->hor_a[i] = fha[i];
-            s_cam->ver_a[i] = fva[i];
+            for (cost_l[t] = 0, elm = tiles[t]; elm != RT_NULL; elm = elm->next)
+            {
+                cost_l[t]++;
+            }
         }
+    }
+
+    if (cost_on)
+    {
+        cost_w[index] = pfm->f_timer() - t_beg;
+        cost_b[index] = t_bsy;
+    }
 
-        s_inf->depth = depth;
-        RT_SIMD_SET(s_ctx->wmask, -1);
+    /* keep path-tracer's sample count in sync
+     * if no tile-rows were left for this thread */
+    if (k == 0 && pt_on != 0)
+    {
+        RT_SIMD_SET(s_inf->pts_c, pts_c + (rt_real)pt_on);
+    }
 
-        /* render frame based on tilebuffer */
-        pfm->render0(s_inf);
+    /* record thread's time of the render phase */
+    if (prof_n != 0)
+    {
+        prof_h[index * RT_PHASE_THR + RT_PHASE_THR - 1] =
+                                                pfm->f_timer() - t_prf;
     }
 }
 
@@ -3743,7 +5013,7 @@ rt_void rt_Scene::reset_pseed()
     }
 
     rt_si32 k, n = 4 * x_row * y_res;
-    rt_ui64 seed = 1;
+    rt_ui64 seed = (rt_ui64)pt_sd;
 
     for (k = 0; k < n; k++)
     {
@@ -3764,71 +5034,1240 @@ rt_void rt_Scene::reset_color()
 
     pts_c = 0.0f;
 
-    memset(ptr_r, 0, 4 * x_row * y_res * sizeof(rt_real));
-    memset(ptr_g, 0, 4 * x_row * y_res * sizeof(rt_real));
-    memset(ptr_b, 0, 4 * x_row * y_res * sizeof(rt_real));
+    memset(ptr_r, 0, 4 * x_row * y_res * sizeof(rt_pelm));
+    memset(ptr_g, 0, 4 * x_row * y_res * sizeof(rt_pelm));
+    memset(ptr_b, 0, 4 * x_row * y_res * sizeof(rt_pelm));
+
+    if (cv_cnt != RT_NULL)
+    {
+        rt_si32 i, n = tiles_in_row * tiles_in_col;
+
+        for (i = 0; i < n; i++)
+        {
+            cv_cnt[i] = 0.0f;
+            cv_err[i] = RT_INF;
+        }
+    }
 }
 
 /*
- * Get runtime optimization flags.
+ * Convert fp-color plane's element "v" to rt_real and back,
+ * fp16 conversion matches the backend: exponent is rebased
+ * by scaling with 2^112 (smaller values flush to 0 with DAZ/FTZ),
+ * values are clamped to fp16 max (65504) and rounded half up.
  */
-rt_si32 rt_Scene::get_opts()
+static
+rt_real plane_ld(rt_pelm v)
 {
-    return opts;
+#if RT_PLANE_HALF != 0
+    rt_ui32 u = (rt_ui32)v << 13;
+    rt_fp32 f;
+
+    memcpy(&f, &u, sizeof(rt_fp32));
+
+    return f * 5.1922968585348276e+33f;
+#else  /* RT_PLANE_HALF == 0 */
+    return v;
+#endif /* RT_PLANE_HALF == 0 */
 }
 
-/*
- * Set runtime optimization flags,
- * except those turned off in the original scene definition.
- */
-rt_si32 rt_Scene::set_opts(rt_si32 opts)
+static
+rt_pelm plane_st(rt_real v)
 {
-    this->opts = opts & ~scn->opts;
+#if RT_PLANE_HALF != 0
+    rt_fp32 f = RT_MIN(v, 65504.0f) * 1.9259299443872359e-34f;
+    rt_ui32 u;
 
-    /* trigger update of the whole hierarchy,
-     * safe to reset time as "rootobj" never has an animator,
-     * "rootobj's" time is restored within the update */
-    rootobj.time = -1;
+    memcpy(&u, &f, sizeof(rt_ui32));
 
-    return opts;
+    return (rt_pelm)((u + 0x1000) >> 13);
+#else  /* RT_PLANE_HALF == 0 */
+    return v;
+#endif /* RT_PLANE_HALF == 0 */
 }
 
 /*
- * Get path-tracer mode: 0 - off, n - on (number of frames between updates).
+ * Convert linear color "c" (0.0 - 1.0) to sRGB display space,
+ * "1.055 * c^(1/2.4) - 0.055" is approximated with square roots
+ * (max error is 1/4 of 8-bit step), which vectorize unlike pow.
  */
-rt_si32 rt_Scene::get_pton()
+static
+rt_real srgb_encode(rt_real c)
 {
-    return this->pt_on;
+    rt_real s1 = RT_SQRT(c);
+    rt_real s2 = RT_SQRT(s1);
+    rt_real s3 = RT_SQRT(s2);
+
+    return c <= 0.0031308f ? 12.92f * c : RT_MIN(1.0f,
+           0.662002687f * s1 + 0.684122060f * s2
+         - 0.323583601f * s3 - 0.022541147f * c);
 }
 
 /*
- * Set path-tracer mode: 0 - off, n - on (number of frames between updates).
+ * Resolve path-tracer's color-planes into the frame for rows
+ * from "y_beg" to "y_end" (with "y_inc" step), cols from "x_beg" to "x_end":
+ * exposure and tonemap per sample, average of antialiasing samples,
+ * sRGB transfer (if gamma is on) and quantization to 8-bit channels.
+ * Rows are processed in chunks of RT_TONE_CHUNK pixels by plain loops
+ * over contiguous arrays for compilers to vectorize.
  */
-rt_si32 rt_Scene::set_pton(rt_si32 pton)
+rt_void rt_Scene::resolve(rt_si32 y_beg, rt_si32 y_end, rt_si32 y_inc,
+                          rt_si32 x_beg, rt_si32 x_end)
 {
-    if ((opts & RT_OPTS_PT) == 0) /* if path-tracer is not optimized out */
-    {
-        rt_si32 pt_on = this->pt_on;
-
-        this->pt_on = pton;
+    rt_real col[3][RT_TONE_CHUNK << 2];
+    rt_pelm *ptr[3] = {ptr_r, ptr_g, ptr_b};
+    rt_bool gamma = (opts & RT_OPTS_GAMMA) == 0;
+    rt_si32 f = pfm->fsaa, s = 1 << f;
+    rt_real e = tn_exp, a = 1.0f / (rt_real)s, c;
+    rt_si32 i, j, k, l, n, p, x, y;
 
-        if (this->pt_on && !pt_on)
+    for (y = y_beg; y < y_end; y += y_inc)
+    {
+        for (x = x_beg; x < x_end; x += RT_TONE_CHUNK)
         {
-            reset_pseed();
-            reset_color();
-        }
-    }
+            n = RT_MIN(RT_TONE_CHUNK, x_end - x);
+            k = n << f;
+            j = (y * x_row + x) << f;
 
-    return this->pt_on;
-}
+            for (p = 0; p < 3; p++)
+            {
+                rt_pelm *src = ptr[p] + j;
+                rt_real *dst = col[p];
 
-/*
- * Return current camera index.
- */
-rt_si32 rt_Scene::get_cam_idx()
-{
-    return cam_idx;
-}
+                /* exposure and tonemap per sample */
+                switch (tn_on)
+                {
+                    case RT_TONE_REINHARD:
+                    for (l = 0; l < k; l++)
+                    {
+                        c = RT_MAX(plane_ld(src[l]) * e, 0.0f);
+                        dst[l] = c / (1.0f + c);
+                    }
+                    break;
+
+                    case RT_TONE_FILMIC:
+                    for (l = 0; l < k; l++)
+                    {
+                        c = RT_MAX(plane_ld(src[l]) * e, 0.0f);
+                        c = (c * (2.51f * c + 0.03f))
+                          / (c * (2.43f * c + 0.59f) + 0.14f);
+                        dst[l] = RT_MIN(c, 1.0f);
+                    }
+                    break;
+
+                    default:
+                    for (l = 0; l < k; l++)
+                    {
+                        c = RT_MAX(plane_ld(src[l]) * e, 0.0f);
+                        dst[l] = RT_MIN(c, 1.0f);
+                    }
+                    break;
+                }
+
+                /* average samples in place, reads stay ahead of writes */
+                for (i = 0; i < n && s > 1; i++)
+                {
+                    for (l = 0, c = 0.0f; l < s; l++)
+                    {
+                        c += dst[(i << f) + l];
+                    }
+                    dst[i] = c * a;
+                }
+
+                if (gamma)
+                {
+                    for (i = 0; i < n; i++)
+                    {
+                        dst[i] = srgb_encode(dst[i]);
+                    }
+                }
+            }
+
+            /* quantize to packed 8-bit channels */
+            rt_ui32 *frm = frame + y * x_row + x;
+
+            for (i = 0; i < n; i++)
+            {
+                frm[i] = (rt_ui32)(col[0][i] * 255.0f + 0.5f) << 16
+                       | (rt_ui32)(col[1][i] * 255.0f + 0.5f) << 8
+                       | (rt_ui32)(col[2][i] * 255.0f + 0.5f);
+            }
+        }
+    }
+}
+
+/*
+ * Save tile "t" colors before sampling it in adaptive mode,
+ * "index" selects thread's copy.
+ */
+rt_void rt_Scene::conv_save(rt_si32 index, rt_si32 t)
+{
+    rt_si32 y_beg = (t / tiles_in_row) * pfm->tile_h;
+    rt_si32 y_end = RT_MIN(y_beg + pfm->tile_h, y_res);
+    rt_si32 x_beg = (t % tiles_in_row) * pfm->tile_w;
+    rt_si32 x_end = RT_MIN(x_beg + pfm->tile_w, x_res);
+    rt_si32 x_len = (x_end - x_beg) << pfm->fsaa;
+
+    rt_pelm *tmp = cv_tmp + index * 3 * (pfm->tile_w * pfm->tile_h << 2);
+    rt_si32 i, j;
+
+    for (i = y_beg; i < y_end; i++)
+    {
+        j = (i * x_row + x_beg) << pfm->fsaa;
+
+        memcpy(tmp, ptr_r + j, x_len * sizeof(rt_pelm));
+        tmp += x_len;
+        memcpy(tmp, ptr_g + j, x_len * sizeof(rt_pelm));
+        tmp += x_len;
+        memcpy(tmp, ptr_b + j, x_len * sizeof(rt_pelm));
+        tmp += x_len;
+    }
+}
+
+/*
+ * Estimate error of tile "t" colors after "n" new samples in adaptive mode
+ * from their change against the copy saved before (thread's "index").
+ * For running mean over "c" samples updated with "n" more,
+ * squared change "d^2" gives sample variance "s^2 = d^2 * c * (c+n) / n",
+ * hence variance of the new mean is "s^2 / (c+n) = d^2 * c / n".
+ * Return standard error averaged over the tile, scaled to display
+ * (gamma 2.0) space if gamma is on, infinite if not enough samples.
+ */
+rt_real rt_Scene::conv_error(rt_si32 index, rt_si32 t, rt_si32 n)
+{
+    rt_si32 y_beg = (t / tiles_in_row) * pfm->tile_h;
+    rt_si32 y_end = RT_MIN(y_beg + pfm->tile_h, y_res);
+    rt_si32 x_beg = (t % tiles_in_row) * pfm->tile_w;
+    rt_si32 x_end = RT_MIN(x_beg + pfm->tile_w, x_res);
+    rt_si32 x_len = (x_end - x_beg) << pfm->fsaa;
+
+    rt_pelm *tmp = cv_tmp + index * 3 * (pfm->tile_w * pfm->tile_h << 2);
+    rt_pelm *ptr[3] = {ptr_r, ptr_g, ptr_b};
+    rt_real c = cv_cnt[t] - (rt_real)n, d, v, e = 0.0f;
+    rt_bool gamma = (opts & RT_OPTS_GAMMA) == 0;
+    rt_si32 i, j, l, p;
+
+    if (c < 1.0f)
+    {
+        return RT_INF;
+    }
+
+    for (i = y_beg; i < y_end; i++)
+    {
+        j = (i * x_row + x_beg) << pfm->fsaa;
+
+        for (p = 0; p < 3; p++)
+        {
+            for (l = 0; l < x_len; l++, tmp++)
+            {
+                v = plane_ld(ptr[p][j + l]);
+                d = v - plane_ld(*tmp);
+                e += gamma ? d * d / (4.0f * RT_MAX(v, 0.0f) + 0.015625f) :
+                             d * d;
+            }
+        }
+    }
+
+    e *= c / ((rt_real)n * (rt_real)(3 * x_len * (y_end - y_beg)));
+
+    return RT_SQRT(e);
+}
+
+/*
+ * Build SAH-based BVH over surfaces with finite bounds in world space
+ * (without trnode), other surfaces are left to the lists as they are.
+ * Can only be called from single (main) thread.
+ */
+rt_void rt_Scene::build_bvh()
+{
+    rt_Surface *srf;
+    rt_si32 n = 0;
+
+    for (srf = srf_head; srf != RT_NULL; srf = srf->next)
+    {
+        rt_BOUND *box = srf->bvbox;
+
+        srf->bvh_i = -1;
+
+        if (box->trnode == RT_NULL && box->rad != 0.0f && box->rad != RT_INF)
+        {
+            bvh_srf[n++] = srf;
+        }
+    }
+
+    bvh_top = -1;
+    bvh_nin = 0;
+
+    /* smaller scenes are better off
+     * with their lists left as is */
+    if (n > RT_BVHSAH_LEAF && n >= RT_BVHSAH_MINS)
+    {
+        bvh_num = 0;
+        bvh_top = split_bvh(0, n, -1);
+    }
+}
+
+/*
+ * Split surfaces "bvh_srf[beg..end)" by centroids using binned SAH,
+ * build BVH node over them along with its children (recursive).
+ * Return node's index in "bvh_arr".
+ */
+rt_si32 rt_Scene::split_bvh(rt_si32 beg, rt_si32 end, rt_si32 up)
+{
+    rt_si32 n = bvh_num++, i, j, k, b;
+    rt_BVHNODE *nd = &bvh_arr[n];
+
+    rt_vec4 cmin, cmax, mid, dff;
+
+    RT_VEC3_SET_VAL1(nd->bmin, +RT_INF);
+    RT_VEC3_SET_VAL1(nd->bmax, -RT_INF);
+    RT_VEC3_SET_VAL1(cmin, +RT_INF);
+    RT_VEC3_SET_VAL1(cmax, -RT_INF);
+
+    for (i = beg; i < end; i++)
+    {
+        rt_BOUND *box = bvh_srf[i]->bvbox;
+
+        RT_VEC3_MIN(nd->bmin, nd->bmin, box->bmin);
+        RT_VEC3_MAX(nd->bmax, nd->bmax, box->bmax);
+
+        RT_VEC3_ADD(mid, box->bmin, box->bmax);
+        RT_VEC3_MIN(cmin, cmin, mid);
+        RT_VEC3_MAX(cmax, cmax, mid);
+    }
+
+    nd->up = up;
+    nd->num = end - beg;
+    nd->kid[0] = beg;
+    nd->kid[1] = -1;
+    nd->s_bvh = RT_NULL;
+
+    /* find the cheapest split plane across all axes,
+     * costs are relative to surface intersection */
+    rt_real cost = RT_INF, area, bxa, lft[RT_BVHSAH_BINS];
+    rt_si32 axs = -1, pln = 0, cnt[RT_BVHSAH_BINS], c;
+    rt_vec4 bmin[RT_BVHSAH_BINS], bmax[RT_BVHSAH_BINS], smin, smax;
+
+    RT_VEC3_SUB(dff, nd->bmax, nd->bmin);
+    area = dff[RT_X] * dff[RT_Y] + dff[RT_Y] * dff[RT_Z] +
+           dff[RT_Z] * dff[RT_X];
+
+    for (k = 0; k < 3 && nd->num > 1; k++)
+    {
+        rt_real ext = cmax[k] - cmin[k];
+
+        if (ext <= 0.0f)
+        {
+            continue;
+        }
+
+        for (b = 0; b < RT_BVHSAH_BINS; b++)
+        {
+            cnt[b] = 0;
+            RT_VEC3_SET_VAL1(bmin[b], +RT_INF);
+            RT_VEC3_SET_VAL1(bmax[b], -RT_INF);
+        }
+
+        for (i = beg; i < end; i++)
+        {
+            rt_BOUND *box = bvh_srf[i]->bvbox;
+
+            b = (rt_si32)((box->bmin[k] + box->bmax[k] - cmin[k]) *
+                          RT_BVHSAH_BINS / ext);
+            b = RT_MIN(b, RT_BVHSAH_BINS - 1);
+
+            cnt[b]++;
+            RT_VEC3_MIN(bmin[b], bmin[b], box->bmin);
+            RT_VEC3_MAX(bmax[b], bmax[b], box->bmax);
+        }
+
+        /* sweep from the left, store areas */
+        RT_VEC3_SET_VAL1(smin, +RT_INF);
+        RT_VEC3_SET_VAL1(smax, -RT_INF);
+
+        for (b = 0; b < RT_BVHSAH_BINS - 1; b++)
+        {
+            RT_VEC3_MIN(smin, smin, bmin[b]);
+            RT_VEC3_MAX(smax, smax, bmax[b]);
+            RT_VEC3_SUB(dff, smax, smin);
+
+            lft[b] = dff[RT_X] * dff[RT_Y] + dff[RT_Y] * dff[RT_Z] +
+                     dff[RT_Z] * dff[RT_X];
+        }
+
+        /* sweep from the right, evaluate splits */
+        RT_VEC3_SET_VAL1(smin, +RT_INF);
+        RT_VEC3_SET_VAL1(smax, -RT_INF);
+
+        for (b = RT_BVHSAH_BINS - 1, c = 0, j = nd->num; b > 0; b--)
+        {
+            c += cnt[b];
+            j -= cnt[b];
+
+            RT_VEC3_MIN(smin, smin, bmin[b]);
+            RT_VEC3_MAX(smax, smax, bmax[b]);
+            RT_VEC3_SUB(dff, smax, smin);
+
+            if (c == 0 || j == 0)
+            {
+                continue;
+            }
+
+            bxa = lft[b - 1] * j + c *
+                 (dff[RT_X] * dff[RT_Y] + dff[RT_Y] * dff[RT_Z] +
+                  dff[RT_Z] * dff[RT_X]);
+
+            if (cost > bxa)
+            {
+                cost = bxa;
+                axs = k;
+                pln = b;
+            }
+        }
+    }
+
+    /* make a leaf if it's cheaper than the split */
+    if (nd->num <= 1 || (nd->num <= RT_BVHSAH_LEAF
+    &&  (axs < 0 || area + cost >= area * nd->num)))
+    {
+        for (i = beg; i < end; i++)
+        {
+            bvh_srf[i]->bvh_i = i;
+            bvh_lnd[i] = n;
+        }
+
+        return n;
+    }
+
+    /* partition surfaces by the split plane,
+     * or in halves if centroids are all the same */
+    j = beg + nd->num / 2;
+
+    if (axs >= 0)
+    {
+        rt_real ext = cmax[axs] - cmin[axs];
+
+        for (i = beg, j = end; i < j;)
+        {
+            rt_BOUND *box = bvh_srf[i]->bvbox;
+
+            b = (rt_si32)((box->bmin[axs] + box->bmax[axs] - cmin[axs]) *
+                          RT_BVHSAH_BINS / ext);
+            b = RT_MIN(b, RT_BVHSAH_BINS - 1);
+
+            if (b < pln)
+            {
+                i++;
+            }
+            else
+            {
+                rt_Surface *srf = bvh_srf[i];
+                bvh_srf[i] = bvh_srf[--j];
+                bvh_srf[j] = srf;
+            }
+        }
+
+        if (j == beg || j == end)
+        {
+            j = beg + nd->num / 2;
+        }
+    }
+
+    nd->num = 0;
+    nd->kid[0] = split_bvh(beg, j, n);
+    nd->kid[1] = split_bvh(j, end, n);
+
+    /* init inner node's bounding volume,
+     * ellipsoid around its (non-flat) bbox */
+    nd->s_bvh = bvh_smd[bvh_nin++];
+
+    RT_VEC3_SUB(dff, nd->bmax, nd->bmin);
+
+    rt_real pad = RT_MAX(RT_MAX(dff[RT_X], dff[RT_Y]), dff[RT_Z]);
+    pad = pad > 0.0f ? pad * (1.0f / 64.0f) : 1.0f;
+
+    RT_VEC3_ADD(mid, nd->bmin, nd->bmax);
+
+    RT_SIMD_SET(nd->s_bvh->pos_x, mid[RT_X] * 0.5f);
+    RT_SIMD_SET(nd->s_bvh->pos_y, mid[RT_Y] * 0.5f);
+    RT_SIMD_SET(nd->s_bvh->pos_z, mid[RT_Z] * 0.5f);
+
+    dff[RT_X] = RT_MAX(dff[RT_X], pad);
+    dff[RT_Y] = RT_MAX(dff[RT_Y], pad);
+    dff[RT_Z] = RT_MAX(dff[RT_Z], pad);
+
+    RT_SIMD_SET(nd->s_bvh->sci_w, 0.75f); /* unit cube's radius squared */
+    RT_SIMD_SET(nd->s_bvh->sci_x, 1.0f / (dff[RT_X] * dff[RT_X]));
+    RT_SIMD_SET(nd->s_bvh->sci_y, 1.0f / (dff[RT_Y] * dff[RT_Y]));
+    RT_SIMD_SET(nd->s_bvh->sci_z, 1.0f / (dff[RT_Z] * dff[RT_Z]));
+
+    return n;
+}
+
+/*
+ * Get runtime optimization flags.
+ */
+rt_si32 rt_Scene::get_opts()
+{
+    return opts;
+}
+
+/*
+ * Set runtime optimization flags,
+ * except those turned off in the original scene definition.
+ */
+rt_si32 rt_Scene::set_opts(rt_si32 opts)
+{
+    this->opts = opts & ~scn->opts;
+
+    /* trigger update of the whole hierarchy,
+     * safe to reset time as "rootobj" never has an animator,
+     * "rootobj's" time is restored within the update */
+    rootobj.time = -1;
+
+    /* drop frame pending render in pipelined mode
+     * as it was updated with previous flags */
+    if (pipe_f != RT_NULL)
+    {
+        pipe_f->pending = 1;
+        pipe_f = RT_NULL;
+    }
+
+    if (pipe != RT_NULL)
+    {
+        pipe->set_opts(opts);
+    }
+
+    return opts;
+}
+
+/*
+ * Get path-tracer mode: 0 - off, n - on (number of frames between updates).
+ */
+rt_si32 rt_Scene::get_pton()
+{
+    return this->pt_on;
+}
+
+/*
+ * Set path-tracer mode: 0 - off, n - on (number of frames between updates).
+ */
+rt_si32 rt_Scene::set_pton(rt_si32 pton)
+{
+    if ((opts & RT_OPTS_PT) == 0) /* if path-tracer is not optimized out */
+    {
+        rt_si32 pt_on = this->pt_on;
+
+        this->pt_on = pton;
+
+        if (this->pt_on && !pt_on)
+        {
+            reset_pseed();
+            reset_color();
+        }
+    }
+
+    return this->pt_on;
+}
+
+/*
+ * Get SIMD-buffers mode for regular frames.
+ */
+rt_si32 rt_Scene::get_buff()
+{
+    return bf_md;
+}
+
+/*
+ * Set SIMD-buffers mode for regular frames: RT_BUFF_OFF - rays are shaded
+ * directly, RT_BUFF_ON - rays are buffered per surface (divergent rays),
+ * RT_BUFF_AUTO - the faster of the two by render times (requires timer).
+ * Path-tracer always uses SIMD-buffers, regular frames never use them
+ * if prohibited by RT_OPTS_BUFFERS.
+ */
+rt_si32 rt_Scene::set_buff(rt_si32 buff)
+{
+    if (buff >= RT_BUFF_OFF && buff <= RT_BUFF_AUTO)
+    {
+        bf_md = buff;
+        bf_fr = 0;
+        bf_tm[0] = 0;
+        bf_tm[1] = 0;
+    }
+
+    if (pipe != RT_NULL)
+    {
+        pipe->set_buff(bf_md);
+    }
+
+    return bf_md;
+}
+
+/*
+ * Get path-tracer's tonemap mode.
+ */
+rt_si32 rt_Scene::get_tone()
+{
+    return tn_on;
+}
+
+/*
+ * Set path-tracer's tonemap mode: RT_TONE_NONE - frame is written
+ * by the backend after each sample (clamp, gamma 2.0 approximation),
+ * others - backend only accumulates samples, the frame is resolved
+ * once per frame by the render threads (exposure, tonemap, sRGB).
+ * Has no effect if path-tracer is optimized out.
+ */
+rt_si32 rt_Scene::set_tone(rt_si32 tone)
+{
+    if ((opts & RT_OPTS_PT) == 0
+    &&  tone >= RT_TONE_NONE && tone <= RT_TONE_FILMIC)
+    {
+        tn_all |= tn_on != tone;
+        tn_on = tone;
+    }
+
+    return tn_on;
+}
+
+/*
+ * Get path-tracer's exposure multiplier for the resolve pass.
+ */
+rt_real rt_Scene::get_expo()
+{
+    return tn_exp;
+}
+
+/*
+ * Set path-tracer's exposure multiplier for the resolve pass (1.0 default),
+ * applied to linear colors before tonemap.
+ */
+rt_real rt_Scene::set_expo(rt_real expo)
+{
+    if (expo > 0.0f)
+    {
+        tn_all |= tn_exp != expo;
+        tn_exp = expo;
+    }
+
+    return tn_exp;
+}
+
+/*
+ * Get path-tracer's base seed for the seed-plane.
+ */
+rt_si32 rt_Scene::get_seed()
+{
+    return pt_sd;
+}
+
+/*
+ * Set path-tracer's base seed for the seed-plane: 1 - default, n > 0.
+ * Processes rendering the same frame with different seeds produce
+ * independent samples, which can be merged with load_accum() later.
+ * Seed-plane is reset if path-tracer is on, colors are kept.
+ */
+rt_si32 rt_Scene::set_seed(rt_si32 seed)
+{
+    if ((opts & RT_OPTS_PT) == 0 && seed > 0)
+    {
+        pt_sd = seed;
+
+        if (pt_on != 0)
+        {
+            reset_pseed();
+        }
+    }
+
+    return pt_sd;
+}
+
+/*
+ * Return adaptive path-tracer's convergence threshold (0 - off).
+ */
+rt_real rt_Scene::get_conv()
+{
+    return cv_thr;
+}
+
+/*
+ * Drop frame pending render in pipelined mode and release per-frame allocs
+ * kept for incremental update before persistent allocs are made,
+ * trigger full update next time.
+ */
+rt_void rt_Scene::drop_pending()
+{
+    rt_si32 i;
+
+    /* frame pending render in pipelined mode is dropped */
+    if (pipe_f == this)
+    {
+        pending = 1;
+        pipe_f = RT_NULL;
+    }
+
+    /* release per-frame allocs kept for incremental update
+     * before persistent allocs, trigger full update next time */
+    if (pending)
+    {
+        pending = 0;
+
+        for (i = 0; i < thnum; i++)
+        {
+            tharr[i]->release(tharr[i]->mpool);
+        }
+
+        release(mpool);
+
+        rootobj.time = -1;
+    }
+}
+
+/*
+ * Set adaptive path-tracer's convergence threshold: 0 - off, "thr" - on.
+ * Tiles stop sampling once their colors' standard error (in display space
+ * if gamma is on) falls below "thr" (after RT_CONV_MIN samples at least),
+ * the frame's sample budget is spread among the tiles left to converge.
+ * Accumulated samples are reset when switching between modes.
+ */
+rt_real rt_Scene::set_conv(rt_real thr)
+{
+    rt_si32 n = tiles_in_row * tiles_in_col;
+
+    if ((opts & RT_OPTS_PT) != 0 || thr < 0.0f)
+    {
+        thr = 0.0f;
+    }
+
+    if (thr > 0.0f && cv_cnt == RT_NULL)
+    {
+        rt_si32 i;
+
+        drop_pending();
+
+        cv_cnt = (rt_real *)alloc(n * sizeof(rt_real), RT_ALIGN);
+        cv_err = (rt_real *)alloc(n * sizeof(rt_real), RT_ALIGN);
+        cv_tmp = (rt_pelm *)alloc(thnum * 3 * (pfm->tile_w * pfm->tile_h << 2)
+                                                * sizeof(rt_pelm), RT_ALIGN);
+
+        for (i = 0; i < n; i++)
+        {
+            cv_cnt[i] = 0.0f;
+            cv_err[i] = RT_INF;
+        }
+    }
+
+    if ((thr > 0.0f) != (cv_thr > 0.0f) && pt_on != 0)
+    {
+        reset_color();
+    }
+
+    cv_thr = thr;
+
+    return cv_thr;
+}
+
+/*
+ * Return number of tiles left to converge in adaptive mode
+ * as of the last frame (0 - converged or mode is off).
+ */
+rt_si32 rt_Scene::get_conv_num()
+{
+    return pt_on != 0 && cv_thr > 0.0f ? cv_num : 0;
+}
+
+/*
+ * Print file "name" from 3-letter prefix "pref", "index" and extension "ext"
+ * in the form of "preXXX.ext" or "preXXX-Y.ext" if "index" >= 1000.
+ */
+static
+rt_void print_name(rt_char *name, rt_pstr pref, rt_pstr ext, rt_si32 index)
+{
+    rt_si32 k = 6;
+
+    memcpy(name, pref, 3);
+
+    /* prepare filename string */
+    name[5] = '0' + (index % 10);
+    index /= 10;
+    name[4] = '0' + (index % 10);
+    index /= 10;
+    name[3] = '0' + (index % 10);
+
+    if (index >= 10)
+    {
+        index /= 10;
+        index -= 1;
+        name[k++] = '-';
+        name[k++] = '0' + (index % 10);
+    }
+
+    strcpy(name + k, ext);
+}
+
+/*
+ * Return per-tile render costs mode.
+ */
+rt_si32 rt_Scene::get_costs()
+{
+    return cost_on;
+}
+
+/*
+ * Set per-tile render costs mode: 0 - off, 1 - on.
+ * Requires platform's timer, otherwise stays off.
+ * When on, threads render (and claim) single tiles.
+ */
+rt_si32 rt_Scene::set_costs(rt_si32 on)
+{
+    rt_si32 n = tiles_in_row * tiles_in_col;
+
+    if (on != 0 && pfm->f_timer == RT_NULL)
+    {
+        on = 0;
+    }
+
+    if (on != 0 && cost_t == RT_NULL)
+    {
+        drop_pending();
+
+        cost_t = (rt_time *)alloc(n * sizeof(rt_time), RT_ALIGN);
+        cost_r = (rt_si32 *)alloc(n * sizeof(rt_si32), RT_ALIGN);
+        cost_l = (rt_si32 *)alloc(n * sizeof(rt_si32), RT_ALIGN);
+        cost_h = (rt_si32 *)alloc(n * sizeof(rt_si32), RT_ALIGN);
+        cost_w = (rt_time *)alloc(thnum * sizeof(rt_time), RT_ALIGN);
+        cost_b = (rt_time *)alloc(thnum * sizeof(rt_time), RT_ALIGN);
+        cost_m = (rt_ui32 *)alloc(x_res * y_res * sizeof(rt_ui32), RT_ALIGN);
+
+        memset(cost_t, 0, n * sizeof(rt_time));
+        memset(cost_r, 0, n * sizeof(rt_si32));
+        memset(cost_l, 0, n * sizeof(rt_si32));
+        memset(cost_h, 0, n * sizeof(rt_si32));
+        memset(cost_w, 0, thnum * sizeof(rt_time));
+        memset(cost_b, 0, thnum * sizeof(rt_time));
+    }
+
+    cost_on = on != 0;
+
+    return cost_on;
+}
+
+/*
+ * Save render costs from the last frame:
+ * per-tile costs to "cstXXX.csv", per-thread times to "thrXXX.csv",
+ * tile time heatmap (blue - green - red) to "cstXXX.bmp".
+ */
+rt_void rt_Scene::save_costs(rt_si32 index)
+{
+    rt_si32 i, j, k, n = tiles_in_row * tiles_in_col;
+    rt_time t_max = 1;
+
+    if (cost_t == RT_NULL)
+    {
+        return;
+    }
+
+    rt_char name[20];
+
+    rt_pstr path = RT_PATH_DUMP;
+    rt_size len = strlen(path);
+    rt_char *fullpath = (rt_char *)alloc(len + 20, 0);
+
+    strcpy(fullpath, path);
+
+    /* save per-tile costs */
+    print_name(name, "cst", ".csv", index);
+    strcpy(fullpath + len, name);
+
+    rt_File ft(fullpath, "w+");
+
+    ft.fprint("tile_x,tile_y,thread,time_ns,rays,list\n");
+
+    for (k = 0; k < n; k++)
+    {
+        ft.fprint("%d,%d,%d,%" PR_Z "d,%d,%d\n",
+                  k % tiles_in_row, k / tiles_in_row, cost_h[k],
+                  cost_t[k], cost_r[k], cost_l[k]);
+
+        t_max = RT_MAX(t_max, cost_t[k]);
+    }
+
+    /* save per-thread times */
+    print_name(name, "thr", ".csv", index);
+    strcpy(fullpath + len, name);
+
+    rt_File fh(fullpath, "w+");
+
+    fh.fprint("thread,wall_ns,busy_ns\n");
+
+    for (k = 0; k < thnum; k++)
+    {
+        fh.fprint("%d,%" PR_Z "d,%" PR_Z "d\n", k, cost_w[k], cost_b[k]);
+    }
+
+    /* release memory for temporary fullpath string,
+     * would also release all allocs made after fullpath */
+    release(fullpath);
+
+    /* prepare heatmap's image */
+    for (j = 0; j < y_res; j++)
+    {
+        for (i = 0; i < x_res; i++)
+        {
+            k = (j / pfm->tile_h) * tiles_in_row + (i / pfm->tile_w);
+
+            rt_si32 v = (rt_si32)(cost_t[k] * 510 / t_max);
+            rt_si32 r = v > 255 ? v - 255 : 0;
+            rt_si32 g = v > 255 ? 510 - v : v;
+            rt_si32 b = v > 255 ? 0 : 255 - v;
+
+            cost_m[j * x_res + i] = (r << 16) | (g << 8) | b;
+        }
+    }
+
+    rt_TEX tex;
+    tex.ptex = cost_m;
+    tex.tex_num = +x_res;
+    tex.x_dim = +x_res;
+    tex.y_dim = -y_res;
+
+    /* save heatmap's image */
+    print_name(name, "cst", ".bmp", index);
+    save_image(this, name, &tex);
+}
+
+/*
+ * Save adaptive path-tracer's convergence map as of the last frame:
+ * per-tile sample counts and errors to "cnvXXX.csv",
+ * tile error heatmap (blue - green - red for 0 - threshold - 2x)
+ * to "cnvXXX.bmp", tiles in red need further samples the most.
+ */
+rt_void rt_Scene::save_conv(rt_si32 index)
+{
+    rt_si32 i, j, k, n = tiles_in_row * tiles_in_col;
+
+    if (pt_on == 0 || cv_thr <= 0.0f)
+    {
+        return;
+    }
+
+    rt_char name[20];
+
+    rt_pstr path = RT_PATH_DUMP;
+    rt_size len = strlen(path);
+    rt_char *fullpath = (rt_char *)alloc(len + 20, 0);
+
+    strcpy(fullpath, path);
+
+    /* save per-tile counts and errors */
+    print_name(name, "cnv", ".csv", index);
+    strcpy(fullpath + len, name);
+
+    rt_File fc(fullpath, "w+");
+
+    fc.fprint("tile_x,tile_y,samples,error\n");
+
+    for (k = 0; k < n; k++)
+    {
+        fc.fprint("%d,%d,%d,%g\n", k % tiles_in_row, k / tiles_in_row,
+                  (rt_si32)cv_cnt[k], cv_err[k]);
+    }
+
+    /* release memory for temporary fullpath string,
+     * would also release all allocs made after fullpath */
+    release(fullpath);
+
+    rt_ui32 *cmap = (rt_ui32 *)alloc(x_res * y_res * sizeof(rt_ui32), RT_ALIGN);
+
+    /* prepare heatmap's image */
+    for (j = 0; j < y_res; j++)
+    {
+        for (i = 0; i < x_res; i++)
+        {
+            k = (j / pfm->tile_h) * tiles_in_row + (i / pfm->tile_w);
+
+            rt_si32 v = (rt_si32)(RT_MIN(cv_err[k] / cv_thr, 2.0f) * 255);
+            rt_si32 r = v > 255 ? v - 255 : 0;
+            rt_si32 g = v > 255 ? 510 - v : v;
+            rt_si32 b = v > 255 ? 0 : 255 - v;
+
+            cmap[j * x_res + i] = (r << 16) | (g << 8) | b;
+        }
+    }
+
+    rt_TEX tex;
+    tex.ptex = cmap;
+    tex.tex_num = +x_res;
+    tex.x_dim = +x_res;
+    tex.y_dim = -y_res;
+
+    /* save heatmap's image */
+    print_name(name, "cnv", ".bmp", index);
+    save_image(this, name, &tex);
+
+    /* release memory for temporary heatmap,
+     * would also release all allocs made after cmap */
+    release(cmap);
+}
+
+/*
+ * Record time elapsed since the last mark for a given "phase",
+ * only set new mark if "phase" is out of range.
+ * Requires platform's timer, otherwise does nothing.
+ */
+rt_void rt_Scene::mark_phase(rt_si32 phase)
+{
+    if (pfm->f_timer == RT_NULL)
+    {
+        return;
+    }
+
+    rt_time t = pfm->f_timer();
+
+    if (phase >= 0 && phase < RT_PHASE_NUM)
+    {
+        phase_t[phase] = t - phase_s;
+    }
+
+    phase_s = t;
+}
+
+/*
+ * Map threaded "phase" to its per-thread slot in profiler's record,
+ * return -1 if the phase is not timed per thread.
+ */
+static
+rt_si32 phase_slot(rt_si32 phase)
+{
+    switch (phase)
+    {
+        case RT_PHASE_UPDATE1:
+        return 0;
+
+        case RT_PHASE_UPDATE2:
+        return 1;
+
+        case RT_PHASE_UPDATE3:
+        return 2;
+
+        case RT_PHASE_RENDER:
+        return RT_PHASE_THR - 1;
+
+        default:
+        return -1;
+    }
+}
+
+/*
+ * Return wall time (in timer's units) of a given "phase" in the last frame,
+ * zero if the phase was skipped or platform's timer is not set.
+ * If thread's "index" is given (>= 0) return its time of the threaded phase
+ * (requires profiler to be on, otherwise zero).
+ */
+rt_time rt_Scene::get_phase(rt_si32 phase, rt_si32 index)
+{
+    if (phase < 0 || phase >= RT_PHASE_NUM)
+    {
+        return 0;
+    }
+
+    /* in pipelined mode the last call rendered one instance
+     * and updated the other (if not flushed) */
+    if (index < 0 && pipe_on && pipe_r != RT_NULL)
+    {
+        rt_Scene *sc = phase == RT_PHASE_RENDER || pipe_f == RT_NULL ?
+                       pipe_r : pipe_f;
+
+        return sc->phase_t[phase];
+    }
+
+    if (index < 0)
+    {
+        return phase_t[phase];
+    }
+
+    rt_si32 k = phase_slot(phase);
+
+    if (k < 0 || index >= thnum || prof_n == 0 || prof_i == 0)
+    {
+        return 0;
+    }
+
+    return prof_t[((prof_i - 1) % prof_n) * (RT_PHASE_NUM
+                + RT_PHASE_THR * thnum) + RT_PHASE_NUM
+                + RT_PHASE_THR * index + k];
+}
+
+/*
+ * Return profiler's ring buffer size in frames, 0 if off.
+ */
+rt_si32 rt_Scene::get_prof()
+{
+    return prof_n;
+}
+
+/*
+ * Set profiler's ring buffer size to "num" last frames, 0 - off.
+ * Requires platform's timer, otherwise stays off.
+ * Recording restarts from an empty ring buffer.
+ */
+rt_si32 rt_Scene::set_prof(rt_si32 num)
+{
+    if (num < 0 || pfm->f_timer == RT_NULL)
+    {
+        num = 0;
+    }
+
+    if (num > prof_m)
+    {
+        drop_pending();
+
+        prof_t = (rt_time *)alloc(num * (RT_PHASE_NUM
+                         + RT_PHASE_THR * thnum) * sizeof(rt_time), RT_ALIGN);
+        prof_m = num;
+    }
+
+    prof_n = num;
+    prof_i = 0;
+
+    return prof_n;
+}
+
+/*
+ * Phase names for profiler's dump.
+ */
+static
+rt_pstr phase_name[RT_PHASE_NUM] =
+{
+    "update0", "update1", "update2", "bounds", "snode", "ssort",
+    "filter", "lsort", "csort", "update3", "tiling", "render",
+};
+
+/*
+ * Save profiler's ring buffer to "prfXXX.csv", oldest frame first:
+ * frame number, per-phase wall times, then per-thread times of
+ * threaded phases (update1, update2, update3, render) for each thread.
+ */
+rt_void rt_Scene::save_prof(rt_si32 index)
+{
+    rt_si32 i, j, k, n = RT_PHASE_NUM + RT_PHASE_THR * thnum;
+
+    if (prof_n == 0)
+    {
+        return;
+    }
+
+    rt_char name[20];
+
+    rt_pstr path = RT_PATH_DUMP;
+    rt_size len = strlen(path);
+    rt_char *fullpath = (rt_char *)alloc(len + 20, 0);
+
+    strcpy(fullpath, path);
+
+    print_name(name, "prf", ".csv", index);
+    strcpy(fullpath + len, name);
+
+    rt_File fp(fullpath, "w+");
+
+    fp.fprint("frame");
+
+    for (j = 0; j < RT_PHASE_NUM; j++)
+    {
+        fp.fprint(",%s_ns", phase_name[j]);
+    }
+    for (k = 0; k < thnum; k++)
+    {
+        fp.fprint(",t%d_update1,t%d_update2,t%d_update3,t%d_render",
+                  k, k, k, k);
+    }
+
+    fp.fprint("\n");
+
+    for (i = RT_MAX(0, prof_i - prof_n); i < prof_i; i++)
+    {
+        rt_time *t = prof_t + (i % prof_n) * n;
+
+        fp.fprint("%d", i);
+
+        for (j = 0; j < n; j++)
+        {
+            fp.fprint(",%" PR_Z "d", t[j]);
+        }
+
+        fp.fprint("\n");
+    }
+
+    /* release memory for temporary fullpath string,
+     * would also release all allocs made after fullpath */
+    release(fullpath);
+}
+
+/*
+ * Return pipelined frames mode.
+ */
+rt_si32 rt_Scene::get_pipe()
+{
+    return pipe_on;
+}
+
+/*
+ * Set pipelined frames mode: 0 - off (renders pending frame), 1 - on.
+ * When on, update of the next frame (in a twin instance on the same scene data)
+ * overlaps render of the current one, frames are rendered one call late.
+ * Regular frames are used when path-tracer or state-logging is on.
+ * Per-tile costs and profiler are recorded for this instance only.
+ */
+rt_si32 rt_Scene::set_pipe(rt_si32 on)
+{
+    if (on != 0 && pipe == RT_NULL)
+    {
+        rt_Scene *cur = pfm->cur;
+        rt_si32 i;
+
+        /* twin gets its own framebuffer (not to clear this one),
+         * then renders to this one, scene data is unlocked for it */
+        scn->lock = RT_NULL;
+        pipe = new(pfm) rt_Scene(scn, x_res, y_res, x_row, RT_NULL, pfm);
+        scn->lock = this;
+
+        /* twin is not in platform's scene list */
+        pfm->del_scene(pipe);
+        pfm->cur = cur;
+
+        pipe->frame = frame;
+
+        for (i = 0; i < thnum; i++)
+        {
+            pipe->tharr[i]->s_inf->frame = frame;
+        }
+
+        pipe->set_opts(opts);
+        pipe->set_buff(bf_md);
+
+        while (pipe->cam_idx != cam_idx)
+        {
+            pipe->next_cam();
+        }
+    }
+
+    if (on == 0 && pipe_f != RT_NULL)
+    {
+        render_pipe(RT_NULL, 0);
+    }
+
+    pipe_on = on != 0;
+
+    return pipe_on;
+}
+
+/*
+ * Return current camera index.
+ */
+rt_si32 rt_Scene::get_cam_idx()
+{
+    return cam_idx;
+}
 
 /*
  * Select next camera in the list, return its index.
@@ -3846,6 +6285,11 @@ rt_si32 rt_Scene::next_cam()
         cam_idx = 0;
     }
 
+    if (pipe != RT_NULL)
+    {
+        pipe->next_cam();
+    }
+
     return cam_idx;
 }
 
@@ -3858,35 +6302,61 @@ rt_ui32* rt_Scene::get_frame()
 }
 
 /*
- * Save current frame to an image.
+ * Set pointer to the framebuffer for subsequent renders, return current one.
+ * New "frame" must keep framebuffer's stride "x_row" and pass the same checks
+ * as in constructor, otherwise it is not accepted and the old one is kept.
+ * Allows frontends to render directly into (multiple) presentation buffers.
  */
-rt_void rt_Scene::save_frame(rt_si32 index)
+rt_ui32* rt_Scene::set_frame(rt_ui32 *frame, rt_si32 x_row)
 {
-    rt_char name[20];
+    rt_si32 i;
 
-    if (index < 1000)
+    if (frame == this->frame || x_row != this->x_row
+    ||  frame_check(frame, x_row, y_res) == 0)
     {
-        strncpy(name, "scrXXX.bmp", 20);
+        return this->frame;
     }
-    else
+
+    /* converged tiles are skipped in adaptive mode,
+     * carry over their contents from the previous frame */
+    if (pt_on != 0 && cv_thr > 0.0f)
     {
-        strncpy(name, "scrXXX-Y.bmp", 20);
+        rt_si32 k = x_row < 0 ? RT_ABS32(x_row) * (y_res - 1) : 0;
+
+        memcpy(frame - k, this->frame - k,
+               RT_ABS32(x_row) * y_res * sizeof(rt_ui32));
     }
 
-    /* prepare filename string */
-    name[5] = '0' + (index % 10);
-    index /= 10;
-    name[4] = '0' + (index % 10);
-    index /= 10;
-    name[3] = '0' + (index % 10);
+    this->frame = frame;
 
-    if (index >= 10)
+    for (i = 0; i < thnum; i++)
     {
-        index /= 10;
-        index -= 1;
-        name[7] = '0' + (index % 10);
+        tharr[i]->s_inf->frame = frame;
+    }
+
+    /* twin renders to this instance's framebuffer */
+    if (pipe != RT_NULL)
+    {
+        pipe->frame = frame;
+
+        for (i = 0; i < thnum; i++)
+        {
+            pipe->tharr[i]->s_inf->frame = frame;
+        }
     }
 
+    return frame;
+}
+
+/*
+ * Save current frame to an image.
+ */
+rt_void rt_Scene::save_frame(rt_si32 index)
+{
+    rt_char name[20];
+
+    print_name(name, "scr", ".bmp", index);
+
     /* prepare frame's image */
     rt_TEX tex;
     tex.ptex = get_frame();
@@ -3898,6 +6368,237 @@ rt_void rt_Scene::save_frame(rt_si32 index)
     save_image(this, name, &tex);
 }
 
+/* path-tracer's accumulation file: signature, version, header size */
+#define RT_ACCUM_SIG        0x41505452 /* "RTPA" */
+#define RT_ACCUM_VER        1
+#define RT_ACCUM_HDR        12
+
+/*
+ * Save path-tracer's accumulation to "accXXX.bin": header, sample count,
+ * per-tile counts and errors (adaptive mode), color-planes and seed-plane.
+ * Data is kept in native format to be loaded by the same build.
+ */
+rt_void rt_Scene::save_accum(rt_si32 index)
+{
+#if RT_EMBED_FILEIO == 0
+    rt_size n = tiles_in_row * tiles_in_col, m = 4 * x_row * y_res;
+
+    if ((opts & RT_OPTS_PT) != 0 || pt_on == 0)
+    {
+        return;
+    }
+
+    rt_si32 hdr[RT_ACCUM_HDR] =
+    {
+        RT_ACCUM_SIG, RT_ACCUM_VER, x_res, y_res, x_row, fsaa,
+        pfm->tile_w, pfm->tile_h, sizeof(rt_pelm), sizeof(rt_elem),
+        cv_thr > 0.0f, 0
+    };
+
+    rt_char name[20];
+
+    rt_pstr path = RT_PATH_DUMP;
+    rt_size len = strlen(path);
+    rt_char *fullpath = (rt_char *)alloc(len + 20, 0);
+
+    strcpy(fullpath, path);
+
+    print_name(name, "acc", ".bin", index);
+    strcpy(fullpath + len, name);
+
+    rt_File fa(fullpath, "wb");
+
+    /* release memory for temporary fullpath string,
+     * would also release all allocs made after fullpath */
+    release(fullpath);
+
+    if (fa.error() != 0
+    ||  fa.save(hdr, sizeof(rt_si32), RT_ACCUM_HDR) != RT_ACCUM_HDR
+    ||  fa.save(&pts_c, sizeof(rt_real), 1) != 1
+    ||  (hdr[10] != 0 && fa.save(cv_cnt, sizeof(rt_real), n) != n)
+    ||  (hdr[10] != 0 && fa.save(cv_err, sizeof(rt_real), n) != n)
+    ||  fa.save(ptr_r, sizeof(rt_pelm), m) != m
+    ||  fa.save(ptr_g, sizeof(rt_pelm), m) != m
+    ||  fa.save(ptr_b, sizeof(rt_pelm), m) != m
+    ||  fa.save(pseed, sizeof(rt_elem), m) != m)
+    {
+        throw rt_Exception("failed to save accumulation");
+    }
+#endif /* RT_EMBED_FILEIO */
+}
+
+/*
+ * Load path-tracer's accumulation from "accXXX.bin" saved by save_accum()
+ * with the same resolution, antialiasing mode and tile size:
+ * merge 0 - replace current samples (resume),
+ * merge 1 - accumulate with current samples weighted by their counts,
+ * current seed-plane is kept (different seeds are required to merge).
+ * Loaded samples are kept on the next update even if the scene changed.
+ * Current samples are left intact if the file is missing, doesn't match
+ * or is truncated.
+ */
+rt_void rt_Scene::load_accum(rt_si32 index, rt_si32 merge)
+{
+#if RT_EMBED_FILEIO == 0
+    rt_size n = tiles_in_row * tiles_in_col, m = 4 * x_row * y_res;
+
+    if ((opts & RT_OPTS_PT) != 0 || pt_on == 0)
+    {
+        throw rt_Exception("path-tracer is off, accumulation not loaded");
+    }
+
+    rt_si32 hdr[RT_ACCUM_HDR];
+    rt_bool cv_on = cv_thr > 0.0f;
+    rt_real c;
+
+    rt_char name[20];
+
+    rt_pstr path = RT_PATH_DUMP;
+    rt_size len = strlen(path);
+    rt_char *fullpath = (rt_char *)alloc(len + 20, 0);
+
+    strcpy(fullpath, path);
+
+    print_name(name, "acc", ".bin", index);
+    strcpy(fullpath + len, name);
+
+    rt_File fa(fullpath, "rb");
+
+    /* release memory for temporary fullpath string,
+     * would also release all allocs made after fullpath */
+    release(fullpath);
+
+    if (fa.error() != 0
+    ||  fa.load(hdr, sizeof(rt_si32), RT_ACCUM_HDR) != RT_ACCUM_HDR
+    ||  fa.load(&c, sizeof(rt_real), 1) != 1)
+    {
+        throw rt_Exception("failed to load accumulation");
+    }
+
+    /* per-tile counts can't be spread over the whole frame */
+    if (hdr[0] != RT_ACCUM_SIG || hdr[1] != RT_ACCUM_VER
+    ||  hdr[2] != x_res || hdr[3] != y_res || hdr[4] != x_row
+    ||  hdr[5] != pfm->fsaa || hdr[6] != pfm->tile_w
+    ||  hdr[7] != pfm->tile_h || hdr[8] != sizeof(rt_pelm)
+    ||  hdr[9] != sizeof(rt_elem) || (hdr[10] != 0 && !cv_on))
+    {
+        throw rt_Exception("accumulation doesn't match the scene");
+    }
+
+    /* check the file holds all planes before current samples are touched:
+     * probe its last byte, then seek back to the first plane */
+    rt_cell k = RT_ACCUM_HDR * sizeof(rt_si32) + sizeof(rt_real);
+    rt_cell e = k + (hdr[10] != 0 ? 2 * n * sizeof(rt_real) : 0)
+                  + 3 * m * sizeof(rt_pelm) + m * sizeof(rt_elem);
+    rt_byte b;
+
+    if (fa.seek(e - 1, SEEK_SET) != 0
+    ||  fa.load(&b, sizeof(rt_byte), 1) != 1
+    ||  fa.seek(k, SEEK_SET) != 0)
+    {
+        throw rt_Exception("accumulation is truncated");
+    }
+
+    /* loaded counts and errors per tile, then one color-plane */
+    rt_real *cnt = (rt_real *)alloc((2 * n + m) * sizeof(rt_real), RT_ALIGN);
+    rt_real *err = cnt + n;
+    rt_pelm *tmp = (rt_pelm *)(err + n);
+
+    rt_pelm *ptr[3] = {ptr_r, ptr_g, ptr_b};
+    rt_real ca, cb, wa, wb;
+    rt_si32 i, j, l, p, t;
+    rt_bool ok = RT_TRUE;
+
+    if (hdr[10] != 0)
+    {
+        ok = fa.load(cnt, sizeof(rt_real), n) == n
+          && fa.load(err, sizeof(rt_real), n) == n;
+    }
+    else
+    {
+        for (t = 0; t < (rt_si32)n; t++)
+        {
+            cnt[t] = c;
+            err[t] = RT_INF;
+        }
+    }
+
+    /* blend color-planes per tile weighted by sample counts,
+     * current samples have zero weight when replaced */
+    for (p = 0; p < 3 && ok; p++)
+    {
+        ok = fa.load(tmp, sizeof(rt_pelm), m) == m;
+
+        for (t = 0; t < (rt_si32)n && ok; t++)
+        {
+            rt_si32 y_beg = (t / tiles_in_row) * pfm->tile_h;
+            rt_si32 y_end = RT_MIN(y_beg + pfm->tile_h, y_res);
+            rt_si32 x_beg = (t % tiles_in_row) * pfm->tile_w;
+            rt_si32 x_end = RT_MIN(x_beg + pfm->tile_w, x_res);
+            rt_si32 x_len = (x_end - x_beg) << pfm->fsaa;
+
+            ca = merge == 0 ? 0.0f : cv_on ? cv_cnt[t] : pts_c;
+            cb = cnt[t];
+            wb = ca + cb > 0.0f ? cb / (ca + cb) : 1.0f;
+            wa = 1.0f - wb;
+
+            for (i = y_beg; i < y_end; i++)
+            {
+                j = (i * x_row + x_beg) << pfm->fsaa;
+
+                for (l = j; l < j + x_len; l++)
+                {
+                    ptr[p][l] = plane_st(plane_ld(ptr[p][l]) * wa
+                                       + plane_ld(tmp[l]) * wb);
+                }
+            }
+        }
+    }
+
+    if (ok && merge == 0)
+    {
+        ok = fa.load(pseed, sizeof(rt_elem), m) == m;
+    }
+
+    if (!ok)
+    {
+        /* release memory for temporary counts and plane,
+         * would also release all allocs made after cnt */
+        release(cnt);
+
+        /* only a read error past the check gets here,
+         * planes partially replaced on resume are reset */
+        if (merge == 0)
+        {
+            reset_color();
+        }
+
+        throw rt_Exception("failed to load accumulation");
+    }
+
+    /* standard errors of independent means combine
+     * as "sqrt(ca^2 * ea^2 + cb^2 * eb^2) / (ca + cb)" */
+    for (t = 0; t < (rt_si32)n && cv_on; t++)
+    {
+        ca = merge == 0 ? 0.0f : cv_cnt[t];
+        cb = cnt[t];
+        wa = ca > 0.0f ? ca * cv_err[t] : 0.0f;
+        wb = cb > 0.0f ? cb * err[t] : 0.0f;
+
+        cv_cnt[t] = ca + cb;
+        cv_err[t] = ca + cb > 0.0f && wa < RT_INF && wb < RT_INF ?
+                    RT_SQRT(wa * wa + wb * wb) / (ca + cb) : RT_INF;
+    }
+
+    pts_c = merge == 0 ? c : pts_c + c;
+    pt_ld = 1;
+
+    /* release memory for temporary counts and plane,
+     * would also release all allocs made after cnt */
+    release(cnt);
+#endif /* RT_EMBED_FILEIO */
+}
+
 /*
  * Return pointer to the platform container.
  */
@@ -3913,6 +6614,12 @@ rt_Scene::~rt_Scene()
 {
     rt_si32 i;
 
+    /* destroy twin first, so that original scene data is restored last */
+    if (pipe != RT_NULL)
+    {
+        delete pipe;
+    }
+
     pfm->del_scene(this);
 
     /* destroy scene threads array */
@@ -31,10 +31,6 @@
 #define RT_THREADS_NUM          120/* number of threads for update and render */
 #endif /* RT_THREADS_NUM */
 
-#ifndef RT_SETAFFINITY
-#define RT_SETAFFINITY          1  /* enables thread-affinity and core-count */
-#endif /* RT_SETAFFINITY */
-
 #define RT_TILE_W               8  /* screen tile width  in pixels (%S == 0) */
 #define RT_TILE_H               8  /* screen tile height in pixels */
 
@@ -58,12 +54,140 @@
 #define RT_FSAA_REGULAR         0 /* makes AA-grid regular if 1 */
 #endif /* RT_FSAA_REGULAR */
 
+/*
+ * Render scheduling modes.
+ */
+#define RT_SCHED_ROWS           0 /* static row-interleave by thread index */
+#define RT_SCHED_TILES          1 /* tile-rows claimed by threads on demand */
+
+#ifndef RT_SCHED_STEP
+#define RT_SCHED_STEP           1 /* number of tile-rows in a single claim */
+#endif /* RT_SCHED_STEP */
+
+/*
+ * Adaptive path-tracer sampling limits.
+ */
+#ifndef RT_CONV_MIN
+#define RT_CONV_MIN             16 /* samples per tile before convergence */
+#endif /* RT_CONV_MIN */
+
+#ifndef RT_CONV_MAX
+#define RT_CONV_MAX             8  /* max multiple of frame's samples/tile */
+#endif /* RT_CONV_MAX */
+
+/*
+ * Path-tracer's tonemap modes, applied in the engine's resolve pass
+ * along with exposure and sRGB transfer (if gamma is on).
+ */
+#define RT_TONE_NONE            0 /* frame is written by the backend */
+#define RT_TONE_CLAMP           1 /* exposure, clamp to 1.0 */
+#define RT_TONE_REINHARD        2 /* exposure, x / (1 + x) */
+#define RT_TONE_FILMIC          3 /* exposure, fitted ACES curve */
+
+#ifndef RT_TONE_CHUNK
+#define RT_TONE_CHUNK           64 /* pixels in a row-chunk of resolve */
+#endif /* RT_TONE_CHUNK */
+
+/*
+ * SIMD-buffers modes for regular frames (path-tracer always uses them),
+ * both backends are built into the same binary and picked per frame.
+ */
+#define RT_BUFF_OFF             0 /* rays are shaded directly (coherent) */
+#define RT_BUFF_ON              1 /* rays are buffered per surface */
+#define RT_BUFF_AUTO            2 /* faster of the two by render times */
+
+#ifndef RT_BUFF_PROBE
+#define RT_BUFF_PROBE           16 /* frames between probes of the other */
+#endif /* RT_BUFF_PROBE */
+
+/*
+ * Mixed-precision (RT_GEOMETRY=64 with RT_ELEMENT=32) rebases the hierarchy
+ * to camera's position snapped to a grid with given cell size (world units),
+ * so that positions in fp32 backend fields stay small near the camera,
+ * 0 - no rebasing (world space is used as is in backend fields).
+ */
+#ifndef RT_REBASE_CELL
+#if RT_GEOMETRY > RT_ELEMENT
+#define RT_REBASE_CELL          256 /* moving origin updates everything */
+#else  /* RT_GEOMETRY */
+#define RT_REBASE_CELL          0
+#endif /* RT_GEOMETRY */
+#endif /* RT_REBASE_CELL */
+
+#ifndef RT_TUNE_FRAMES
+#define RT_TUNE_FRAMES          4 /* timed frames per SIMD target in tune */
+#endif /* RT_TUNE_FRAMES */
+
+/*
+ * Update partitioning modes.
+ */
+#define RT_PARTS_MODULO         0 /* static object-interleave by thread */
+#define RT_PARTS_CHUNKS         1 /* object chunks claimed on demand */
+#define RT_PARTS_COSTS          2 /* ranges weighted by last frame costs */
+
+#ifndef RT_PARTS_STEP
+#define RT_PARTS_STEP           4 /* number of objects in a single claim */
+#endif /* RT_PARTS_STEP */
+
+/*
+ * Frame phases timed by the scene (in order),
+ * sequential phase 2.5 is split into its parts.
+ */
+#define RT_PHASE_UPDATE0        0 /* phase 0.5, arrays' transform matrices */
+#define RT_PHASE_UPDATE1        1 /* 1st phase of multi-threaded update */
+#define RT_PHASE_UPDATE2        2 /* 2nd phase of multi-threaded update */
+#define RT_PHASE_BOUNDS         3 /* phase 2.5, arrays' bounds and BVH */
+#define RT_PHASE_SNODE          4 /* phase 2.5, surfaces' node lists */
+#define RT_PHASE_SSORT          5 /* phase 2.5, global hier/surface lists */
+#define RT_PHASE_FILTER         6 /* phase 2.5, surface list filter/order */
+#define RT_PHASE_LSORT          7 /* phase 2.5, global light/shadow list */
+#define RT_PHASE_CSORT          8 /* camera's surface/node list */
+#define RT_PHASE_UPDATE3        9 /* 3rd phase of multi-threaded update */
+#define RT_PHASE_TILING         10/* screen tiling into tilebuffer */
+#define RT_PHASE_RENDER         11/* multi-threaded render */
+#define RT_PHASE_NUM            12
+
+#define RT_PHASE_THR            4 /* threaded phases timed per thread */
+
+/*
+ * Incremental update levels.
+ */
+#define RT_UPDATE_NONE          0 /* reuse lists and tiles of last frame */
+#define RT_UPDATE_CAMERA        1 /* rebuild camera's list and tiles only */
+#define RT_UPDATE_FULL          2 /* rebuild all per-frame lists */
+
+/*
+ * SAH-built BVH over surfaces (RT_OPTS_BVHSAH).
+ */
+#ifndef RT_BVHSAH_BINS
+#define RT_BVHSAH_BINS          16 /* number of bins for SAH split search */
+#endif /* RT_BVHSAH_BINS */
+
+#ifndef RT_BVHSAH_LEAF
+#define RT_BVHSAH_LEAF          4  /* max number of surfaces in BVH leaf */
+#endif /* RT_BVHSAH_LEAF */
+
+#ifndef RT_BVHSAH_MINS
+#define RT_BVHSAH_MINS          64 /* min number of surfaces to build BVH */
+#endif /* RT_BVHSAH_MINS */
+
+/*
+ * Contiguous backend lists (RT_OPTS_FLATTEN).
+ */
+#ifndef RT_FLATTEN_DEPTH
+#define RT_FLATTEN_DEPTH        64 /* max nesting of sub-lists in a list */
+#endif /* RT_FLATTEN_DEPTH */
+
 /* Classes */
 
 class rt_Platform;
 class rt_SceneThread;
 class rt_Scene;
 
+/* Structures */
+
+struct rt_BVHNODE;
+
 /******************************************************************************/
 /*****************************   MULTI-THREADING   ****************************/
 /******************************************************************************/
@@ -73,6 +197,9 @@ typedef rt_void (*rt_FUNC_TERM)(rt_pntr tdata, rt_si32 thnum);
 typedef rt_void (*rt_FUNC_UPDATE)(rt_pntr tdata, rt_si32 thnum, rt_si32 phase);
 typedef rt_void (*rt_FUNC_RENDER)(rt_pntr tdata, rt_si32 thnum, rt_si32 phase);
 
+/* high-resolution timer in nanoseconds (optional) */
+typedef rt_time (*rt_FUNC_TIMER)();
+
 /*
  * Platform abstraction container.
  */
@@ -86,7 +213,13 @@ class rt_Platform : private rt_LogRedirect, public rt_Heap
     rt_si32             s_mask;
     rt_si32             s_mode;
 
-    /* thread management functions */
+    /* SIMD targets tuned and the fastest
+     * of them per render domain (RT, PT) */
+    rt_si32             t_mask[2];
+    rt_si32             t_mode[2];
+
+    /* thread management functions,
+     * system thread pool is used if not provided */
     rt_FUNC_INIT        f_init;
     rt_FUNC_TERM        f_term;
     rt_FUNC_UPDATE      f_update;
@@ -96,6 +229,9 @@ class rt_Platform : private rt_LogRedirect, public rt_Heap
     rt_si32             thnum;
     rt_pntr             tdata;
 
+    /* platform-specific timer */
+    rt_FUNC_TIMER       f_timer;
+
     /* backend specific structures */
     rt_SIMD_INFOX      *s_inf;
 
@@ -108,6 +244,10 @@ class rt_Platform : private rt_LogRedirect, public rt_Heap
     rt_si32             simd;
     /* current antialiasing mode */
     rt_si32             fsaa;
+    /* current render scheduling mode */
+    rt_si32             sched;
+    /* current update partitioning mode */
+    rt_si32             parts;
     /* single tile dimensions in pixels */
     rt_si32             tile_w;
     rt_si32             tile_h;
@@ -143,10 +283,17 @@ class rt_Platform : private rt_LogRedirect, public rt_Heap
     rt_si32     get_thnum();
     rt_si32     set_thnum(rt_si32 thnum);
 
+    rt_void     set_timer(rt_FUNC_TIMER f_timer);
+
     rt_si32     set_simd(rt_si32 simd);
+    rt_si32     tune_simd(rt_Scene *scn, rt_time time, rt_si32 simd = 0);
     rt_si32     set_fsaa(rt_si32 fsaa);
     rt_si32     get_fsaa_max();
     rt_si32     get_fsaa();
+    rt_si32     set_sched(rt_si32 sched);
+    rt_si32     get_sched();
+    rt_si32     set_parts(rt_si32 parts);
+    rt_si32     get_parts();
     rt_si32     get_tile_w();
 
     rt_Scene*   get_cur_scene();
@@ -157,6 +304,35 @@ class rt_Platform : private rt_LogRedirect, public rt_Heap
     friend      class rt_Scene;
 };
 
+/******************************************************************************/
+/**********************************   BVH   ***********************************/
+/******************************************************************************/
+
+/*
+ * BVH node of the scene's surface hierarchy.
+ * Inner nodes are rendered as bvnode elements in surface lists.
+ */
+struct rt_BVHNODE
+{
+    /* node's bounding box */
+    rt_vec4             bmin;
+    rt_vec4             bmax;
+
+    /* parent node's index or -1 */
+    rt_si32             up;
+    /* number of leaf's surfaces,
+     * 0 for inner nodes */
+    rt_si32             num;
+    /* children node indices for
+     * inner nodes, first surface's
+     * index in "bvh_srf" for leaves */
+    rt_si32             kid[2];
+
+    /* surface SIMD struct,
+     * used for inner nodes */
+    rt_SIMD_SURFACE    *s_bvh;
+};
+
 /******************************************************************************/
 /*********************************   THREAD   *********************************/
 /******************************************************************************/
@@ -192,6 +368,14 @@ class rt_SceneThread : public rt_Heap
      * for temporary per-frame allocs */
     rt_pntr             mpool;
     rt_ui32             msize;
+    /* checkpoint in the heap for
+     * camera-dependent allocs */
+    rt_pntr             cpool;
+
+    /* surface elements picked from the list
+     * by BVH order and their counts per node */
+    rt_ELEM           **bvh_e;
+    rt_si32            *bvh_c;
 
 /*  methods */
 
@@ -201,9 +385,13 @@ class rt_SceneThread : public rt_Heap
 
     rt_ELEM*    insert(rt_Object *obj, rt_ELEM **ptr, rt_ELEM *tem);
 
+    rt_ELEM*    bvnode(rt_si32 n, rt_ELEM *tail);
+
     public:
 
     rt_ELEM*    filter(rt_Object *obj, rt_ELEM **ptr);
+    rt_void     sbvh(rt_ELEM **ptr);
+    rt_void     sflat(rt_ELEM **ptr);
 
     rt_pntr operator new(size_t size, rt_Heap *hp);
     rt_void operator delete(rt_pntr ptr);
@@ -253,16 +441,51 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
     rt_si32             tiles_in_col;
     rt_ELEM           **tiles;
 
-    /* framebuffer's seed-plane for path-tracer */
+    /* framebuffer's seed-plane for path-tracer,
+     * base seed of the plane, sample count,
+     * flag to keep loaded samples on update */
     rt_elem            *pseed;
+    rt_si32             pt_sd;
     rt_real             pts_c;
+    rt_si32             pt_ld;
 
     /* framebuffer's color-planes for path-tracer */
-    rt_real            *ptr_r;
-    rt_real            *ptr_g;
-    rt_real            *ptr_b;
+    rt_pelm            *ptr_r;
+    rt_pelm            *ptr_g;
+    rt_pelm            *ptr_b;
     rt_si32             pt_on;
 
+    /* adaptive path-tracer (optional):
+     * convergence threshold (0 - off),
+     * per-tile sample counts and errors,
+     * tiles left and samples per tile
+     * in current frame, per-thread copy
+     * of tile's colors before sampling */
+    rt_real             cv_thr;
+    rt_real            *cv_cnt;
+    rt_real            *cv_err;
+    rt_si32             cv_num;
+    rt_si32             cv_spt;
+    rt_pelm            *cv_tmp;
+
+    /* path-tracer's resolve pass:
+     * tonemap mode (0 - backend),
+     * exposure, flag to resolve
+     * all tiles in the next frame */
+    rt_si32             tn_on;
+    rt_real             tn_exp;
+    rt_si32             tn_all;
+
+    /* SIMD-buffers for regular frames:
+     * mode (RT_BUFF_*), choice for
+     * current frame, frames counted
+     * and average render time of
+     * each choice in auto mode */
+    rt_si32             bf_md;
+    rt_si32             bf_on;
+    rt_si32             bf_fr;
+    rt_time             bf_tm[2];
+
     /* aspect-ratio and pixel-width */
     rt_real             aspect;
     rt_real             factor;
@@ -276,6 +499,13 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
     rt_ui32             msize;
     /* pending release flag */
     rt_si32             pending;
+    /* checkpoint in the heap for
+     * camera-dependent allocs */
+    rt_pntr             cpool;
+    /* incremental update level and
+     * camera of the last update */
+    rt_si32             uplvl;
+    rt_Camera          *cam_upd;
 
     /* thread management functions */
     rt_FUNC_UPDATE      f_update;
@@ -286,6 +516,69 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
     rt_si32             thnum;
     rt_SceneThread    **tharr;
     rt_pntr             tdata;
+    /* next tile-row to be claimed
+     * by render threads (shared) */
+    volatile
+    rt_si32             tline;
+
+    /* flattened object array for update,
+     * arrays, cameras, lights, then surfaces */
+    rt_si32             obj_num;
+    rt_Object         **oarr;
+    /* next object chunk to be claimed
+     * by update threads (shared) */
+    volatile
+    rt_si32             oline;
+    /* per-surface update costs from
+     * the last frame (clip/light lists)
+     * and per-thread surface ranges */
+    rt_si32            *srf_c;
+    rt_si32            *srf_p;
+
+    /* per-tile render costs (optional):
+     * time, primary rays, list length
+     * and thread index for each tile */
+    rt_si32             cost_on;
+    rt_time            *cost_t;
+    rt_si32            *cost_r;
+    rt_si32            *cost_l;
+    rt_si32            *cost_h;
+    /* per-thread wall and busy time */
+    rt_time            *cost_w;
+    rt_time            *cost_b;
+    /* heatmap image for saving */
+    rt_ui32            *cost_m;
+
+    /* per-phase wall times of the last
+     * frame (if platform has a timer)
+     * and timestamp of the last mark */
+    rt_time             phase_t[RT_PHASE_NUM];
+    rt_time             phase_s;
+
+    /* profiler's ring buffer (optional):
+     * per-phase wall times followed by
+     * per-thread times of threaded phases
+     * for each of the last "prof_n" frames,
+     * its capacity, frames recorded so far
+     * and per-thread part of current frame */
+    rt_si32             prof_n;
+    rt_si32             prof_m;
+    rt_si32             prof_i;
+    rt_time            *prof_t;
+    rt_time            *prof_h;
+
+    /* pipelined frames (optional):
+     * twin instance on the same scene data,
+     * instance with updated frame pending
+     * render, instance rendered last time,
+     * instance updated by the 1st render
+     * thread and time of its next frame */
+    rt_si32             pipe_on;
+    rt_Scene           *pipe;
+    rt_Scene           *pipe_f;
+    rt_Scene           *pipe_r;
+    rt_Scene           *pipe_u;
+    rt_time             pipe_t;
 
     /* global hierarchical list */
     rt_ELEM            *hlist;
@@ -296,6 +589,19 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
     /* camera's surface/node list */
     rt_ELEM            *clist;
 
+    /* SAH-built BVH over surfaces,
+     * its nodes, root node's index,
+     * surfaces in leaves' order and
+     * their leaf node's indices */
+    rt_si32             bvh_num;
+    rt_BVHNODE         *bvh_arr;
+    rt_si32             bvh_top;
+    rt_Surface        **bvh_srf;
+    rt_si32            *bvh_lnd;
+    /* inner nodes' SIMD structs */
+    rt_si32             bvh_nin;
+    rt_SIMD_SURFACE   **bvh_smd;
+
     /* ray-position variables */
     rt_vec4             pos;
     rt_vec4             dir;
@@ -311,6 +617,10 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
     rt_vec4             vtl;
     /* accumulated ambient color */
     rt_vec4             amb;
+    /* hierarchy's origin in world space
+     * and its matrix (see RT_REBASE_CELL) */
+    rt_vec4             rbase;
+    rt_mat4             rbmtx;
 
     /* current antialiasing mode */
     rt_si32             fsaa;
@@ -324,6 +634,21 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
 
     rt_void     reset_pseed();
     rt_void     reset_color();
+    rt_void     conv_save(rt_si32 index, rt_si32 t);
+    rt_real     conv_error(rt_si32 index, rt_si32 t, rt_si32 n);
+    rt_void     resolve(rt_si32 y_beg, rt_si32 y_end, rt_si32 y_inc,
+                        rt_si32 x_beg, rt_si32 x_end);
+
+    rt_void     build_bvh();
+    rt_si32     split_bvh(rt_si32 beg, rt_si32 end, rt_si32 up);
+
+    rt_void     mark_phase(rt_si32 phase);
+    rt_void     drop_pending();
+
+    rt_void     update_frame(rt_time time);
+    rt_void     render_frame();
+    rt_void     finish_frame();
+    rt_void     render_pipe(rt_Scene *upd, rt_time time);
 
     public:
 
@@ -357,10 +682,41 @@ class rt_Scene : private rt_Registry, public rt_List<rt_Scene>
     rt_si32     set_opts(rt_si32 opts);
     rt_si32     get_pton();
     rt_si32     set_pton(rt_si32 pton);
+    rt_si32     get_buff();
+    rt_si32     set_buff(rt_si32 buff);
+
+    rt_real     get_conv();
+    rt_real     set_conv(rt_real thr);
+    rt_si32     get_conv_num();
+    rt_void     save_conv(rt_si32 index);
+
+    rt_si32     get_tone();
+    rt_si32     set_tone(rt_si32 tone);
+    rt_real     get_expo();
+    rt_real     set_expo(rt_real expo);
+
+    rt_si32     get_seed();
+    rt_si32     set_seed(rt_si32 seed);
+    rt_void     save_accum(rt_si32 index);
+    rt_void     load_accum(rt_si32 index, rt_si32 merge);
+
+    rt_si32     get_costs();
+    rt_si32     set_costs(rt_si32 on);
+    rt_void     save_costs(rt_si32 index);
+
+    rt_time     get_phase(rt_si32 phase, rt_si32 index = -1);
+
+    rt_si32     get_prof();
+    rt_si32     set_prof(rt_si32 num);
+    rt_void     save_prof(rt_si32 index);
+
+    rt_si32     get_pipe();
+    rt_si32     set_pipe(rt_si32 on);
 
     rt_si32     get_cam_idx();
     rt_si32     next_cam();
     rt_ui32*    get_frame();
+    rt_ui32*    set_frame(rt_ui32 *frame, rt_si32 x_row);
     rt_void     save_frame(rt_si32 index);
 
     rt_Platform*get_platform();
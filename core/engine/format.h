@@ -42,7 +42,8 @@
 #define RT_OPTS_TILING_EXT1     (1 << 2)
 #define RT_OPTS_FSCALE          (1 << 3)
 #define RT_OPTS_TARRAY          (1 << 4)
-#define RT_OPTS_VARRAY          (1 << 5) /* 6 is reserved for future exts */
+#define RT_OPTS_VARRAY          (1 << 5)
+#define RT_OPTS_REUSE           (1 << 6) /* reuse lists, not in OPTS_FULL */
 #define RT_OPTS_ADJUST          (1 << 7)
 #define RT_OPTS_UPDATE          (1 << 8)
 #define RT_OPTS_RENDER          (1 << 9)
@@ -59,6 +60,8 @@
 
 #define RT_OPTS_GAMMA           (1 << 20) /* turns off Gamma when set to 1 */
 #define RT_OPTS_FRESNEL         (1 << 21) /* turns off Fresnel when set to 1 */
+#define RT_OPTS_BVHSAH          (1 << 22) /* SAH-built BVH over surfaces */
+#define RT_OPTS_FLATTEN         (1 << 23) /* contiguous lists for backend */
 
 #define RT_OPTS_BUFFERS         (0 << 24) /* prohibits SIMD-buffers if 1 */
 #define RT_OPTS_PT              (1 << 25) /* prohibits path-tracer if 1 */
@@ -77,6 +80,8 @@
  * as scene assets need to be reworked to properly support these new features */
 /* bbox sorting (RT_OPTS_INSERT) and hidden surfaces removal (RT_OPTS_REMOVE)
  * optimizations have been turned off for poor scalability with larger scenes */
+/* reuse of last frame's lists (RT_OPTS_REUSE) is opt-in via set_opts(),
+ * it relies on RT_OPTS_UPDATE for objects' changed status to be tracked */
 
 #define RT_OPTS_NONE            (                                           \
         RT_OPTS_GAMMA           |                                           \
@@ -104,6 +109,8 @@
         RT_OPTS_INSERT_EXT1     |                                           \
         RT_OPTS_INSERT_EXT2     |                                           \
         RT_OPTS_REMOVE          |                                           \
+        RT_OPTS_BVHSAH          |                                           \
+        RT_OPTS_FLATTEN         |                                           \
         RT_OPTS_GAMMA           |                                           \
         RT_OPTS_FRESNEL         |                                           \
         RT_OPTS_BUFFERS         |                                           \
@@ -219,6 +226,7 @@ struct rt_COL
 /******************************************************************************/
 
 #define RT_TEX_PCOLOR                       0   /* plain-color,     XRGB */
+#define RT_TEX_BCOLOR                       1   /* block-color,  4x4 RGB565 */
 
 #define RT_TEX_HDR_PCOLOR                   10  /* plain-color,     XRGB */
 
@@ -256,6 +264,18 @@ struct rt_COL
     RT_ARR_SIZE(**ptex),    RT_ARR_SIZE(*ptex)                              \
 }
 
+/* bind array of 64-bit blocks [y_dim/4][x_dim/4][2], each holding
+ * two RGB565 end-colors in the 1st word (low, high) and 4x4 2-bit
+ * indices in the 2nd word (row-major from bit 0), index "i" selects
+ * end-colors' mix (3-i)/3 : i/3, data is 8x smaller than XRGB */
+#define RT_TEX_BIND_4X4(tag, ptex)                                          \
+{                                                                           \
+    RT_TEX_##tag,           RT_COL(0x0),                                    \
+   *ptex,                   0,                                              \
+    RT_NULL,                0,                                              \
+    RT_ARR_SIZE(**ptex)*4,  RT_ARR_SIZE(*ptex)*4                            \
+}
+
 #define RT_TEX_ARRAY(parr)                                                  \
 {/* using generic array tag here */                                         \
     RT_TAG_ARRAY,           RT_COL(0x0),                                    \
@@ -310,6 +330,16 @@ struct rt_TEXTURE
 
 #define RT_MAT(tag)                         RT_MAT_##tag
 
+#define RT_FLT_NEAREST                      0
+#define RT_FLT_BILINEAR                     1 /* from mip-chain */
+
+#define RT_FLT(tag)                         RT_FLT_##tag
+
+#define RT_LAY_LINEAR                       0
+#define RT_LAY_TILED                        1 /* 4x4-texel tiles */
+
+#define RT_LAY(tag)                         RT_LAY_##tag
+
 struct rt_MATERIAL
 {
     rt_si32             tag;
@@ -317,6 +347,9 @@ struct rt_MATERIAL
 
     rt_real             lgt[4];
     rt_real             prp[4];
+
+    rt_si32             flt; /* texture filtering, nearest if omitted */
+    rt_si32             lay; /* texture layout, row-major if omitted */
 };
 
 struct rt_SIDE
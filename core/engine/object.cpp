@@ -2562,7 +2562,7 @@ rt_void rt_Surface::invert_minmax(rt_vec4 smin, rt_vec4 smax, /* src */
     rt_vec4 tmin, tmax; /* tmp */
 
     rt_vec4  zro = {0.0f, 0.0f, 0.0f, 0.0f};
-    rt_real *pps = trnode == this ? zro : pos;
+    rt_geom *pps = trnode == this ? zro : pos;
 
     tmin[RT_X] = smin[RT_X] == -RT_INF ? -RT_INF : smin[RT_X] - pps[RT_X];
     tmin[RT_Y] = smin[RT_Y] == -RT_INF ? -RT_INF : smin[RT_Y] - pps[RT_Y];
@@ -2603,7 +2603,7 @@ rt_void rt_Surface::direct_minmax(rt_vec4 smin, rt_vec4 smax, /* src */
     rt_vec4 tmin, tmax; /* tmp */
 
     rt_vec4  zro = {0.0f, 0.0f, 0.0f, 0.0f};
-    rt_real *pps = trnode == this ? zro : pos;
+    rt_geom *pps = trnode == this ? zro : pos;
 
     tmin[mp_i] = sgn[RT_I] > 0 ? +smin[RT_I] : -smax[RT_I];
     tmin[mp_j] = sgn[RT_J] > 0 ? +smin[RT_J] : -smax[RT_J];
@@ -2640,8 +2640,8 @@ rt_void rt_Surface::recalc_minmax(rt_vec4 smin, rt_vec4 smax,  /* src */
     rt_vec4 tmin, tmax;
     rt_vec4 lmin, lmax;
 
-    rt_real *pmin = RT_NULL;
-    rt_real *pmax = RT_NULL;
+    rt_geom *pmin = RT_NULL;
+    rt_geom *pmax = RT_NULL;
 
     /* accumulate bbox adjustments into cbox */
     if (smin != RT_NULL && smax != RT_NULL
@@ -2858,7 +2858,7 @@ rt_void rt_Surface::update_bounds()
     s_srf->max_t[RT_Z] = shape->cmax[RT_Z] == +RT_INF ? 0 : 1;
 
     rt_vec4  zro = {0.0f, 0.0f, 0.0f, 0.0f};
-    rt_real *pps = trnode == this ? zro : pos;
+    rt_geom *pps = trnode == this ? zro : pos;
 
     RT_SIMD_SET(s_srf->min_x, shape->bmin[RT_X] - pps[RT_X]);
     RT_SIMD_SET(s_srf->min_y, shape->bmin[RT_Y] - pps[RT_Y]);
@@ -2937,7 +2937,8 @@ rt_void rt_Plane::update_fields()
     isc[RT_V] = 1.0f / asc[RT_V];
 
     rt_si32 *map;
-    rt_real *scl, *pos;
+    rt_real *scl;
+    rt_geom *pos;
     rt_SIMD_MATERIAL *s_mat;
 
     map = outer->map;
@@ -4008,9 +4009,166 @@ rt_Texture::rt_Texture(rt_Registry *rg, rt_pstr name) :
 
     this->name = name;
 
+    pmip = RT_NULL;
+    lmax = 0;
+    tflt = RT_FLT_NEAREST;
+    tlay = RT_LAY_LINEAR;
+
     load_image(rg, name, &tex);
 }
 
+/*
+ * Texel index within given level of derived texture.
+ */
+#define RT_TEX_INDEX(x, y, x_lg2)                                           \
+        (tlay == RT_LAY_TILED ? RT_TEX_TILED(x, y, x_lg2) :                 \
+                                ((y) << (x_lg2)) + (x))
+
+/*
+ * Size of texture data in bytes.
+ */
+#define RT_TEX_BYTES(tx)                                                    \
+        ((tx)->tag == RT_TEX_BCOLOR ? (tx)->x_dim * (tx)->y_dim / 2 :       \
+                                      (tx)->x_dim * (tx)->y_dim * 4)
+
+/*
+ * Instantiate derived texture data for given filtering and layout.
+ * Mip-chain's each next level is box-filtered from the previous one
+ * at half the size, averaging is done in linear space if "lin" is set.
+ * In tiled layout each level is stored in 4x4 tiles, thus the chain
+ * stops at 4 texels in the smallest dimension.
+ * Block-compressed data is 4x4-tiled by construction, its chain is built
+ * from decompressed texels, then next levels are compressed back.
+ */
+rt_Texture::rt_Texture(rt_Registry *rg, rt_TEX *tx,
+                       rt_si32 flt, rt_si32 lay, rt_bool lin) :
+
+    rt_List<rt_Texture>(rg->get_tex())
+{
+    rg->put_tex(this);
+
+    this->name = RT_NULL;
+    this->tex  = *tx;
+
+    tflt = flt;
+    tlay = lay;
+
+    rt_si32 x_dim = tx->x_dim;
+    rt_si32 y_dim = tx->y_dim;
+    rt_si32 x_lg2 = 0;
+    rt_si32 n = x_dim * y_dim;
+    rt_si32 m = lay == RT_LAY_TILED ? 4 : 1;
+
+    while (x_dim >>= 1)
+    {
+        x_lg2++;
+    }
+
+    x_dim = tx->x_dim;
+
+    lmax = 0;
+    while (flt == RT_FLT_BILINEAR && x_dim > m && y_dim > m)
+    {
+        x_dim >>= 1;
+        y_dim >>= 1;
+        n += x_dim * y_dim;
+        lmax++;
+    }
+
+    rt_ui32 *blk = RT_NULL;
+
+    if (tx->tag == RT_TEX_BCOLOR)
+    {
+        blk = (rt_ui32 *)rg->alloc(n / 2, RT_ALIGN);
+    }
+
+    rt_ui32 *src = (rt_ui32 *)rg->alloc(n * 4, RT_ALIGN);
+    pmip = src;
+
+    /* tiled data as row-major 4-texel wide image */
+    rt_TEX tex = *tx;
+    tex.x_dim = 4;
+    tex.y_dim = tx->x_dim * tx->y_dim / 4;
+
+    if (blk != RT_NULL)
+    {
+        decompress_image(&tex, src);
+    }
+    else
+    if (lay == RT_LAY_TILED)
+    {
+        swizzle_image(tx, src);
+    }
+    else
+    {
+        memcpy(src, tx->ptex, tx->x_dim * tx->y_dim * 4);
+    }
+
+    x_dim = tx->x_dim;
+    y_dim = tx->y_dim;
+
+    rt_si32 i, j, k, l, x, y;
+
+    for (l = 0; l < lmax; l++, x_lg2--)
+    {
+        rt_ui32 *dst = src + x_dim * y_dim;
+
+        for (y = 0; y < y_dim / 2; y++)
+        {
+            for (x = 0; x < x_dim / 2; x++)
+            {
+                rt_ui32 q[4] =
+                {
+                    src[RT_TEX_INDEX(x * 2 + 0, y * 2 + 0, x_lg2)],
+                    src[RT_TEX_INDEX(x * 2 + 1, y * 2 + 0, x_lg2)],
+                    src[RT_TEX_INDEX(x * 2 + 0, y * 2 + 1, x_lg2)],
+                    src[RT_TEX_INDEX(x * 2 + 1, y * 2 + 1, x_lg2)],
+                };
+                rt_ui32 c = 0;
+
+                /* alpha channel (top byte) is always averaged as is */
+                for (k = 0; k < 32; k += 8)
+                {
+                    rt_bool g = lin && k < 24;
+                    rt_real s = 0.0f;
+
+                    for (i = 0; i < 4; i++)
+                    {
+                        j = (q[i] >> k) & 0xFF;
+                        s += g ? (rt_real)(j * j) : (rt_real)j;
+                    }
+
+                    s *= 0.25f;
+                    s  = g ? RT_SQRT(s) : s;
+
+                    c |= (rt_ui32)(s + 0.5f) << k;
+                }
+
+                dst[RT_TEX_INDEX(x, y, x_lg2 - 1)] = c;
+            }
+        }
+
+        src = dst;
+        x_dim >>= 1;
+        y_dim >>= 1;
+    }
+
+    if (blk != RT_NULL)
+    {
+        /* level 0 is kept as is to avoid recompression */
+        memcpy(blk, tx->ptex, tx->x_dim * tx->y_dim / 2);
+
+        tex.ptex  = (rt_ui32 *)pmip + tx->x_dim * tx->y_dim;
+        tex.y_dim = (n - tx->x_dim * tx->y_dim) / 4;
+        compress_image(&tex, blk + tx->x_dim * tx->y_dim / 8);
+
+        /* release memory for temporary uncompressed chain,
+         * would also release all allocs made after pmip */
+        rg->release(pmip);
+        pmip = blk;
+    }
+}
+
 /*
  * Deinitialize texture.
  */
@@ -4051,11 +4209,12 @@ rt_Material::rt_Material(rt_Registry *rg, rt_SIDE *sd, rt_MATERIAL *mat) :
 
     rt_TEX *tx = &mat->tex;
     otx.x_dim = otx.y_dim = -1;
+    mip = RT_NULL;
 
     /* save original texture data */
     if ((tx->x_dim == 0 && tx->y_dim == 0)
 #if (RT_POINTER - RT_ADDRESS) != 0
-    || (rt_full)tx->ptex >= (rt_full)(0x80000000 - tx->x_dim * tx->y_dim * 4)
+    || (rt_full)tx->ptex >= (rt_full)(0x80000000 - RT_TEX_BYTES(tx))
 #endif /* (RT_POINTER - RT_ADDRESS) */
        )
     {
@@ -4152,6 +4311,68 @@ rt_Material::rt_Material(rt_Registry *rg, rt_SIDE *sd, rt_MATERIAL *mat) :
     s_mat->yshft[0] = x_lg2;
 
     s_mat->tex_p[0] = tx->ptex;
+    RT_SIMD_SET(s_mat->t_flt, 0);
+    RT_SIMD_SET(s_mat->t_lay, 0);
+    RT_SIMD_SET(s_mat->t_blk, 0);
+
+    if (tx->tag == RT_TEX_BCOLOR)
+    {
+        RT_SIMD_SET(s_mat->t_lay, 1);
+        RT_SIMD_SET(s_mat->lay_m, (rt_elem)3);
+
+        RT_SIMD_SET(s_mat->t_blk, 1);
+        RT_SIMD_SET(s_mat->blk_t, (rt_elem)60);
+        RT_SIMD_SET(s_mat->blk_w, (rt_elem)4);
+        RT_SIMD_SET(s_mat->blk_i, (rt_elem)3);
+        RT_SIMD_SET(s_mat->blk_f, 1.0f / 3.0f);
+        RT_SIMD_SET(s_mat->blk_r, (rt_elem)31);
+        RT_SIMD_SET(s_mat->blk_g, (rt_elem)63);
+        RT_SIMD_SET(s_mat->rcp_r, 1.0f / 31.0f);
+        RT_SIMD_SET(s_mat->rcp_g, 1.0f / 63.0f);
+    }
+
+    if (mip != RT_NULL && mip->tlay == RT_LAY_TILED)
+    {
+        RT_SIMD_SET(s_mat->t_lay, 1);
+        RT_SIMD_SET(s_mat->lay_m, (rt_elem)3);
+
+        s_mat->tex_p[0] = mip->pmip;
+    }
+
+    if (mip != RT_NULL && mip->tflt == RT_FLT_BILINEAR)
+    {
+        rt_si32 y_dim = tx->y_dim;
+        rt_si32 y_lg2 = 0;
+        while (y_dim >>= 1)
+        {
+            y_lg2++;
+        }
+
+        /* offset of level "l" in the chain is the sum of
+         * (1 << (x_lg2 + y_lg2 - 2 * i)) for all i < l,
+         * backend recovers it from MIP_P by clearing
+         * bits below (x_lg2 + y_lg2 - 2 * l + 1) */
+        rt_si32 n = x_lg2 + y_lg2;
+        rt_ui32 mip_p = 0;
+        for (i = 0; i < mip->lmax; i++)
+        {
+            mip_p |= 1 << (n - 2 * i);
+        }
+
+        rt_real lod_t = RT_MAX(RT_FABS(scl[RT_X]), RT_FABS(scl[RT_Y]));
+
+        RT_SIMD_SET(s_mat->t_flt, 1);
+        RT_SIMD_SET(s_mat->lod_t, lod_t * lod_t);
+        RT_SIMD_SET(s_mat->mip_1, 1.0f);
+        RT_SIMD_SET(s_mat->mip_t, (rt_real)(1 << 2 * mip->lmax));
+        RT_SIMD_SET(s_mat->mip_h, 0.5f);
+        RT_SIMD_SET(s_mat->mip_x, x_lg2);
+        RT_SIMD_SET(s_mat->mip_c, RT_ELEMENT - 1 - n);
+        RT_SIMD_SET(s_mat->mip_p, mip_p);
+
+        s_mat->tex_p[0] = mip->pmip;
+    }
+
     RT_SIMD_SET(s_mat->gpc10, (rt_real)RT_PI);
     RT_SIMD_SET(s_mat->clamp, (rt_real)255);
     RT_SIMD_SET(s_mat->cmask, (rt_elem)255);
@@ -4207,7 +4428,7 @@ rt_void rt_Material::resolve_texture(rt_Registry *rg)
          * and check if requested texture already exists */
         for (tex = rg->get_tex(); tex != RT_NULL; tex = tex->next)
         {
-            if (strcmp(name, tex->name) == 0)
+            if (tex->name != RT_NULL && strcmp(name, tex->name) == 0)
             {
                 break;
             }
@@ -4221,6 +4442,40 @@ rt_void rt_Material::resolve_texture(rt_Registry *rg)
         *tx = tex->tex;
     }
 
+    /* mip-chain is requested for texture filtering
+     * and/or tiled layout is requested for texture data,
+     * built once per texture data (before relocation),
+     * block-compressed data is already in tiled layout */
+    rt_si32 flt = tx->x_dim > 1 && tx->y_dim > 1 ?
+                  mat->flt : RT_FLT_NEAREST;
+    rt_si32 lay = tx->x_dim > 3 && tx->y_dim > 3 ?
+                  mat->lay : RT_LAY_LINEAR;
+
+    lay = tx->tag == RT_TEX_BCOLOR ? RT_LAY_TILED : lay;
+
+    if (flt != RT_FLT_NEAREST
+    || (lay != RT_LAY_LINEAR && tx->tag != RT_TEX_BCOLOR))
+    {
+        rt_Texture *tex = RT_NULL;
+
+        for (tex = rg->get_tex(); tex != RT_NULL; tex = tex->next)
+        {
+            if (tex->pmip != RT_NULL && tex->tex.ptex == tx->ptex
+            &&  tex->tflt == flt && tex->tlay == lay)
+            {
+                break;
+            }
+        }
+
+        if (tex == RT_NULL)
+        {
+            tex = new(rg) rt_Texture(rg, tx, flt, lay,
+                                    (rg->opts & RT_OPTS_GAMMA) == 0);
+        }
+
+        mip = tex;
+    }
+
     /* texture bind doesn't need extra validation
      * except for allowed address range for backend */
 #if (RT_POINTER - RT_ADDRESS) != 0 && RT_DEBUG >= 2
@@ -4231,14 +4486,14 @@ rt_void rt_Material::resolve_texture(rt_Registry *rg)
 
 #if (RT_POINTER - RT_ADDRESS) != 0
 
-    if ((rt_full)tx->ptex >= (rt_full)(0x80000000 - tx->x_dim * tx->y_dim * 4))
+    if ((rt_full)tx->ptex >= (rt_full)(0x80000000 - RT_TEX_BYTES(tx)))
     {
-        rt_pntr pnew = rg->alloc(tx->x_dim * tx->y_dim * 4, RT_ALIGN);
-        memcpy(pnew, tx->ptex, tx->x_dim * tx->y_dim * 4);
+        rt_pntr pnew = rg->alloc(RT_TEX_BYTES(tx), RT_ALIGN);
+        memcpy(pnew, tx->ptex, RT_TEX_BYTES(tx));
         tx->ptex = pnew;
     }
 
-    if ((rt_full)tx->ptex >= (rt_full)(0x80000000 - tx->x_dim * tx->y_dim * 4))
+    if ((rt_full)tx->ptex >= (rt_full)(0x80000000 - RT_TEX_BYTES(tx)))
     {
         throw rt_Exception("address exceeded allowed range in material");
     }
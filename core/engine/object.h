@@ -237,7 +237,7 @@ class rt_Object
     /* transform matrices */
     rt_mat4             inv;
     rt_mat4             mtx;
-    rt_real            *pos;
+    rt_geom            *pos;
 
     /* non-zero if object itself or
      * some of its parents changed */
@@ -325,9 +325,9 @@ class rt_Camera : public rt_Object, public rt_List<rt_Camera>
     rt_CAMERA          *cam;
 
     /* orientation basis in world space */
-    rt_real            *hor; /* cam's X axis (left-to-right) */
-    rt_real            *ver; /* cam's Y axis (top-to-bottom) */
-    rt_real            *nrm; /* cam's Z axis (outwards) */
+    rt_geom            *hor; /* cam's X axis (left-to-right) */
+    rt_geom            *ver; /* cam's Y axis (top-to-bottom) */
+    rt_geom            *nrm; /* cam's Z axis (outwards) */
 
     /* distance from point of view to screen plane */
     rt_real             pov;
@@ -559,6 +559,10 @@ class rt_Surface : public rt_Node, public rt_List<rt_Surface>
      * prepared for rendering */
     rt_ELEM            *tls;
 
+    /* index in scene's BVH order,
+     * -1 if not in BVH's leaves */
+    rt_si32             bvh_i;
+
     /* surface shape extension to
      * bounding box and volume */
     rt_SHAPE           *shape;
@@ -981,6 +985,16 @@ class rt_Texture : public rt_List<rt_Texture>
     rt_TEX              tex;
     rt_pstr             name;
 
+    /* box-filtered mip-chain,
+     * levels follow each other */
+    rt_pntr             pmip;
+    rt_si32             lmax;
+
+    /* filtering and layout
+     * of derived texture data */
+    rt_si32             tflt;
+    rt_si32             tlay;
+
 /*  methods */
 
     public:
@@ -989,6 +1003,8 @@ class rt_Texture : public rt_List<rt_Texture>
     rt_void operator delete(rt_pntr ptr);
 
     rt_Texture(rt_Registry *rg, rt_pstr name);
+    rt_Texture(rt_Registry *rg, rt_TEX *tx,
+               rt_si32 flt, rt_si32 lay, rt_bool lin);
 
     virtual
    ~rt_Texture();
@@ -1006,6 +1022,8 @@ class rt_Material : public rt_List<rt_Material>
     rt_MATERIAL        *mat;
     /* original texture data */
     rt_TEX              otx;
+    /* mip-chain for filtering */
+    rt_Texture         *mip;
 
     rt_mat2             mtx;
 
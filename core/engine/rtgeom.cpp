@@ -43,7 +43,7 @@ rt_mat4 iden4 =
  * Check if given address ranges overlap.
  */
 static
-rt_bool in_range(rt_real *p1, rt_size n1, rt_real *p2, rt_size n2)
+rt_bool in_range(rt_geom *p1, rt_size n1, rt_geom *p2, rt_size n2)
 {
     if ((p1 >= p2 && p1 < p2 + n2) || (p2 >= p1 && p2 < p1 + n1))
     {
@@ -144,9 +144,9 @@ rt_void matrix_from_transform(rt_mat4 mp, rt_TRANSFORM3D *t1, rt_bool as)
         0.0f,       0.0f,       0.0f,       1.0f,
     };
 
-    rt_real pos_x = t1->pos[RT_X];
-    rt_real pos_y = t1->pos[RT_Y];
-    rt_real pos_z = t1->pos[RT_Z];
+    rt_geom pos_x = t1->pos[RT_X];
+    rt_geom pos_y = t1->pos[RT_Y];
+    rt_geom pos_z = t1->pos[RT_Z];
     rt_mat4 ps =
     {
         1.0f,       0.0f,       0.0f,       0.0f,
@@ -166,21 +166,21 @@ rt_void matrix_from_transform(rt_mat4 mp, rt_TRANSFORM3D *t1, rt_bool as)
  */
 rt_void matrix_inverse(rt_mat4 mp, rt_mat4 m1)
 {
-    memset(mp, 0, sizeof(rt_real) * 16);
+    memset(mp, 0, sizeof(rt_mat4));
 
-    rt_real a = m1[1][1] * m1[2][2] - m1[2][1] * m1[1][2];
-    rt_real b = m1[2][1] * m1[0][2] - m1[0][1] * m1[2][2];
-    rt_real c = m1[0][1] * m1[1][2] - m1[1][1] * m1[0][2];
+    rt_geom a = m1[1][1] * m1[2][2] - m1[2][1] * m1[1][2];
+    rt_geom b = m1[2][1] * m1[0][2] - m1[0][1] * m1[2][2];
+    rt_geom c = m1[0][1] * m1[1][2] - m1[1][1] * m1[0][2];
 
-    rt_real d = m1[2][0] * m1[1][2] - m1[1][0] * m1[2][2];
-    rt_real e = m1[0][0] * m1[2][2] - m1[2][0] * m1[0][2];
-    rt_real f = m1[0][2] * m1[1][0] - m1[0][0] * m1[1][2];
+    rt_geom d = m1[2][0] * m1[1][2] - m1[1][0] * m1[2][2];
+    rt_geom e = m1[0][0] * m1[2][2] - m1[2][0] * m1[0][2];
+    rt_geom f = m1[0][2] * m1[1][0] - m1[0][0] * m1[1][2];
 
-    rt_real g = m1[1][0] * m1[2][1] - m1[2][0] * m1[1][1];
-    rt_real h = m1[2][0] * m1[0][1] - m1[0][0] * m1[2][1];
-    rt_real l = m1[0][0] * m1[1][1] - m1[1][0] * m1[0][1];
+    rt_geom g = m1[1][0] * m1[2][1] - m1[2][0] * m1[1][1];
+    rt_geom h = m1[2][0] * m1[0][1] - m1[0][0] * m1[2][1];
+    rt_geom l = m1[0][0] * m1[1][1] - m1[1][0] * m1[0][1];
 
-    rt_real q = 1.0f / (m1[0][0] * a + m1[1][0] * b + m1[2][0] * c);
+    rt_geom q = 1.0f / (m1[0][0] * a + m1[1][0] * b + m1[2][0] * c);
 
     mp[0][0] = a * q;
     mp[0][1] = b * q;
@@ -315,7 +315,7 @@ rt_si32 vert_face(rt_vec4 p0, rt_vec4 p1, rt_si32 th,
                   rt_vec4 q0, rt_vec4 q1, rt_vec4 q2,
                   rt_si32 qk, rt_si32 qi, rt_si32 qj)
 {
-    rt_real d, s, t, u, v;
+    rt_geom d, s, t, u, v;
 
     /* check if face is an axis-aligned quad,
      * "qk, qi, qj" hold world axes indices
@@ -450,7 +450,7 @@ rt_si32 edge_edge(rt_vec4 p0, rt_si32 th,
                   rt_vec4 p1, rt_vec4 p2, rt_si32 pk,
                   rt_vec4 q1, rt_vec4 q2, rt_si32 qk)
 {
-    rt_real d, s, t, u, v;
+    rt_geom d, s, t, u, v;
 
     /* check if both edges are axis-aligned,
      * "pk, qk" hold world axes indices
@@ -743,7 +743,7 @@ rt_si32 clip_conc(rt_SHAPE *srf)
     rt_si32 c = 0;
 
     rt_vec4  zro = {0.0f, 0.0f, 0.0f, 0.0f};
-    rt_real *pps = srf->trnode == srf ? zro : srf->pos;
+    rt_geom *pps = srf->trnode == srf ? zro : srf->pos;
     rt_si32 mp_k = srf->map[RT_K];
 
     if ((srf->tag == RT_TAG_CONE
@@ -772,10 +772,10 @@ rt_si32 clip_conc(rt_SHAPE *srf)
  *   new pos
  */
 static
-rt_real *node_tran(rt_BOUND *obj, rt_vec4 pos, rt_vec4 loc)
+rt_geom *node_tran(rt_BOUND *obj, rt_vec4 pos, rt_vec4 loc)
 {
     rt_vec4  dff;
-    rt_real *pps = pos;
+    rt_geom *pps = pos;
 
     if (obj->trnode != RT_NULL)
     {
@@ -806,7 +806,7 @@ rt_si32 surf_cbox(rt_SHAPE *srf, rt_vec4 pos)
     /* transform "pos" to "srf's" trnode sub-world space,
      * where cbox is defined */
     rt_vec4  loc;
-    rt_real *pps = node_tran(srf, pos, loc);
+    rt_geom *pps = node_tran(srf, pos, loc);
 
     /* margin is applied to "pps"
      * as cmin/cmax might be infinite */
@@ -852,7 +852,7 @@ rt_si32 node_bbox(rt_BOUND *obj, rt_vec4 pos)
     /* transform "pos" to "obj's" trnode sub-world space,
      * where bbox is defined */
     rt_vec4  loc;
-    rt_real *pps = node_tran(obj, pos, loc);
+    rt_geom *pps = node_tran(obj, pos, loc);
 
     /* margin is applied to "pps"
      * for consistency with "surf_cbox" */
@@ -895,7 +895,7 @@ rt_si32 surf_side(rt_SHAPE *srf, rt_vec4 pos)
 {
     /* transform "pos" to "srf's" trnode sub-world space */
     rt_vec4  loc;
-    rt_real *pps = node_tran(srf, pos, loc);
+    rt_geom *pps = node_tran(srf, pos, loc);
 
     /* translate "pos" to "srf's" local space */
     if (srf->trnode != srf)
@@ -903,7 +903,7 @@ rt_si32 surf_side(rt_SHAPE *srf, rt_vec4 pos)
         RT_VEC3_SUB(loc, pps, srf->pos);
     }
 
-    rt_real d;
+    rt_geom d;
 
     /* surface's axis maping (trivial transform)
      * is contained in "sci", "scj", "sck" fields */
@@ -913,8 +913,8 @@ rt_si32 surf_side(rt_SHAPE *srf, rt_vec4 pos)
     }
     else
     {
-        rt_real dcj = RT_VEC3_DOT(loc, srf->scj);
-        rt_real dci = loc[RT_X] * loc[RT_X] * srf->sci[RT_X]
+        rt_geom dcj = RT_VEC3_DOT(loc, srf->scj);
+        rt_geom dci = loc[RT_X] * loc[RT_X] * srf->sci[RT_X]
                     + loc[RT_Y] * loc[RT_Y] * srf->sci[RT_Y]
                     + loc[RT_Z] * loc[RT_Z] * srf->sci[RT_Z];
         d = dci - dcj - srf->sci[RT_W];
@@ -1009,7 +1009,7 @@ rt_si32 bbox_shad(rt_BOUND *obj, rt_BOUND *nd1, rt_BOUND *nd2)
         return 1; /* TODO: attempt to check shadow for boundless nodes */
     }
 
-    rt_real *pps = obj->mid;
+    rt_geom *pps = obj->mid;
     rt_si32 i, j, k;
 
     /* check if "nd1" and "nd2" is SURFACE
@@ -1180,7 +1180,7 @@ rt_si32 bbox_flag(rt_si32 *map, rt_si32 flm)
  *   * - convex mask
  */
 static
-rt_si32 bbox_conv(rt_BOUND *obj, rt_real *pos)
+rt_si32 bbox_conv(rt_BOUND *obj, rt_geom *pos)
 {
     if (obj->fln == 0)
     {
@@ -1198,7 +1198,7 @@ rt_si32 bbox_conv(rt_BOUND *obj, rt_real *pos)
     /* transform "pos" to "obj's" trnode sub-world space,
      * where bbox is defined */
     rt_vec4  loc;
-    rt_real *pps = node_tran(obj, pos, loc);
+    rt_geom *pps = node_tran(obj, pos, loc);
 
     rt_si32 i, flm = 0;
 
@@ -1249,7 +1249,7 @@ rt_si32 bbox_sort(rt_BOUND *obj, rt_BOUND *nd1, rt_BOUND *nd2)
         return 8|1; /* TODO: attempt to sort boundless nodes */
     }
 
-    rt_real *pps = obj->mid;
+    rt_geom *pps = obj->mid;
     rt_si32 i, j, k, m, n, p, q, r = 0, s, t, u = 8, f = 0, c = 0, d;
     rt_si32 m1 = 0, m2 = 0;
 
@@ -263,7 +263,7 @@ struct rt_BOUND
     rt_mat4            *pinv;
     rt_mat4            *pmtx;
     /* host object's position */
-    rt_real            *pos;
+    rt_geom            *pos;
 
     /* runtime optimization flags */
     rt_si32            *opts;
@@ -68,6 +68,7 @@ rt_void load_image(rt_Heap *hp, rt_pstr name, rt_TEX *tx)
     rt_si32 bwidth, bheight;
     rt_ui16 bdepth, bplanes, bsig;
 
+    tx->tag = RT_TEX_PCOLOR;
     tx->ptex = RT_NULL;
     tx->x_dim = 0;
     tx->y_dim = 0;
@@ -360,9 +361,11 @@ rt_void save_image(rt_Heap *hp, rt_pstr name, rt_TEX *tx)
 }
 
 /*
- * Convert image from file to C static array initializer format.
+ * Convert image from file to C static array initializer format,
+ * if "tag" is RT_TEX_BCOLOR image is compressed into 4x4-blocks
+ * and saved as array of [y_dim/4][x_dim/4][2] with "_bc" suffix.
  */
-rt_si32 convert_image(rt_Heap *hp, rt_pstr name)
+rt_si32 convert_image(rt_Heap *hp, rt_pstr name, rt_si32 tag)
 {
 #if RT_EMBED_FILEIO == 0
     rt_ui32 *p = RT_NULL;
@@ -370,13 +373,21 @@ rt_si32 convert_image(rt_Heap *hp, rt_pstr name)
 
     rt_pstr path = RT_PATH_TEXTURES;
     rt_size len = strlen(path), dot = len;
-    rt_char *fullpath = (rt_char *)hp->alloc(len + strlen(name) + 3, 0);
+    rt_char *fullpath = (rt_char *)hp->alloc(len + strlen(name) + 6, 0);
 
     strcpy(fullpath, path);
     strcpy(fullpath + len, name);
 
     while (fullpath[dot] != 0 && fullpath[dot] != '.') dot++;
 
+    if (tag == RT_TEX_BCOLOR)
+    {
+        fullpath[dot + 0] = '_';
+        fullpath[dot + 1] = 'b';
+        fullpath[dot + 2] = 'c';
+        dot += 3;
+    }
+
     fullpath[dot + 0] = '.';
     fullpath[dot + 1] = 'h';
     fullpath[dot + 2] =  0;
@@ -404,13 +415,37 @@ rt_si32 convert_image(rt_Heap *hp, rt_pstr name)
 
         fullpath[dot] = 0;
 
-        f->fprint("rt_ui32 dt_%s[%d][%d] =\n", &fullpath[len],
-                                               tx->y_dim, tx->x_dim);
-        f->fprint("{");
+        if (tag == RT_TEX_BCOLOR)
+        {
+            if (tx->x_dim % 4 != 0 || tx->y_dim % 4 != 0)
+            {
+                break;
+            }
 
-        n = tx->x_dim * tx->y_dim;
+            n = tx->x_dim * tx->y_dim / 8;
+            p = (rt_ui32 *)hp->alloc(n * sizeof(rt_ui32), RT_ALIGN);
+            if (p == RT_NULL)
+            {
+                break;
+            }
 
-        for (i = 0, p = (rt_ui32 *)tx->ptex; i < n; i++, p++)
+            compress_image(tx, p);
+
+            f->fprint("rt_ui32 dt_%s[%d][%d][2] =\n", &fullpath[len],
+                      tx->y_dim / 4, tx->x_dim / 4);
+        }
+        else
+        {
+            n = tx->x_dim * tx->y_dim;
+            p = (rt_ui32 *)tx->ptex;
+
+            f->fprint("rt_ui32 dt_%s[%d][%d] =\n", &fullpath[len],
+                                                   tx->y_dim, tx->x_dim);
+        }
+
+        f->fprint("{");
+
+        for (i = 0; i < n; i++, p++)
         {
             if (i % 6 == 0)
             {
@@ -439,6 +474,210 @@ rt_si32 convert_image(rt_Heap *hp, rt_pstr name)
 #endif /* RT_EMBED_FILEIO */
 }
 
+/*
+ * Reorder image from row-major to 4x4-tiled layout in given memory,
+ * both dimensions must be powers of 2 not less than 4.
+ */
+rt_void swizzle_image(rt_TEX *tx, rt_pntr ptex)
+{
+    rt_ui32 *src = (rt_ui32 *)tx->ptex;
+    rt_ui32 *dst = (rt_ui32 *)ptex;
+    rt_si32 x, y, x_dim = tx->x_dim, x_lg2 = 0;
+
+    while (x_dim >>= 1)
+    {
+        x_lg2++;
+    }
+
+    for (y = 0; y < tx->y_dim; y++)
+    {
+        for (x = 0; x < tx->x_dim; x++, src++)
+        {
+            dst[RT_TEX_TILED(x, y, x_lg2)] = *src;
+        }
+    }
+}
+
+/*
+ * Compress one 4x4-block of texels with given stride into 2 words,
+ * end-colors are taken at the extremes of texels' principal axis
+ * (found with a few power iterations), then quantized to RGB565,
+ * each texel picks the nearest of the 4 interpolated colors.
+ */
+static
+rt_void compress_block(rt_ui32 *src, rt_si32 stride, rt_ui32 *dst)
+{
+    rt_real c[16][3], m[3] = {0.0f, 0.0f, 0.0f}, v[6];
+    rt_real a[3] = {1.0f, 1.0f, 1.0f}, e[2][3], t, s;
+    rt_si32 i, j, k, q[2][3];
+
+    for (i = 0; i < 16; i++)
+    {
+        rt_ui32 p = src[(i >> 2) * stride + (i & 3)];
+
+        c[i][0] = (rt_real)((p >> 0x10) & 0xFF);
+        c[i][1] = (rt_real)((p >> 0x08) & 0xFF);
+        c[i][2] = (rt_real)((p >> 0x00) & 0xFF);
+
+        for (k = 0; k < 3; k++)
+        {
+            m[k] += c[i][k] * (1.0f / 16.0f);
+        }
+    }
+
+    /* covariance matrix (symmetric, upper part) */
+    for (k = 0; k < 6; k++)
+    {
+        v[k] = 0.0f;
+    }
+
+    for (i = 0; i < 16; i++)
+    {
+        rt_real d0 = c[i][0] - m[0];
+        rt_real d1 = c[i][1] - m[1];
+        rt_real d2 = c[i][2] - m[2];
+
+        v[0] += d0 * d0;
+        v[1] += d0 * d1;
+        v[2] += d0 * d2;
+        v[3] += d1 * d1;
+        v[4] += d1 * d2;
+        v[5] += d2 * d2;
+    }
+
+    for (j = 0; j < 8; j++)
+    {
+        rt_real b0 = v[0] * a[0] + v[1] * a[1] + v[2] * a[2];
+        rt_real b1 = v[1] * a[0] + v[3] * a[1] + v[4] * a[2];
+        rt_real b2 = v[2] * a[0] + v[4] * a[1] + v[5] * a[2];
+
+        s = RT_MAX(RT_FABS(b0), RT_MAX(RT_FABS(b1), RT_FABS(b2)));
+
+        if (s == 0.0f)
+        {
+            break;
+        }
+
+        a[0] = b0 / s;
+        a[1] = b1 / s;
+        a[2] = b2 / s;
+    }
+
+    /* extremes of projections onto principal axis */
+    s = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+    rt_real pmin = 0.0f, pmax = 0.0f;
+
+    for (i = 0; i < 16; i++)
+    {
+        t = ((c[i][0] - m[0]) * a[0] +
+             (c[i][1] - m[1]) * a[1] +
+             (c[i][2] - m[2]) * a[2]) / s;
+
+        pmin = RT_MIN(pmin, t);
+        pmax = RT_MAX(pmax, t);
+    }
+
+    for (k = 0; k < 3; k++)
+    {
+        rt_si32 r = k == 1 ? 63 : 31;
+
+        t = RT_MIN(RT_MAX(m[k] + a[k] * pmin, 0.0f), 255.0f);
+        q[0][k] = (rt_si32)(t * r / 255.0f + 0.5f);
+
+        t = RT_MIN(RT_MAX(m[k] + a[k] * pmax, 0.0f), 255.0f);
+        q[1][k] = (rt_si32)(t * r / 255.0f + 0.5f);
+
+        e[0][k] = q[0][k] * 255.0f / r;
+        e[1][k] = q[1][k] * 255.0f / r;
+    }
+
+    dst[0] = (rt_ui32)((q[0][0] << 11) | (q[0][1] << 5) | q[0][2]) << 0x00 |
+             (rt_ui32)((q[1][0] << 11) | (q[1][1] << 5) | q[1][2]) << 0x10;
+    dst[1] = 0;
+
+    for (i = 0; i < 16; i++)
+    {
+        rt_real dmin = RT_INF;
+        rt_si32 imin = 0;
+
+        for (j = 0; j < 4; j++)
+        {
+            rt_real d = 0.0f;
+
+            for (k = 0; k < 3; k++)
+            {
+                t = (e[0][k] * (3 - j) + e[1][k] * j) / 3.0f - c[i][k];
+                d += t * t;
+            }
+
+            if (d < dmin)
+            {
+                dmin = d;
+                imin = j;
+            }
+        }
+
+        dst[1] |= (rt_ui32)imin << (i * 2);
+    }
+}
+
+/*
+ * Compress image from row-major XRGB layout into 64-bit blocks
+ * of 4x4 texels (RT_TEX_BCOLOR) in given memory,
+ * both dimensions must be multiples of 4.
+ */
+rt_void compress_image(rt_TEX *tx, rt_pntr ptex)
+{
+    rt_ui32 *src = (rt_ui32 *)tx->ptex;
+    rt_ui32 *dst = (rt_ui32 *)ptex;
+    rt_si32 x, y;
+
+    for (y = 0; y < tx->y_dim; y += 4)
+    {
+        for (x = 0; x < tx->x_dim; x += 4, dst += 2)
+        {
+            compress_block(src + y * tx->x_dim + x, tx->x_dim, dst);
+        }
+    }
+}
+
+/*
+ * Decompress image from 64-bit blocks of 4x4 texels (RT_TEX_BCOLOR)
+ * into row-major XRGB layout in given memory,
+ * both dimensions must be multiples of 4.
+ */
+rt_void decompress_image(rt_TEX *tx, rt_pntr ptex)
+{
+    rt_ui32 *src = (rt_ui32 *)tx->ptex;
+    rt_ui32 *dst = (rt_ui32 *)ptex;
+    rt_si32 i, j, k, x, y;
+
+    for (y = 0; y < tx->y_dim; y += 4)
+    {
+        for (x = 0; x < tx->x_dim; x += 4, src += 2)
+        {
+            for (i = 0; i < 16; i++)
+            {
+                rt_ui32 c = 0;
+                j = (src[1] >> (i * 2)) & 3;
+
+                for (k = 0; k < 3; k++)
+                {
+                    rt_si32 r = k == 1 ? 63 : 31;
+                    rt_si32 s = k == 0 ? 11 : k == 1 ? 5 : 0;
+                    rt_si32 c0 = (src[0] >> (s + 0x00)) & r;
+                    rt_si32 c1 = (src[0] >> (s + 0x10)) & r;
+                    rt_real t = (c0 * (3 - j) + c1 * j) * 255.0f / (3 * r);
+
+                    c |= (rt_ui32)(t + 0.5f) << (0x10 - k * 0x08);
+                }
+
+                dst[(y + (i >> 2)) * tx->x_dim + x + (i & 3)] = c;
+            }
+        }
+    }
+}
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/
@@ -32,6 +32,15 @@
 
 #define RT_PATH_TEXTURES        RT_PATH_TOSTR(RT_PATH)"data/textures/"
 
+/*
+ * Texel index within 4x4-tiled image layout, where each tile (64 bytes)
+ * is stored contiguously and tiles follow each other in row-major order,
+ * "x" and "y" are texel coords, "x_lg2" is log2 of image width.
+ */
+#define RT_TEX_TILED(x, y, x_lg2)                                           \
+        ((((y) & ~3) << (x_lg2)) + (((y) & 3) << 2) +                       \
+         (((x) & ~3) << 2) + ((x) & 3))
+
 /******************************************************************************/
 /********************************   TEXTURE   *********************************/
 /******************************************************************************/
@@ -47,9 +56,30 @@ rt_void load_image(rt_Heap *hp, rt_pstr name, rt_TEX *tx);
 rt_void save_image(rt_Heap *hp, rt_pstr name, rt_TEX *tx);
 
 /*
- * Convert image from file to C static array initializer format.
+ * Convert image from file to C static array initializer format,
+ * if "tag" is RT_TEX_BCOLOR image is compressed into 4x4-blocks.
+ */
+rt_si32 convert_image(rt_Heap *hp, rt_pstr name, rt_si32 tag);
+
+/*
+ * Reorder image from row-major to 4x4-tiled layout in given memory,
+ * both dimensions must be powers of 2 not less than 4.
+ */
+rt_void swizzle_image(rt_TEX *tx, rt_pntr ptex);
+
+/*
+ * Compress image from row-major XRGB layout into 64-bit blocks
+ * of 4x4 texels (RT_TEX_BCOLOR) in given memory,
+ * both dimensions must be multiples of 4.
+ */
+rt_void compress_image(rt_TEX *tx, rt_pntr ptex);
+
+/*
+ * Decompress image from 64-bit blocks of 4x4 texels (RT_TEX_BCOLOR)
+ * into row-major XRGB layout in given memory,
+ * both dimensions must be multiples of 4.
  */
-rt_si32 convert_image(rt_Heap *hp, rt_pstr name);
+rt_void decompress_image(rt_TEX *tx, rt_pntr ptex);
 
 #endif /* RT_RTIMAG_H */
 
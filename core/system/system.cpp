@@ -18,7 +18,8 @@
  * system.cpp: Implementation of the system layer.
  *
  * System layer of the engine responsible for file I/O operations,
- * fast linear memory heap allocations, error and info logging
+ * fast linear memory heap allocations, error and info logging,
+ * thread pool for multi-threaded update and render
  * as well as definitions of List template and Exception classes.
  */
 
@@ -153,6 +154,15 @@ rt_Heap::rt_Heap(rt_FUNC_ALLOC f_alloc, rt_FUNC_FREE f_free)
     /* init heap */
     head = RT_NULL;
     obj_head = RT_NULL;
+
+    free_head = RT_NULL;
+    hwm_mode = RT_FALSE;
+
+    peak = 0;
+
+    num_alloc = 0;
+    num_free = 0;
+
     chunk_alloc(0, RT_ALIGN);
 }
 
@@ -166,7 +176,30 @@ rt_void rt_Heap::chunk_alloc(rt_size size, rt_ui32 align)
     rt_size mask = align > 0 ? align - 1 : 0;
     rt_size real_size = size + mask + sizeof(rt_CHUNK) + (RT_CHUNK_SIZE - 1);
     real_size = (real_size / RT_CHUNK_SIZE) * RT_CHUNK_SIZE;
-    rt_CHUNK *chunk = (rt_CHUNK *)f_alloc(real_size);
+    rt_CHUNK *chunk, **ptr = &free_head;
+
+    /* search the list of retained chunks */
+    while (*ptr != RT_NULL && (*ptr)->size < real_size)
+    {
+        ptr = &(*ptr)->next;
+    }
+
+    if (*ptr != RT_NULL)
+    {
+        chunk = *ptr;
+       *ptr = chunk->next; /* remove chunk from the list */
+
+        real_size = chunk->size;
+    }
+    else
+    {
+        /* retained chunks are too small,
+         * free them before a bigger one is allocated */
+        chunk_trim();
+
+        chunk = (rt_CHUNK *)f_alloc(real_size);
+        num_alloc++;
+    }
 
     /* check for out of memory */
     if (chunk == RT_NULL)
@@ -184,6 +217,20 @@ rt_void rt_Heap::chunk_alloc(rt_size size, rt_ui32 align)
     head = chunk;
 }
 
+/*
+ * Free all chunks retained in high-water-mark mode.
+ */
+rt_void rt_Heap::chunk_trim()
+{
+    while (free_head != RT_NULL)
+    {
+        rt_CHUNK *chunk = free_head->next;
+        f_free(free_head, free_head->size);
+        num_free++;
+        free_head = chunk;
+    }
+}
+
 /*
  * Reserve given "size" bytes of memory with given "align",
  * move heap pointer ahead for the next alloc.
@@ -228,6 +275,25 @@ rt_pntr rt_Heap::reserve(rt_size size, rt_ui32 align)
  */
 rt_pntr rt_Heap::release(rt_pntr ptr)
 {
+    rt_CHUNK *chunk;
+    rt_size size;
+
+    /* measure bytes used past "ptr" for pre-sizing next reserve,
+     * including chunks allocated afterwards, keep the maximum
+     * as releases of inner checkpoints measure only their part */
+    for (size = 0, chunk = head; chunk != RT_NULL; chunk = chunk->next)
+    {
+        if (ptr >= chunk + 1 && ptr < chunk->end)
+        {
+            size += chunk->ptr - (rt_byte *)ptr;
+            break;
+        }
+
+        size += chunk->ptr - (rt_byte *)(chunk + 1);
+    }
+
+    peak = RT_MAX(peak, size);
+
     /* search chunk where "ptr" belongs,
      * free chunks allocated afterwards */
     while (head != RT_NULL && (ptr < head + 1 || ptr >= head->end))
@@ -249,9 +315,19 @@ rt_pntr rt_Heap::release(rt_pntr ptr)
             obj = (rt_pntr *)*obj;
         }
 
-        /* release chunk */
-        rt_CHUNK *chunk = head->next;
-        f_free(head, head->size);
+        /* release chunk,
+         * retain it in high-water-mark mode */
+        chunk = head->next;
+        if (hwm_mode)
+        {
+            head->next = free_head;
+            free_head = head;
+        }
+        else
+        {
+            f_free(head, head->size);
+            num_free++;
+        }
         head = chunk;
     }
 
@@ -353,6 +429,45 @@ rt_pntr rt_Heap::obj_free(rt_pntr ptr)
     return RT_NULL;
 }
 
+/*
+ * Turn high-water-mark mode on or off,
+ * chunks retained so far are freed and peak is reset when turned off.
+ */
+rt_void rt_Heap::set_hwm(rt_bool hwm_mode)
+{
+    this->hwm_mode = hwm_mode;
+
+    if (!hwm_mode)
+    {
+        chunk_trim();
+        peak = 0;
+    }
+}
+
+/*
+ * Get max number of bytes used past a checkpoint across releases.
+ */
+rt_size rt_Heap::get_peak()
+{
+    return peak;
+}
+
+/*
+ * Get number of chunks allocated from the system.
+ */
+rt_si32 rt_Heap::get_allocs()
+{
+    return num_alloc;
+}
+
+/*
+ * Get number of chunks freed back to the system.
+ */
+rt_si32 rt_Heap::get_frees()
+{
+    return num_free;
+}
+
 /*
  * Deinitialize heap.
  */
@@ -372,6 +487,9 @@ rt_Heap::~rt_Heap()
         f_free(head, head->size);
         head = chunk;
     }
+
+    /* free all retained chunks */
+    chunk_trim();
 }
 
 /******************************************************************************/
@@ -418,6 +536,789 @@ rt_void print_err(rt_pstr format, ...)
 rt_FUNC_PRINT_LOG   f_print_log = print_log;
 rt_FUNC_PRINT_ERR   f_print_err = print_err;
 
+/******************************************************************************/
+/*******************************   THREAD POOL   ******************************/
+/******************************************************************************/
+
+#if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
+
+#include <windows.h>
+
+/* OS-specific worker-thread */
+struct rt_POOL_THREAD
+{
+    rt_ThreadPool      *pool;
+    rt_si32             index;
+    HANDLE              pthr;
+};
+
+/* OS-specific threads and parking,
+ * workers park on a pair of manual-reset events swapped with each wake-up,
+ * main thread on an auto-reset event, stray wake-ups are harmless
+ * as both re-check their condition */
+struct rt_POOL_OSD
+{
+    rt_POOL_THREAD     *thread;
+    CRITICAL_SECTION    mutex;
+    rt_si32             windex;
+    HANDLE              wevent[2];
+    HANDLE              mevent;
+};
+
+static
+rt_void pool_init(rt_POOL_OSD *osd)
+{
+    InitializeCriticalSection(&osd->mutex);
+    osd->windex = 0;
+    osd->wevent[0] = CreateEvent(NULL, TRUE, FALSE, NULL);
+    osd->wevent[1] = CreateEvent(NULL, TRUE, FALSE, NULL);
+    osd->mevent = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    if (osd->wevent[0] == NULL || osd->wevent[1] == NULL
+    ||  osd->mevent == NULL)
+    {
+        throw rt_Exception("failed to create events in thread pool");
+    }
+}
+
+static
+rt_void pool_done(rt_POOL_OSD *osd)
+{
+    CloseHandle(osd->mevent);
+    CloseHandle(osd->wevent[1]);
+    CloseHandle(osd->wevent[0]);
+    DeleteCriticalSection(&osd->mutex);
+}
+
+static
+rt_void pool_lock(rt_POOL_OSD *osd)
+{
+    EnterCriticalSection(&osd->mutex);
+}
+
+static
+rt_void pool_unlock(rt_POOL_OSD *osd)
+{
+    LeaveCriticalSection(&osd->mutex);
+}
+
+/*
+ * Park on "k" (0 - worker, 1 - main), called and returns with lock held.
+ */
+static
+rt_void pool_wait(rt_POOL_OSD *osd, rt_si32 k)
+{
+    HANDLE event = k == 0 ? osd->wevent[osd->windex] : osd->mevent;
+
+    LeaveCriticalSection(&osd->mutex);
+    WaitForSingleObject(event, INFINITE);
+    EnterCriticalSection(&osd->mutex);
+}
+
+/*
+ * Wake up threads parked on "k" (0 - all workers, 1 - main), lock held.
+ */
+static
+rt_void pool_wake(rt_POOL_OSD *osd, rt_si32 k)
+{
+    if (k == 0)
+    {
+        /* set event releases all workers parked on it, the other one
+         * is reset for the next wake-up (its workers were released) */
+        ResetEvent(osd->wevent[1 - osd->windex]);
+        SetEvent(osd->wevent[osd->windex]);
+        osd->windex = 1 - osd->windex;
+    }
+    else
+    {
+        SetEvent(osd->mevent);
+    }
+}
+
+static
+rt_void pool_pause()
+{
+    YieldProcessor();
+}
+
+static
+DWORD WINAPI pool_entry(LPVOID p)
+{
+    rt_POOL_THREAD *thread = (rt_POOL_THREAD *)p;
+
+    thread->pool->work(thread->index);
+
+    return 0;
+}
+
+static
+rt_void pool_start(rt_POOL_THREAD *thread)
+{
+    thread->pthr = CreateThread(NULL, 0, pool_entry, thread, 0, NULL);
+
+    if (thread->pthr == NULL)
+    {
+        throw rt_Exception("failed to create worker-thread in thread pool");
+    }
+}
+
+static
+rt_void pool_join(rt_POOL_THREAD *thread)
+{
+    WaitForSingleObject(thread->pthr, INFINITE);
+    CloseHandle(thread->pthr);
+}
+
+/* cores per processor group and number of groups,
+ * core index is (group * RT_POOL_GRPW + core within group) */
+#define RT_POOL_GRPW    ((rt_si32)sizeof(KAFFINITY) * 8)
+
+#if (_WIN32_WINNT >= 0x0601) /* Windows 7 or newer */
+#define RT_POOL_GRPN    32
+#else /* Windows XP, Vista */
+#define RT_POOL_GRPN    1
+#endif /* Windows 7 or newer */
+
+#define RT_POOL_CPUS    (RT_POOL_GRPW * RT_POOL_GRPN)
+
+/*
+ * Fill "cpu" array (if not NULL) with indices of cores available
+ * to the process ordered by NUMA node. On Windows 7 or newer cores
+ * of all processor groups are used, otherwise only the process's group.
+ * Return number of cores.
+ */
+static
+rt_si32 pool_cpus(rt_si32 *cpu)
+{
+    rt_si32 i, n = 0;
+
+#if RT_SETAFFINITY
+
+    KAFFINITY done[RT_POOL_GRPN], pam[RT_POOL_GRPN];
+    rt_si32 g, gnum = 1;
+
+#if (_WIN32_WINNT >= 0x0601) /* Windows 7 or newer */
+
+    gnum = RT_MIN(GetActiveProcessorGroupCount(), RT_POOL_GRPN);
+
+    for (g = 0; g < gnum; g++)
+    {
+        i = GetActiveProcessorCount((WORD)g);
+        pam[g] = i >= RT_POOL_GRPW ? ~(KAFFINITY)0 : ((KAFFINITY)1 << i) - 1;
+        done[g] = 0;
+    }
+
+#else /* Windows XP, Vista */
+
+    DWORD_PTR am, sam;
+
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &am, &sam))
+    {
+        SYSTEM_INFO si;
+        GetSystemInfo(&si);
+        return RT_MAX(1, (rt_si32)si.dwNumberOfProcessors);
+    }
+
+    pam[0] = (KAFFINITY)am;
+    done[0] = 0;
+
+#endif /* Windows 7 or newer */
+
+    ULONG node, hn = 0;
+    GetNumaHighestNodeNumber(&hn);
+
+    for (node = 0; node <= hn + 1; node++)
+    {
+        /* remaining cores after last node */
+        KAFFINITY nm = ~(KAFFINITY)0;
+        rt_si32 ng = -1;
+
+        if (node <= hn)
+        {
+#if (_WIN32_WINNT >= 0x0601) /* Windows 7 or newer */
+            GROUP_AFFINITY ga;
+            if (!GetNumaNodeProcessorMaskEx((USHORT)node, &ga))
+            {
+                continue;
+            }
+            nm = ga.Mask;
+            ng = ga.Group;
+#else /* Windows XP, Vista */
+            ULONGLONG mask;
+            if (!GetNumaNodeProcessorMask((UCHAR)node, &mask))
+            {
+                continue;
+            }
+            nm = (KAFFINITY)mask;
+            ng = 0;
+#endif /* Windows 7 or newer */
+        }
+
+        for (g = 0; g < gnum; g++)
+        {
+            if (ng >= 0 && ng != g)
+            {
+                continue;
+            }
+
+            for (i = 0; i < RT_POOL_GRPW; i++)
+            {
+                KAFFINITY m = (KAFFINITY)1 << i;
+
+                if ((pam[g] & m) && (nm & m) && !(done[g] & m))
+                {
+                    if (cpu != RT_NULL)
+                    {
+                        cpu[n] = g * RT_POOL_GRPW + i;
+                    }
+                    done[g] |= m;
+                    n++;
+                }
+            }
+        }
+    }
+
+#else /* RT_SETAFFINITY */
+
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    n = RT_MAX(1, (rt_si32)si.dwNumberOfProcessors);
+
+    for (i = 0; cpu != RT_NULL && i < n; i++)
+    {
+        cpu[i] = i;
+    }
+
+#endif /* RT_SETAFFINITY */
+
+    return n;
+}
+
+static
+rt_void pool_pin(rt_POOL_THREAD *thread, rt_si32 cpu)
+{
+#if RT_SETAFFINITY
+#if (_WIN32_WINNT >= 0x0601) /* Windows 7 or newer */
+    GROUP_AFFINITY ga;
+    ga.Mask = (KAFFINITY)1 << (cpu % RT_POOL_GRPW);
+    ga.Group = (WORD)(cpu / RT_POOL_GRPW);
+    ga.Reserved[0] = ga.Reserved[1] = ga.Reserved[2] = 0;
+    SetThreadGroupAffinity(thread->pthr, &ga, NULL);
+#else /* Windows XP, Vista */
+    SetThreadAffinityMask(thread->pthr, (DWORD_PTR)1 << cpu);
+#endif /* Windows 7 or newer */
+#endif /* RT_SETAFFINITY */
+}
+
+#else /* --- Linux, GCC -------------------------------------------------- */
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/* OS-specific worker-thread */
+struct rt_POOL_THREAD
+{
+    rt_ThreadPool      *pool;
+    rt_si32             index;
+    pthread_t           pthr;
+};
+
+/* OS-specific threads and parking,
+ * workers park on condition (0), main thread on condition (1) */
+struct rt_POOL_OSD
+{
+    rt_POOL_THREAD     *thread;
+    pthread_mutex_t     mutex;
+    pthread_cond_t      cond[2];
+};
+
+static
+rt_void pool_init(rt_POOL_OSD *osd)
+{
+    pthread_mutex_init(&osd->mutex, NULL);
+    pthread_cond_init(&osd->cond[0], NULL);
+    pthread_cond_init(&osd->cond[1], NULL);
+}
+
+static
+rt_void pool_done(rt_POOL_OSD *osd)
+{
+    pthread_cond_destroy(&osd->cond[1]);
+    pthread_cond_destroy(&osd->cond[0]);
+    pthread_mutex_destroy(&osd->mutex);
+}
+
+static
+rt_void pool_lock(rt_POOL_OSD *osd)
+{
+    pthread_mutex_lock(&osd->mutex);
+}
+
+static
+rt_void pool_unlock(rt_POOL_OSD *osd)
+{
+    pthread_mutex_unlock(&osd->mutex);
+}
+
+/*
+ * Park on "k" (0 - worker, 1 - main), called and returns with lock held.
+ */
+static
+rt_void pool_wait(rt_POOL_OSD *osd, rt_si32 k)
+{
+    pthread_cond_wait(&osd->cond[k], &osd->mutex);
+}
+
+/*
+ * Wake up threads parked on "k" (0 - all workers, 1 - main), lock held.
+ */
+static
+rt_void pool_wake(rt_POOL_OSD *osd, rt_si32 k)
+{
+    if (k == 0)
+    {
+        pthread_cond_broadcast(&osd->cond[0]);
+    }
+    else
+    {
+        pthread_cond_signal(&osd->cond[1]);
+    }
+}
+
+static
+rt_void pool_pause()
+{
+#if (defined RT_X86) || (defined RT_X32) || (defined RT_X64)
+    __builtin_ia32_pause();
+#endif /* (defined RT_X86, RT_X32, RT_X64) */
+}
+
+static
+rt_pntr pool_entry(rt_pntr p)
+{
+    rt_POOL_THREAD *thread = (rt_POOL_THREAD *)p;
+
+    thread->pool->work(thread->index);
+
+    return RT_NULL;
+}
+
+static
+rt_void pool_start(rt_POOL_THREAD *thread)
+{
+    if (pthread_create(&thread->pthr, NULL, pool_entry, thread) != 0)
+    {
+        throw rt_Exception("failed to create worker-thread in thread pool");
+    }
+}
+
+static
+rt_void pool_join(rt_POOL_THREAD *thread)
+{
+    pthread_join(thread->pthr, NULL);
+}
+
+#if RT_SETAFFINITY
+
+/*
+ * Read list of ranges "0-3,8-11" from sysfs file at "path" into "set".
+ * Return 0 if the file is not present.
+ */
+static
+rt_si32 pool_list(rt_pstr path, cpu_set_t *set)
+{
+    rt_char buf[4096];
+    rt_si32 fd = open(path, O_RDONLY), n, i, a = -1, v = 0;
+
+    CPU_ZERO(set);
+
+    if (fd < 0)
+    {
+        return 0;
+    }
+
+    n = (rt_si32)read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+
+    for (i = 0; i < n + 1; i++)
+    {
+        rt_char c = i < n ? buf[i] : '\n';
+
+        if (c >= '0' && c <= '9')
+        {
+            v = v * 10 + (c - '0');
+        }
+        else
+        if (c == '-')
+        {
+            a = v;
+            v = 0;
+        }
+        else
+        if (i > 0 && buf[i-1] >= '0' && buf[i-1] <= '9')
+        {
+            for (a = a < 0 ? v : a; a <= v && a < CPU_SETSIZE; a++)
+            {
+                CPU_SET(a, set);
+            }
+            a = -1;
+            v = 0;
+        }
+    }
+
+    return 1;
+}
+
+#endif /* RT_SETAFFINITY */
+
+/*
+ * Fill "cpu" array (if not NULL) with indices of cores available
+ * to the process ordered by NUMA node.
+ * Return number of cores.
+ */
+static
+rt_si32 pool_cpus(rt_si32 *cpu)
+{
+    rt_si32 i, n = 0;
+
+#if RT_SETAFFINITY
+
+    cpu_set_t pam, nodes, nm, done;
+    CPU_ZERO(&done);
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &pam) != 0)
+    {
+        return RT_MAX(1, (rt_si32)sysconf(_SC_NPROCESSORS_ONLN));
+    }
+
+    rt_char path[64] = "/sys/devices/system/node/online";
+    rt_si32 k, node = pool_list(path, &nodes) ? 0 : CPU_SETSIZE;
+
+    for (; node <= CPU_SETSIZE; node++)
+    {
+        /* remaining cores after last node */
+        rt_bool all = node == CPU_SETSIZE;
+
+        if (!all)
+        {
+            if (!CPU_ISSET(node, &nodes))
+            {
+                continue;
+            }
+
+            /* path = ".../node/node<N>/cpulist" */
+            rt_char num[16];
+            for (i = node, k = 0; i > 0 || k == 0; i /= 10, k++)
+            {
+                num[k] = '0' + i % 10;
+            }
+            for (i = 25; i < 29; i++)
+            {
+                path[i] = "node"[i - 25];
+            }
+            for (; k > 0; k--, i++)
+            {
+                path[i] = num[k - 1];
+            }
+            for (k = 0; k < 9; k++, i++)
+            {
+                path[i] = "/cpulist"[k];
+            }
+
+            if (!pool_list(path, &nm))
+            {
+                continue;
+            }
+        }
+
+        for (i = 0; i < CPU_SETSIZE; i++)
+        {
+            if (CPU_ISSET(i, &pam) && (all || CPU_ISSET(i, &nm))
+            &&  !CPU_ISSET(i, &done))
+            {
+                if (cpu != RT_NULL)
+                {
+                    cpu[n] = i;
+                }
+                CPU_SET(i, &done);
+                n++;
+            }
+        }
+    }
+
+#else /* RT_SETAFFINITY */
+
+    n = RT_MAX(1, (rt_si32)sysconf(_SC_NPROCESSORS_ONLN));
+
+    for (i = 0; cpu != RT_NULL && i < n; i++)
+    {
+        cpu[i] = i;
+    }
+
+#endif /* RT_SETAFFINITY */
+
+    return n;
+}
+
+static
+rt_void pool_pin(rt_POOL_THREAD *thread, rt_si32 cpu)
+{
+#if RT_SETAFFINITY
+    cpu_set_t cpuset_th;
+    CPU_ZERO(&cpuset_th);
+    CPU_SET(cpu, &cpuset_th);
+    pthread_setaffinity_np(thread->pthr, sizeof(cpu_set_t), &cpuset_th);
+#endif /* RT_SETAFFINITY */
+}
+
+#if RT_SETAFFINITY
+#define RT_POOL_CPUS    CPU_SETSIZE
+#else /* RT_SETAFFINITY */
+#define RT_POOL_CPUS    4096
+#endif /* RT_SETAFFINITY */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/*
+ * Allocate thread pool in custom heap.
+ */
+rt_pntr rt_ThreadPool::operator new(size_t size, rt_Heap *hp)
+{
+    return hp->alloc(size, RT_ALIGN);
+}
+
+rt_void rt_ThreadPool::operator delete(rt_pntr ptr)
+{
+
+}
+
+/*
+ * Instantiate thread pool of "thnum" worker-threads running "f_task",
+ * pin them to available cores in NUMA-node order (wrapping around).
+ */
+rt_ThreadPool::rt_ThreadPool(rt_Heap *hp, rt_si32 thnum,
+                             rt_FUNC_TASK f_task, rt_pntr data)
+{
+    this->f_task = f_task;
+    this->data = data;
+    this->thnum = thnum = RT_MAX(1, thnum);
+    this->cmd = 0;
+
+    gen = 0;
+    cnt = 0;
+    wpark = 0;
+    mpark = 0;
+    err = RT_NULL;
+
+    rt_POOL_OSD *osd = (rt_POOL_OSD *)hp->alloc(sizeof(rt_POOL_OSD), RT_ALIGN);
+
+    osd->thread = (rt_POOL_THREAD *)
+            hp->alloc(sizeof(rt_POOL_THREAD) * thnum, RT_ALIGN);
+
+    rt_si32 *cpu = (rt_si32 *)hp->reserve(sizeof(rt_si32) * RT_POOL_CPUS,
+                                                                RT_ALIGN);
+    rt_si32 i, n = RT_MIN(pool_cpus(RT_NULL), RT_POOL_CPUS);
+    pool_cpus(cpu);
+
+    pool_init(osd);
+    this->osd = osd;
+
+    for (i = 0; i < thnum; i++)
+    {
+        rt_POOL_THREAD *thread = &osd->thread[i];
+
+        thread->pool = this;
+        thread->index = i;
+        pool_start(thread);
+
+        if (n > 0)
+        {
+            pool_pin(thread, cpu[i % n]);
+        }
+    }
+}
+
+/*
+ * Worker-thread waits for the task following generation "gen",
+ * spins for RT_THREADS_SPIN iterations, then parks until woken up.
+ * Return new task's generation.
+ */
+rt_si32 rt_ThreadPool::wait_task(rt_si32 gen)
+{
+    rt_POOL_OSD *osd = (rt_POOL_OSD *)this->osd;
+    rt_si32 i;
+
+    for (i = 0; i < RT_THREADS_SPIN && this->gen == gen; i++)
+    {
+        pool_pause();
+    }
+
+    if (this->gen == gen)
+    {
+        pool_lock(osd);
+        /* parked counter is raised before checking generation again,
+         * main thread raises generation before checking parked counter */
+        RT_ATOMIC_ADD(&wpark, +1);
+        while (this->gen == gen)
+        {
+            pool_wait(osd, 0);
+        }
+        RT_ATOMIC_ADD(&wpark, -1);
+        pool_unlock(osd);
+    }
+
+    /* full barrier makes task's data visible */
+    return RT_ATOMIC_ADD(&this->gen, 0);
+}
+
+/*
+ * Worker-thread signals completion of current task,
+ * the last one wakes up main thread if parked.
+ */
+rt_void rt_ThreadPool::done_task()
+{
+    rt_POOL_OSD *osd = (rt_POOL_OSD *)this->osd;
+
+    if (RT_ATOMIC_ADD(&cnt, -1) == 1 && mpark != 0)
+    {
+        pool_lock(osd);
+        pool_wake(osd, 1);
+        pool_unlock(osd);
+    }
+}
+
+/*
+ * Main thread tasks all worker-threads with "cmd" and waits for completion,
+ * spins for RT_THREADS_SPIN iterations, then parks until woken up.
+ */
+rt_void rt_ThreadPool::post_task(rt_si32 cmd)
+{
+    rt_POOL_OSD *osd = (rt_POOL_OSD *)this->osd;
+    rt_si32 i;
+
+    this->cmd = cmd;
+    cnt = thnum;
+
+    /* full barrier publishes the task before new generation,
+     * parked worker-threads are woken up only if present */
+    RT_ATOMIC_ADD(&gen, 1);
+
+    if (wpark != 0)
+    {
+        pool_lock(osd);
+        pool_wake(osd, 0);
+        pool_unlock(osd);
+    }
+
+    for (i = 0; i < RT_THREADS_SPIN && cnt != 0; i++)
+    {
+        pool_pause();
+    }
+
+    if (cnt != 0)
+    {
+        pool_lock(osd);
+        /* parked flag is raised before checking counter again,
+         * worker-threads lower counter before checking parked flag */
+        RT_ATOMIC_ADD(&mpark, +1);
+        while (cnt != 0)
+        {
+            pool_wait(osd, 1);
+        }
+        RT_ATOMIC_ADD(&mpark, -1);
+        pool_unlock(osd);
+    }
+
+    /* full barrier makes results of the task visible */
+    RT_ATOMIC_ADD(&cnt, 0);
+}
+
+/*
+ * Worker-thread's loop, runs tasks until the pool is deinitialized.
+ * If one thread throws an exception, other threads are still allowed
+ * to finish the same task, the first error is rethrown by the main thread.
+ */
+rt_void rt_ThreadPool::work(rt_si32 index)
+{
+    rt_si32 gen = 0;
+
+    while (1)
+    {
+        gen = wait_task(gen);
+
+        if (cmd < 0)
+        {
+            done_task();
+            break;
+        }
+
+        try
+        {
+            f_task(data, index, cmd);
+        }
+        catch (const rt_Exception &e)
+        {
+            (rt_void)RT_ATOMIC_CAS(&err, RT_NULL, e.err);
+        }
+
+        done_task();
+    }
+}
+
+/*
+ * Task all worker-threads with "cmd" (>= 0), block until finished.
+ * Rethrow the first exception raised by worker-threads.
+ */
+rt_void rt_ThreadPool::run(rt_si32 cmd)
+{
+    post_task(cmd);
+
+    if (err != RT_NULL)
+    {
+        rt_pstr e = err;
+        err = RT_NULL;
+        throw rt_Exception(e);
+    }
+}
+
+/*
+ * Get number of worker-threads in the pool.
+ */
+rt_si32 rt_ThreadPool::get_thnum()
+{
+    return thnum;
+}
+
+/*
+ * Get number of cores available to the process,
+ * used to limit the pool to physical parallelism.
+ */
+rt_si32 rt_ThreadPool::get_cpus()
+{
+    return pool_cpus(RT_NULL);
+}
+
+/*
+ * Deinitialize thread pool, wait for all worker-threads to finish.
+ */
+rt_ThreadPool::~rt_ThreadPool()
+{
+    rt_POOL_OSD *osd = (rt_POOL_OSD *)this->osd;
+    rt_si32 i;
+
+    /* signal all worker-threads to terminate */
+    post_task(-1);
+
+    for (i = 0; i < thnum; i++)
+    {
+        pool_join(&osd->thread[i]);
+    }
+
+    pool_done(osd);
+}
+
 /******************************************************************************/
 /******************************************************************************/
 /******************************************************************************/
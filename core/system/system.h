@@ -38,6 +38,46 @@
 #define RT_PATH_DUMP_LOG        RT_PATH_TOSTR(RT_PATH)"dump/log.txt"
 #define RT_PATH_DUMP_ERR        RT_PATH_TOSTR(RT_PATH)"dump/err.txt"
 
+#ifndef RT_SETAFFINITY
+#define RT_SETAFFINITY          1  /* enables thread-affinity and core-count */
+#endif /* RT_SETAFFINITY */
+
+#ifdef __APPLE__
+#undef  RT_SETAFFINITY /* setting thread affinity is not present on macOS */
+#define RT_SETAFFINITY          0
+#endif /* __APPLE__ */
+
+#ifndef RT_THREADS_SPIN
+#define RT_THREADS_SPIN         4096 /* spins before parking, 0 - park only */
+#endif /* RT_THREADS_SPIN */
+
+/*
+ * Atomic fetch-and-add on a 32-bit integer shared between threads,
+ * returns the value before the addition.
+ * Atomic compare-and-swap on a pointer shared between threads,
+ * stores "n" if the value is "o", returns the value before the swap.
+ */
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+#include <intrin.h>
+
+#define RT_ATOMIC_ADD(p, v)                                                 \
+        _InterlockedExchangeAdd((volatile long *)(p), (long)(v))
+
+#define RT_ATOMIC_CAS(p, o, n)                                              \
+        _InterlockedCompareExchangePointer((void *volatile *)(p),           \
+                                           (void *)(n), (void *)(o))
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+#define RT_ATOMIC_ADD(p, v)                                                 \
+        __sync_fetch_and_add((p), (v))
+
+#define RT_ATOMIC_CAS(p, o, n)                                              \
+        __sync_val_compare_and_swap((p), (o), (n))
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
 /* Classes */
 
 class rt_File;
@@ -49,6 +89,8 @@ class rt_List;
 class rt_Exception;
 class rt_LogRedirect;
 
+class rt_ThreadPool;
+
 /******************************************************************************/
 /**********************************   FILE   **********************************/
 /******************************************************************************/
@@ -107,6 +149,7 @@ typedef rt_void (*rt_FUNC_FREE)(rt_pntr ptr, rt_size size);
 /*
  * Heap manages fast linear allocs with the ability to release
  * group of allocs made after a checkpoint in the past.
+ * In high-water-mark mode released chunks are retained for reuse.
  */
 class rt_Heap
 {
@@ -117,7 +160,21 @@ class rt_Heap
     rt_CHUNK           *head;
     rt_pntr             obj_head;
 
+    /* chunks retained on release
+     * in high-water-mark mode */
+    rt_CHUNK           *free_head;
+    rt_bool             hwm_mode;
+
+    /* max bytes used past a checkpoint
+     * across releases */
+    rt_size             peak;
+
+    /* number of system allocs/frees */
+    rt_si32             num_alloc;
+    rt_si32             num_free;
+
     rt_void chunk_alloc(rt_size size, rt_ui32 align);
+    rt_void chunk_trim();
 
     protected:
 
@@ -139,6 +196,11 @@ class rt_Heap
 
     rt_pntr obj_alloc(rt_size size, rt_ui32 align);
     rt_pntr obj_free(rt_pntr ptr);
+
+    rt_void set_hwm(rt_bool hwm_mode);
+    rt_size get_peak();
+    rt_si32 get_allocs();
+    rt_si32 get_frees();
 };
 
 /******************************************************************************/
@@ -233,6 +295,74 @@ class rt_LogRedirect /* must be first in scene init */
     }
 };
 
+/******************************************************************************/
+/*******************************   THREAD POOL   ******************************/
+/******************************************************************************/
+
+/*
+ * Task function type for thread pool,
+ * called in every worker-thread with its "index" and "cmd" passed to run.
+ */
+typedef rt_void (*rt_FUNC_TASK)(rt_pntr data, rt_si32 index, rt_si32 cmd);
+
+/*
+ * ThreadPool runs a group of worker-threads on behalf of the main thread,
+ * each run tasks all workers with a command and blocks until they finish.
+ * Idle workers spin for RT_THREADS_SPIN iterations, then park.
+ * Workers are pinned to available cores ordered by NUMA node,
+ * so that neighbouring indices share a node.
+ */
+class rt_ThreadPool
+{
+/*  fields */
+
+    private:
+
+    rt_FUNC_TASK        f_task;
+    rt_pntr             data;
+    rt_si32             thnum;
+    rt_si32             cmd;
+
+    /* task's generation (changes when the next task is ready),
+     * number of worker-threads yet to finish current task,
+     * number of parked worker-threads, main thread's parked flag */
+    volatile rt_si32    gen;
+    volatile rt_si32    cnt;
+    volatile rt_si32    wpark;
+    volatile rt_si32    mpark;
+
+    /* first error thrown by a worker-thread in current task */
+    rt_pstr volatile    err;
+
+    /* OS-specific threads and parking */
+    rt_pntr             osd;
+
+    rt_si32 wait_task(rt_si32 gen);
+    rt_void done_task();
+    rt_void post_task(rt_si32 cmd);
+
+/*  methods */
+
+    public:
+
+    rt_pntr operator new(size_t size, rt_Heap *hp);
+    rt_void operator delete(rt_pntr ptr);
+
+    rt_ThreadPool(rt_Heap *hp, rt_si32 thnum, /* all allocs are made in "hp" */
+                  rt_FUNC_TASK f_task, rt_pntr data);
+
+    virtual
+   ~rt_ThreadPool();
+
+    rt_void run(rt_si32 cmd); /* rethrows worker-thread's exception */
+    rt_void work(rt_si32 index); /* worker-thread's loop, internal use */
+
+    rt_si32 get_thnum();
+
+    static
+    rt_si32 get_cpus(); /* number of cores available to the process */
+};
+
 #endif /* RT_SYSTEM_H */
 
 /******************************************************************************/
@@ -52,6 +52,9 @@
 #define RT_FEAT_CLIPPING_CUSTOM     1   /* <- breaks BB in the engine if 0 */
 #define RT_FEAT_CLIPPING_ACCUM      1   /* <- breaks AC in the engine if 0 */
 #define RT_FEAT_TEXTURING           1
+#define RT_FEAT_TEXTURING_MIP       1   /* mip-mapped bilinear if set in mat */
+#define RT_FEAT_TEXTURING_LAY       1   /* 4x4-tiled texels if set in mat */
+#define RT_FEAT_TEXTURING_BLK       1   /* 4x4-blocks, needs TEXTURING_LAY */
 #define RT_FEAT_NORMALS             1   /* <- breaks LT in the engine if 0 */
 #define RT_FEAT_LIGHTS              1
 #define RT_FEAT_LIGHTS_COLORED      1
@@ -116,6 +119,16 @@
 #define ACC(x)
 #endif /* RT_FEAT_BUFFERS_ACC */
 
+/*
+ * Number of mantissa bits in fp-element,
+ * used to derive mip-level from exponent.
+ */
+#if   RT_ELEMENT == 32
+#define MIP_E       23
+#elif RT_ELEMENT == 64
+#define MIP_E       52
+#endif /* RT_ELEMENT */
+
 /*
  * Byte-offsets within SIMD-field
  * for packed scalar fields.
@@ -661,6 +674,64 @@
         shlxx_ri(Reax, IB(2+P))                                             \
         movxx_ld(W(RD), Iebx, srf_##pl)
 
+/*
+ * Load/store SIMD-vector of fp-color plane "pl" at offset Reax
+ * using register "RG" (and its indexed form "IG") as plane's pointer.
+ * With fp16 planes values are scaled to/from fp16 exponent range
+ * in SIMD-registers, while narrowing/widening of 32-bit lanes
+ * is done one by one with 16-bit BASE ops via XTMP1 context field
+ * (Reax steps over 32-bit lanes, "RG" steps back to keep 16-bit stride).
+ */
+#if RT_PLANE_HALF == 0
+
+#define PLANE_LD(XD, RG, IG, pl) /* destroys RG; reads Reax */              \
+        movxx_ld(W(RG), Mebp, inf_##pl)                                     \
+        movpx_ld(W(XD), W(IG), DP(0))
+
+#define PLANE_ST(XS, RG, IG, pl) /* destroys RG; reads Reax */              \
+        movxx_ld(W(RG), Mebp, inf_##pl)                                     \
+        movpx_st(W(XS), W(IG), DP(0))
+
+#else /* RT_PLANE_HALF != 0 */
+
+#define PLANE_LD(XD, RG, IG, pl) /* destroys RG, Redi; reads Reax */        \
+        movxx_ld(W(RG), Mebp, inf_##pl)                                     \
+        addxx_rr(W(RG), Reax)                                               \
+        stack_st(Reax)                                                      \
+        xorxx_rr(Reax, Reax)                                                \
+    LBL(100601)                                                             \
+        movhz_ld(Redi, W(IG), DP(0))                                        \
+        shlwx_ri(Redi, IB(13))                                              \
+        movwx_st(Redi, Iecx, ctx_XTMP1)                                     \
+        subxx_ri(W(RG), IB(2))                                              \
+        addxx_ri(Reax, IB(4))                                               \
+        cmjxx_ri(Reax, IM(RT_SIMD_QUADS*16),                                \
+                 LT_x, 100601b)                                             \
+        stack_ld(Reax)                                                      \
+        movpx_ld(W(XD), Mecx, ctx_XTMP1)                                    \
+        mulps_ld(W(XD), Mebp, inf_HLF_D)
+
+#define PLANE_ST(XS, RG, IG, pl) /* destroys RG, Redi, XS; reads Reax */    \
+        minps_ld(W(XS), Mebp, inf_HLF_M)                                    \
+        mulps_ld(W(XS), Mebp, inf_HLF_E)                                    \
+        addpx_ld(W(XS), Mebp, inf_HLF_R)                                    \
+        movpx_st(W(XS), Mecx, ctx_XTMP1)                                    \
+        movxx_ld(W(RG), Mebp, inf_##pl)                                     \
+        addxx_rr(W(RG), Reax)                                               \
+        stack_st(Reax)                                                      \
+        xorxx_rr(Reax, Reax)                                                \
+    LBL(100602)                                                             \
+        movwx_ld(Redi, Iecx, ctx_XTMP1)                                     \
+        shrwx_ri(Redi, IB(13))                                              \
+        movhx_st(Redi, W(IG), DP(0))                                        \
+        subxx_ri(W(RG), IB(2))                                              \
+        addxx_ri(Reax, IB(4))                                               \
+        cmjxx_ri(Reax, IM(RT_SIMD_QUADS*16),                                \
+                 LT_x, 100602b)                                             \
+        stack_ld(Reax)
+
+#endif /* RT_PLANE_HALF != 0 */
+
 /*
  * Update relevant fragments of the
  * given SIMD-field based on the current SIMD-mask.
@@ -758,6 +829,8 @@
 
 #endif /* RT_FEAT_BUFFERS_HIT */
 
+#if RT_PLANE_HALF == 0
+
 #define FRAME_FRAG(lb, pn) /* destroys Reax, Redi, Xmm0 */                  \
         cmjyx_mz(Mecx, ctx_TMASK(0x##pn),                                   \
                  EQ_x, 100501f)                                             \
@@ -780,6 +853,37 @@
         movss_st(Xmm0, Iedi, DP(0))                                         \
     LBL(100501)
 
+#else /* RT_PLANE_HALF != 0 */
+
+#define FRAME_HALF(pn, pl, cl) /* destroys Reax, Redi, Xmm0 */              \
+        movyx_ld(Reax, Mecx, ctx_INDEX(0x##pn))                             \
+        shlxx_ri(Reax, IB(L))                                               \
+        addxx_ld(Reax, Mebp, inf_##pl)                                      \
+        movhz_ld(Redi, Oeax, PLAIN)                                         \
+        shlwx_ri(Redi, IB(13))                                              \
+        movwx_st(Redi, Mecx, ctx_XTMP1)                                     \
+        movss_ld(Xmm0, Mecx, ctx_XTMP1)                                     \
+        mulss_ld(Xmm0, Mebp, inf_HLF_D)                                     \
+    ACX(addss_ld(Xmm0, Mecx, ctx_COL_##cl(0x##pn)))                         \
+    ACC(addss_ld(Xmm0, Mecx, ctx_ACC_##cl(0x##pn)))                         \
+        minss_ld(Xmm0, Mebp, inf_HLF_M)                                     \
+        mulss_ld(Xmm0, Mebp, inf_HLF_E)                                     \
+        movss_st(Xmm0, Mecx, ctx_XTMP1)                                     \
+        movwx_ld(Redi, Mecx, ctx_XTMP1)                                     \
+        addwx_ri(Redi, IH(0x1000))                                          \
+        shrwx_ri(Redi, IB(13))                                              \
+        movhx_st(Redi, Oeax, PLAIN)
+
+#define FRAME_FRAG(lb, pn) /* destroys Reax, Redi, Xmm0 */                  \
+        cmjyx_mz(Mecx, ctx_TMASK(0x##pn),                                   \
+                 EQ_x, 100501f)                                             \
+        FRAME_HALF(pn, PTR_R, R)                                            \
+        FRAME_HALF(pn, PTR_G, G)                                            \
+        FRAME_HALF(pn, PTR_B, B)                                            \
+    LBL(100501)
+
+#endif /* RT_PLANE_HALF != 0 */
+
 #define SLICE_FRAG(lb, pn) /* destroys Reax, Rebx, Redx */                  \
         movwx_ld(Rebx, Mecx, ctx_SRF_H(0x##pn))                             \
         shlxx_ri(Rebx, IB(16))                                              \
@@ -978,21 +1082,148 @@
     LBL(100501)                                                             \
         movpx_st(Xmm0, Mecx, ctx_##pl)
 
+#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+        PAINT_TEXL(lb)                                                      \
+        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
+        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
+        PAINT_COLX(lb, 10, TEX_R)                                           \
+        PAINT_COLX(lb, 08, TEX_G)                                           \
+        PAINT_COLX(lb, 00, TEX_B)
+
+#if RT_FEAT_TEXTURING_MIP
+
+/*
+ * Same as above, but texel colors are weighted with Xmm6
+ * and added to the texture color for bilinear filtering.
+ */
+#define PAINT_COLB(lb, cl, pl) /* destroys Reax, Xmm0; reads Xmm2/6/7 */    \
+        movpx_ld(Xmm0, Mecx, ctx_C_BUF(0))                                  \
+        shrpx_ri(Xmm0, IB(0x##cl))                                          \
+        andpx_rr(Xmm0, Xmm7)                                                \
+        cvnpn_rr(Xmm0, Xmm0)                                                \
+        divps_rr(Xmm0, Xmm2)                                                \
+        CHECK_PROP(100501f, RT_PROP_GAMMA)                                  \
+  GAMMA(mulps_rr(Xmm0, Xmm0)) /* gamma-to-linear colorspace conversion */   \
+    LBL(100501)                                                             \
+        mulps_rr(Xmm0, Xmm6)                                                \
+        addps_ld(Xmm0, Mecx, ctx_##pl)                                      \
+        movpx_st(Xmm0, Mecx, ctx_##pl)
+
+#define PAINT_TEXB(lb) /* destroys Reax, Xmm0/2/7; reads Xmm1, Xmm6 */      \
+        PAINT_TEXL(lb)                                                      \
+        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
+        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
+        PAINT_COLB(lb, 10, TEX_R)                                           \
+        PAINT_COLB(lb, 08, TEX_G)                                           \
+        PAINT_COLB(lb, 00, TEX_B)
+
+#endif /* RT_FEAT_TEXTURING_MIP */
+
+#if RT_FEAT_TEXTURING_BLK
+
+/*
+ * Fetch texels from 64-bit blocks of 4x4 texels, where the 1st word holds
+ * two RGB565 end-colors (low, high) and the 2nd word holds 2-bit indices,
+ * Xmm1 holds byte-offsets of texels as if 4x4-tiled in 32-bit XRGB,
+ * thus block offset is (ofs >> 6) << 3, index shift is (ofs & 60) >> 1.
+ * Interpolation weight from index is left in Xmm3, end-colors in Xmm7.
+ */
+#define PAINT_BLKL(lb) /* destroys Reax, Xmm0/1/3/7; reads Xmm1 */          \
+        movpx_rr(Xmm3, Xmm1)                    /* shf_i <- ofs_t */        \
+        andpx_ld(Xmm3, Medx, mat_BLK_T)         /* shf_i &= BLK_T */        \
+        shrpx_ri(Xmm3, IB(1))                   /* shf_i >>     1 */        \
+        shrpx_ri(Xmm1, IB(6))                   /* ofs_b >>     6 */        \
+        shlpx_ri(Xmm1, IB(3))                   /* ofs_b <<     3 */        \
+        addpx_ld(Xmm1, Medx, mat_BLK_W)         /* ofs_b += BLK_W */        \
+        PAINT_TEXL(lb)                                                      \
+        movpx_ld(Xmm0, Mecx, ctx_C_BUF(0))      /* idx_t <- C_BUF */        \
+        svrpx_rr(Xmm0, Xmm3)                    /* idx_t >> shf_i */        \
+        andpx_ld(Xmm0, Medx, mat_BLK_I)         /* idx_t &= BLK_I */        \
+        cvnpn_rr(Xmm3, Xmm0)                    /* wgt_t in idx_t */        \
+        mulps_ld(Xmm3, Medx, mat_BLK_F)         /* wgt_t *= BLK_F */        \
+        subpx_ld(Xmm1, Medx, mat_BLK_W)         /* ofs_b -= BLK_W */        \
+        PAINT_TEXL(lb)                                                      \
+        movpx_ld(Xmm7, Mecx, ctx_C_BUF(0))      /* col_e <- C_BUF */
+
+/*
+ * Decode one channel of texel colors from end-colors in Xmm7
+ * at bit positions "c0" and "c1" with weight in Xmm3 into Xmm0.
+ */
+#define PAINT_BLKC(lb, c0, c1, mk, rc) /* destroys Reax, Xmm0/2 */          \
+        movpx_rr(Xmm0, Xmm7)                                                \
+        shrpx_ri(Xmm0, IB(c0))                                              \
+        andpx_ld(Xmm0, Medx, mat_##mk)                                      \
+        cvnpn_rr(Xmm0, Xmm0)                                                \
+        movpx_rr(Xmm2, Xmm7)                                                \
+        shrpx_ri(Xmm2, IB(c1))                                              \
+        andpx_ld(Xmm2, Medx, mat_##mk)                                      \
+        cvnpn_rr(Xmm2, Xmm2)                                                \
+        subps_rr(Xmm2, Xmm0)                                                \
+        mulps_rr(Xmm2, Xmm3)                                                \
+        addps_rr(Xmm0, Xmm2)                                                \
+        mulps_ld(Xmm0, Medx, mat_##rc)                                      \
+        CHECK_PROP(100501f, RT_PROP_GAMMA)                                  \
+  GAMMA(mulps_rr(Xmm0, Xmm0)) /* gamma-to-linear colorspace conversion */   \
+    LBL(100501)
+
+#define PAINT_BLKS(lb) /* destroys Reax, Xmm0-3/7; reads Xmm1 */            \
+        PAINT_BLKL(lb)                                                      \
+        PAINT_BLKC(lb, 11, 27, BLK_R, RCP_R)                                \
+        movpx_st(Xmm0, Mecx, ctx_TEX_R)                                     \
+        PAINT_BLKC(lb, 05, 21, BLK_G, RCP_G)                                \
+        movpx_st(Xmm0, Mecx, ctx_TEX_G)                                     \
+        PAINT_BLKC(lb, 00, 16, BLK_R, RCP_R)                                \
+        movpx_st(Xmm0, Mecx, ctx_TEX_B)
+
+#if RT_FEAT_TEXTURING_MIP
+
+#define PAINT_BLKB(lb) /* destroys Reax, Xmm0-3/7; reads Xmm1, Xmm6 */      \
+        PAINT_BLKL(lb)                                                      \
+        PAINT_BLKC(lb, 11, 27, BLK_R, RCP_R)                                \
+        mulps_rr(Xmm0, Xmm6)                                                \
+        addps_ld(Xmm0, Mecx, ctx_TEX_R)                                     \
+        movpx_st(Xmm0, Mecx, ctx_TEX_R)                                     \
+        PAINT_BLKC(lb, 05, 21, BLK_G, RCP_G)                                \
+        mulps_rr(Xmm0, Xmm6)                                                \
+        addps_ld(Xmm0, Mecx, ctx_TEX_G)                                     \
+        movpx_st(Xmm0, Mecx, ctx_TEX_G)                                     \
+        PAINT_BLKC(lb, 00, 16, BLK_R, RCP_R)                                \
+        mulps_rr(Xmm0, Xmm6)                                                \
+        addps_ld(Xmm0, Mecx, ctx_TEX_B)                                     \
+        movpx_st(Xmm0, Mecx, ctx_TEX_B)
+
+/*
+ * Weighted texel fetch for bilinear filtering
+ * from either plain or block-compressed texture.
+ */
+#define PAINT_TEXF(lb) /* destroys Reax, Xmm0-3/7; reads Xmm1, Xmm6 */      \
+        cmjxx_mz(Medx, mat_T_BLK,                                           \
+                 EQ_x, 100502f)                                             \
+        PAINT_BLKB(lb)                                                      \
+        jmpxx_lb(100503f)                                                   \
+    LBL(100502)                                                             \
+        PAINT_TEXB(lb)                                                      \
+    LBL(100503)
+
+#endif /* RT_FEAT_TEXTURING_MIP */
+
+#else /* RT_FEAT_TEXTURING_BLK */
+
+#define PAINT_TEXF(lb) /* destroys Reax, Xmm0/2/7; reads Xmm1, Xmm6 */      \
+        PAINT_TEXB(lb)
+
+#endif /* RT_FEAT_TEXTURING_BLK */
+
 #if   RT_SIMD_QUADS == 1
 
 #if   RT_ELEMENT == 32
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 04)                                                  \
         PAINT_FRAG(lb, 08)                                                  \
-        PAINT_FRAG(lb, 0C)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 0C)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1015,15 +1246,10 @@
 
 #elif RT_ELEMENT == 64
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
-        PAINT_FRAG(lb, 08)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 08)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1044,7 +1270,7 @@
 
 #if   RT_ELEMENT == 32
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 04)                                                  \
@@ -1053,12 +1279,7 @@
         PAINT_FRAG(lb, 10)                                                  \
         PAINT_FRAG(lb, 14)                                                  \
         PAINT_FRAG(lb, 18)                                                  \
-        PAINT_FRAG(lb, 1C)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 1C)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1093,17 +1314,12 @@
 
 #elif RT_ELEMENT == 64
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 08)                                                  \
         PAINT_FRAG(lb, 10)                                                  \
-        PAINT_FRAG(lb, 18)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 18)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1130,7 +1346,7 @@
 
 #if   RT_ELEMENT == 32
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 04)                                                  \
@@ -1147,12 +1363,7 @@
         PAINT_FRAG(lb, 30)                                                  \
         PAINT_FRAG(lb, 34)                                                  \
         PAINT_FRAG(lb, 38)                                                  \
-        PAINT_FRAG(lb, 3C)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 3C)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1211,7 +1422,7 @@
 
 #elif RT_ELEMENT == 64
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 08)                                                  \
@@ -1220,12 +1431,7 @@
         PAINT_FRAG(lb, 20)                                                  \
         PAINT_FRAG(lb, 28)                                                  \
         PAINT_FRAG(lb, 30)                                                  \
-        PAINT_FRAG(lb, 38)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 38)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1264,7 +1470,7 @@
 
 #if   RT_ELEMENT == 32
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 04)                                                  \
@@ -1297,12 +1503,7 @@
         PAINT_FRAG(lb, 70)                                                  \
         PAINT_FRAG(lb, 74)                                                  \
         PAINT_FRAG(lb, 78)                                                  \
-        PAINT_FRAG(lb, 7C)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 7C)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1409,7 +1610,7 @@
 
 #elif RT_ELEMENT == 64
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 08)                                                  \
@@ -1426,12 +1627,7 @@
         PAINT_FRAG(lb, 60)                                                  \
         PAINT_FRAG(lb, 68)                                                  \
         PAINT_FRAG(lb, 70)                                                  \
-        PAINT_FRAG(lb, 78)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, 78)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1494,7 +1690,7 @@
 
 #if   RT_ELEMENT == 32
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 04)                                                  \
@@ -1559,12 +1755,7 @@
         PAINT_FRAG(lb, F0)                                                  \
         PAINT_FRAG(lb, F4)                                                  \
         PAINT_FRAG(lb, F8)                                                  \
-        PAINT_FRAG(lb, FC)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, FC)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -1767,7 +1958,7 @@
 
 #elif RT_ELEMENT == 64
 
-#define PAINT_SIMD(lb) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */    \
+#define PAINT_TEXL(lb) /* destroys Reax; reads Xmm1 */                      \
         movpx_st(Xmm1, Mecx, ctx_C_PTR(0))                                  \
         PAINT_FRAG(lb, 00)                                                  \
         PAINT_FRAG(lb, 08)                                                  \
@@ -1800,12 +1991,7 @@
         PAINT_FRAG(lb, E0)                                                  \
         PAINT_FRAG(lb, E8)                                                  \
         PAINT_FRAG(lb, F0)                                                  \
-        PAINT_FRAG(lb, F8)                                                  \
-        movpx_ld(Xmm2, Medx, mat_CLAMP)                                     \
-        movpx_ld(Xmm7, Medx, mat_CMASK)                                     \
-        PAINT_COLX(lb, 10, TEX_R)                                           \
-        PAINT_COLX(lb, 08, TEX_G)                                           \
-        PAINT_COLX(lb, 00, TEX_B)
+        PAINT_FRAG(lb, F8)
 
 #define STORE_SPTR(lb) /* destroys Xmm0/1/2, Reax; reads Rebx, Redx, Resi */\
         STORE_HITX(lb)                                                      \
@@ -2144,7 +2330,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
 
 #if RT_FEAT_MULTITHREADING
 
-        movxx_ld(Reax, Mebp, inf_THNDX)
+        movxx_ld(Reax, Mebp, inf_FRM_S)
         movxx_st(Reax, Mebp, inf_FRM_Y)
 
 #else /* RT_FEAT_MULTITHREADING */
@@ -2156,7 +2342,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
     LBL(770676) /* YY_cyc */
 
         movxx_ld(Reax, Mebp, inf_FRM_Y)
-        cmjxx_rm(Reax, Mebp, inf_FRM_H,
+        cmjxx_rm(Reax, Mebp, inf_FRM_E,
                  LT_x, 770191f) /* YY_ini */
 
         jmpxx_lb(770923f) /* YY_out */
@@ -2171,7 +2357,9 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
 #if RT_FEAT_PT
 
         subxx_ld(Reax, Mebp, inf_FRAME)
-        shlxx_ri(Reax, IB(L-1))
+        shrxn_ri(Reax, IB(2))
+        addxx_ld(Reax, Mebp, inf_FRM_L)
+        shlxx_ri(Reax, IB(L+1))
         shlxx_ld(Reax, Mebp, inf_FSAA)
         addxx_ld(Reax, Mebp, inf_PSEED)
         movxx_st(Reax, Mebp, inf_PRNGS)
@@ -2202,11 +2390,16 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         addxx_ri(Reax, IB(E))
         addxx_ld(Reax, Mebp, inf_TILES)
         movxx_st(Reax, Mebp, inf_TLS)
-        movxx_mi(Mebp, inf_TLS_X, IB(0))
+
+        movxx_ld(Reax, Mebp, inf_FRM_L)
+        prexx_xx()
+        divxx_xm(Mebp, inf_TILE_W)
+        movxx_st(Reax, Mebp, inf_TLS_X)
 
 #endif /* RT_FEAT_TILING */
 
-        movxx_mi(Mebp, inf_FRM_X, IB(0))
+        movxx_ld(Reax, Mebp, inf_FRM_L)
+        movxx_st(Reax, Mebp, inf_FRM_X)
 
     LBL(880676) /* XX_cyc */
 
@@ -2244,23 +2437,20 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         movxx_ld(Reax, Mebp, inf_FRM_Y)
         mulxx_ld(Reax, Mebp, inf_FRM_ROW)
         addxx_ld(Reax, Mebp, inf_FRM_X)
-        shlxx_ri(Reax, IB(L+1))
+        shlxx_ri(Reax, IB(L+1-RT_PLANE_HALF))
         shlxx_rr(Reax, Rebx)
 
-        movxx_ld(Rebx, Mebp, inf_PTR_R)
-        movpx_ld(Xmm0, Iebx, DP(0))
+        PLANE_LD(Xmm0, Rebx, Iebx, PTR_R)
         mulps_ld(Xmm0, Mebp, inf_PTS_U)
-        movpx_st(Xmm0, Iebx, DP(0))
+        PLANE_ST(Xmm0, Rebx, Iebx, PTR_R)
 
-        movxx_ld(Rebx, Mebp, inf_PTR_G)
-        movpx_ld(Xmm0, Iebx, DP(0))
+        PLANE_LD(Xmm0, Rebx, Iebx, PTR_G)
         mulps_ld(Xmm0, Mebp, inf_PTS_U)
-        movpx_st(Xmm0, Iebx, DP(0))
+        PLANE_ST(Xmm0, Rebx, Iebx, PTR_G)
 
-        movxx_ld(Rebx, Mebp, inf_PTR_B)
-        movpx_ld(Xmm0, Iebx, DP(0))
+        PLANE_LD(Xmm0, Rebx, Iebx, PTR_B)
         mulps_ld(Xmm0, Mebp, inf_PTS_U)
-        movpx_st(Xmm0, Iebx, DP(0))
+        PLANE_ST(Xmm0, Rebx, Iebx, PTR_B)
 
 #endif /* RT_FEAT_BUFFERS */
 
@@ -3398,23 +3588,245 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         mulps_ld(Xmm4, Medx, mat_XSCAL)         /* tex_x *= XSCAL */
         mulps_ld(Xmm5, Medx, mat_YSCAL)         /* tex_y *= YSCAL */
 
+#if RT_FEAT_TEXTURING_MIP
+
+        cmjxx_mz(Medx, mat_T_FLT,
+                 EQ_x, 330356f) /* MT_nrs */
+
+        /* select mip-level from squared distance to camera,
+         * scaled to squared texel footprint, "log2" of which
+         * is taken from exponent, then halved */
+        movpx_ld(Xmm0, Mecx, ctx_HIT_X(0))      /* hit_x <- HIT_X */
+        subps_ld(Xmm0, Mebp, inf_POS_X)         /* dst_x -= POS_X */
+        mulps_rr(Xmm0, Xmm0)                    /* dst_x *= dst_x */
+        movpx_ld(Xmm1, Mecx, ctx_HIT_Y(0))      /* hit_y <- HIT_Y */
+        subps_ld(Xmm1, Mebp, inf_POS_Y)         /* dst_y -= POS_Y */
+        mulps_rr(Xmm1, Xmm1)                    /* dst_y *= dst_y */
+        addps_rr(Xmm0, Xmm1)                    /* dst_2 += dst_y */
+        movpx_ld(Xmm1, Mecx, ctx_HIT_Z(0))      /* hit_z <- HIT_Z */
+        subps_ld(Xmm1, Mebp, inf_POS_Z)         /* dst_z -= POS_Z */
+        mulps_rr(Xmm1, Xmm1)                    /* dst_z *= dst_z */
+        addps_rr(Xmm0, Xmm1)                    /* dst_2 += dst_z */
+        mulps_ld(Xmm0, Mebp, inf_LOD_S)         /* dst_2 *= LOD_S */
+        mulps_ld(Xmm0, Medx, mat_LOD_T)         /* dst_2 *= LOD_T */
+        maxps_ld(Xmm0, Medx, mat_MIP_1)         /* dst_2 max MIP_1 */
+        minps_ld(Xmm0, Medx, mat_MIP_T)         /* dst_2 min MIP_T */
+        subpx_ld(Xmm0, Medx, mat_MIP_1)         /* dst_2 -= MIP_1 */
+        shrpx_ri(Xmm0, IB(MIP_E+1))             /* lev_l = dst_2 */
+
+        /* scale coords to selected level,
+         * shift to texel centers */
+        movpx_rr(Xmm3, Xmm0)                    /* tmp_v <- lev_l */
+        shlpx_ri(Xmm3, IB(MIP_E))               /* tmp_v << MIP_E */
+        movpx_ld(Xmm2, Medx, mat_MIP_1)         /* scl_l <- MIP_1 */
+        subpx_rr(Xmm2, Xmm3)                    /* scl_l -= tmp_v */
+        mulps_rr(Xmm4, Xmm2)                    /* tex_x *= scl_l */
+        mulps_rr(Xmm5, Xmm2)                    /* tex_y *= scl_l */
+        subps_ld(Xmm4, Medx, mat_MIP_H)         /* tex_x -= MIP_H */
+        subps_ld(Xmm5, Medx, mat_MIP_H)         /* tex_y -= MIP_H */
+
+        /* split coords into integer
+         * and fractional (weight) parts */
+        rnmps_rr(Xmm2, Xmm4)                    /* tx0_x rm tex_x */
+        subps_rr(Xmm4, Xmm2)                    /* wgt_x -= tx0_x */
+        cvzps_rr(Xmm2, Xmm2)                    /* tx0_x iz tx0_x */
+        rnmps_rr(Xmm3, Xmm5)                    /* tx0_y rm tex_y */
+        subps_rr(Xmm5, Xmm3)                    /* wgt_y -= tx0_y */
+        cvzps_rr(Xmm3, Xmm3)                    /* tx0_y iz tx0_y */
+        movpx_st(Xmm4, Mecx, ctx_XTMP1)         /* wgt_x -> XTMP1 */
+        movpx_st(Xmm5, Mecx, ctx_XTMP2)         /* wgt_y -> XTMP2 */
+
+        /* wrap coords of 2x2 texels
+         * within selected level */
+        movpx_ld(Xmm6, Medx, mat_XMASK)         /* msk_x <- XMASK */
+        svrpx_rr(Xmm6, Xmm0)                    /* msk_x >> lev_l */
+        movpx_ld(Xmm7, Medx, mat_YMASK)         /* msk_y <- YMASK */
+        svrpx_rr(Xmm7, Xmm0)                    /* msk_y >> lev_l */
+        ceqpx_rr(Xmm1, Xmm1)                    /* tmp_v <-    -1 */
+        andpx_rr(Xmm2, Xmm6)                    /* tx0_x &= msk_x */
+        movpx_rr(Xmm4, Xmm2)                    /* tx1_x <- tx0_x */
+        subpx_rr(Xmm4, Xmm1)                    /* tx1_x -= tmp_v */
+        andpx_rr(Xmm4, Xmm6)                    /* tx1_x &= msk_x */
+        andpx_rr(Xmm3, Xmm7)                    /* tx0_y &= msk_y */
+        movpx_rr(Xmm5, Xmm3)                    /* tx1_y <- tx0_y */
+        subpx_rr(Xmm5, Xmm1)                    /* tx1_y -= tmp_v */
+        andpx_rr(Xmm5, Xmm7)                    /* tx1_y &= msk_y */
+
+        /* rows within selected level */
+        movpx_ld(Xmm6, Medx, mat_MIP_X)         /* shf_y <- MIP_X */
+        subpx_rr(Xmm6, Xmm0)                    /* shf_y -= lev_l */
+
+#if RT_FEAT_TEXTURING_LAY
+
+        cmjxx_mz(Medx, mat_T_LAY,
+                 EQ_x, 330355f) /* MT_lnf */
+
+        /* tiled layout: (x & ~3) << 2 | (x & 3) for columns,
+         * (y & ~3) << shf_y | (y & 3) << 2 for rows */
+        movpx_rr(Xmm7, Xmm2)                    /* tmp_t <- tx0_x */
+        andpx_ld(Xmm7, Medx, mat_LAY_M)         /* tmp_t &= LAY_M */
+        subpx_rr(Xmm2, Xmm7)                    /* tx0_x -= tmp_t */
+        shlpx_ri(Xmm2, IB(2))                   /* tx0_x <<     2 */
+        addpx_rr(Xmm2, Xmm7)                    /* tx0_x += tmp_t */
+        movpx_rr(Xmm7, Xmm4)                    /* tmp_t <- tx1_x */
+        andpx_ld(Xmm7, Medx, mat_LAY_M)         /* tmp_t &= LAY_M */
+        subpx_rr(Xmm4, Xmm7)                    /* tx1_x -= tmp_t */
+        shlpx_ri(Xmm4, IB(2))                   /* tx1_x <<     2 */
+        addpx_rr(Xmm4, Xmm7)                    /* tx1_x += tmp_t */
+        movpx_rr(Xmm7, Xmm3)                    /* tmp_t <- tx0_y */
+        andpx_ld(Xmm7, Medx, mat_LAY_M)         /* tmp_t &= LAY_M */
+        subpx_rr(Xmm3, Xmm7)                    /* tx0_y -= tmp_t */
+        svlpx_rr(Xmm3, Xmm6)                    /* tx0_y << shf_y */
+        shlpx_ri(Xmm7, IB(2))                   /* tmp_t <<     2 */
+        addpx_rr(Xmm3, Xmm7)                    /* tx0_y += tmp_t */
+        movpx_rr(Xmm7, Xmm5)                    /* tmp_t <- tx1_y */
+        andpx_ld(Xmm7, Medx, mat_LAY_M)         /* tmp_t &= LAY_M */
+        subpx_rr(Xmm5, Xmm7)                    /* tx1_y -= tmp_t */
+        svlpx_rr(Xmm5, Xmm6)                    /* tx1_y << shf_y */
+        shlpx_ri(Xmm7, IB(2))                   /* tmp_t <<     2 */
+        addpx_rr(Xmm5, Xmm7)                    /* tx1_y += tmp_t */
+
+        jmpxx_lb(330354f) /* MT_lvl */
+
+    LBL(330355) /* MT_lnf */
+
+#endif /* RT_FEAT_TEXTURING_LAY */
+
+        svlpx_rr(Xmm3, Xmm6)                    /* tx0_y << shf_y */
+        svlpx_rr(Xmm5, Xmm6)                    /* tx1_y << shf_y */
+
+#if RT_FEAT_TEXTURING_LAY
+
+    LBL(330354) /* MT_lvl */
+
+#endif /* RT_FEAT_TEXTURING_LAY */
+
+        /* offset of selected level in mip-chain
+         * is MIP_P pattern with low bits cleared */
+        movpx_rr(Xmm7, Xmm0)                    /* shf_l <- lev_l */
+        addpx_rr(Xmm7, Xmm0)                    /* shf_l += lev_l */
+        addpx_ld(Xmm7, Medx, mat_MIP_C)         /* shf_l += MIP_C */
+        svrpx_rr(Xmm1, Xmm7)                    /* tmp_v >> shf_l */
+        annpx_ld(Xmm1, Medx, mat_MIP_P)         /* tmp_v ~& MIP_P */
+        addpx_rr(Xmm3, Xmm1)                    /* tx0_y += tmp_v */
+        addpx_rr(Xmm5, Xmm1)                    /* tx1_y += tmp_v */
+
+        /* byte-offsets of 2x2 texels */
+        movpx_rr(Xmm1, Xmm3)                    /* ofs10 <- tx0_y */
+        addpx_rr(Xmm1, Xmm4)                    /* ofs10 += tx1_x */
+        shlpx_ri(Xmm1, IB(2))                   /* ofs10 <<     2 */
+        movpx_st(Xmm1, Mecx, ctx_TEX_U)         /* ofs10 -> TEX_U */
+        movpx_rr(Xmm1, Xmm5)                    /* ofs01 <- tx1_y */
+        addpx_rr(Xmm1, Xmm2)                    /* ofs01 += tx0_x */
+        shlpx_ri(Xmm1, IB(2))                   /* ofs01 <<     2 */
+        movpx_st(Xmm1, Mecx, ctx_TEX_V)         /* ofs01 -> TEX_V */
+        addpx_rr(Xmm5, Xmm4)                    /* ofs11 += tx1_x */
+        shlpx_ri(Xmm5, IB(2))                   /* ofs11 <<     2 */
+        movpx_st(Xmm5, Mecx, ctx_F_RND(0))      /* ofs11 -> F_RND */
+        /* use context's texture and random fields,
+         * free at this point, as temporary storage */
+        movpx_rr(Xmm1, Xmm3)                    /* ofs00 <- tx0_y */
+        addpx_rr(Xmm1, Xmm2)                    /* ofs00 += tx0_x */
+        shlpx_ri(Xmm1, IB(2))                   /* ofs00 <<     2 */
+
+        xorpx_rr(Xmm0, Xmm0)                    /* tmp_v <-     0 */
+        movpx_st(Xmm0, Mecx, ctx_TEX_R)
+        movpx_st(Xmm0, Mecx, ctx_TEX_G)
+        movpx_st(Xmm0, Mecx, ctx_TEX_B)
+
+        /* weighted sum of 2x2 texels */
+        movpx_ld(Xmm6, Medx, mat_MIP_1)         /* wgt_v <- MIP_1 */
+        subps_ld(Xmm6, Mecx, ctx_XTMP1)         /* wgt_v -= wgt_x */
+        movpx_ld(Xmm0, Medx, mat_MIP_1)         /* tmp_v <- MIP_1 */
+        subps_ld(Xmm0, Mecx, ctx_XTMP2)         /* tmp_v -= wgt_y */
+        mulps_rr(Xmm6, Xmm0)                    /* wgt_v *= tmp_v */
+
+        PAINT_TEXF(MT_rtx) /* destroys Reax, Xmm0-Xmm3, Xmm7; reads Xmm1 */
+
+        movpx_ld(Xmm1, Mecx, ctx_TEX_U)         /* ofs10 <- TEX_U */
+        movpx_ld(Xmm6, Mecx, ctx_XTMP1)         /* wgt_v <- wgt_x */
+        movpx_ld(Xmm0, Medx, mat_MIP_1)         /* tmp_v <- MIP_1 */
+        subps_ld(Xmm0, Mecx, ctx_XTMP2)         /* tmp_v -= wgt_y */
+        mulps_rr(Xmm6, Xmm0)                    /* wgt_v *= tmp_v */
+
+        PAINT_TEXF(MT_rtx) /* destroys Reax, Xmm0-Xmm3, Xmm7; reads Xmm1 */
+
+        movpx_ld(Xmm1, Mecx, ctx_TEX_V)         /* ofs01 <- TEX_V */
+        movpx_ld(Xmm6, Medx, mat_MIP_1)         /* wgt_v <- MIP_1 */
+        subps_ld(Xmm6, Mecx, ctx_XTMP1)         /* wgt_v -= wgt_x */
+        mulps_ld(Xmm6, Mecx, ctx_XTMP2)         /* wgt_v *= wgt_y */
+
+        PAINT_TEXF(MT_rtx) /* destroys Reax, Xmm0-Xmm3, Xmm7; reads Xmm1 */
+
+        movpx_ld(Xmm1, Mecx, ctx_F_RND(0))      /* ofs11 <- F_RND */
+        movpx_ld(Xmm6, Mecx, ctx_XTMP1)         /* wgt_v <- wgt_x */
+        mulps_ld(Xmm6, Mecx, ctx_XTMP2)         /* wgt_v *= wgt_y */
+
+        PAINT_TEXF(MT_rtx) /* destroys Reax, Xmm0-Xmm3, Xmm7; reads Xmm1 */
+
+        jmpxx_lb(330335f) /* MT_flt */
+
+    LBL(330356) /* MT_nrs */
+
+#endif /* RT_FEAT_TEXTURING_MIP */
+
         /* texture mapping */
         cvmps_rr(Xmm1, Xmm4)                    /* tex_x ii tex_x */
         andpx_ld(Xmm1, Medx, mat_XMASK)         /* tex_y &= XMASK */
 
         cvmps_rr(Xmm2, Xmm5)                    /* tex_y ii tex_y */
         andpx_ld(Xmm2, Medx, mat_YMASK)         /* tex_y &= YMASK */
+
+#if RT_FEAT_TEXTURING_LAY
+
+        cmjxx_mz(Medx, mat_T_LAY,
+                 EQ_x, 330357f) /* MT_lnr */
+
+        /* tiled layout: (x & ~3) << 2 | (x & 3) for columns,
+         * (y & ~3) << YSHFT | (y & 3) << 2 for rows */
+        movpx_rr(Xmm0, Xmm1)                    /* tmp_t <- tex_x */
+        andpx_ld(Xmm0, Medx, mat_LAY_M)         /* tmp_t &= LAY_M */
+        subpx_rr(Xmm1, Xmm0)                    /* tex_x -= tmp_t */
+        shlpx_ri(Xmm1, IB(2))                   /* tex_x <<     2 */
+        addpx_rr(Xmm1, Xmm0)                    /* tex_x += tmp_t */
+        movpx_rr(Xmm0, Xmm2)                    /* tmp_t <- tex_y */
+        andpx_ld(Xmm0, Medx, mat_LAY_M)         /* tmp_t &= LAY_M */
+        subpx_rr(Xmm2, Xmm0)                    /* tex_y -= tmp_t */
+        shlpx_ri(Xmm0, IB(2))                   /* tmp_t <<     2 */
+        addpx_rr(Xmm1, Xmm0)                    /* tex_x += tmp_t */
+
+    LBL(330357) /* MT_lnr */
+
+#endif /* RT_FEAT_TEXTURING_LAY */
+
         shlpx_ld(Xmm2, Medx, mat_YSHFT)         /* tex_y << YSHFT */
 
         addpx_rr(Xmm1, Xmm2)                    /* tex_x += tex_y */
         shlpx_ri(Xmm1, IB(2))                   /* tex_x <<     2 */
 
+#if RT_FEAT_TEXTURING_BLK
+
+        cmjxx_mz(Medx, mat_T_BLK,
+                 EQ_x, 330358f) /* MT_tex */
+
+        PAINT_BLKS(MT_rtx) /* destroys Reax, Xmm0-Xmm3, Xmm7; reads Xmm1 */
+
+        jmpxx_lb(330335f) /* MT_flt */
+
+#endif /* RT_FEAT_TEXTURING_BLK */
+
     LBL(330358) /* MT_tex */
 
 #endif /* RT_FEAT_TEXTURING */
 
         PAINT_SIMD(MT_rtx) /* destroys Reax, Xmm0, Xmm2, Xmm7; reads Xmm1 */
 
+#if RT_FEAT_TEXTURING && (RT_FEAT_TEXTURING_MIP || RT_FEAT_TEXTURING_BLK)
+
+    LBL(330335) /* MT_flt */
+
+#endif /* RT_FEAT_TEXTURING && (RT_FEAT_TEXTURING_MIP || ..._BLK) */
+
 /******************************************************************************/
 /*********************************   LIGHTS   *********************************/
 /******************************************************************************/
@@ -6989,35 +7401,36 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         movxx_ld(Reax, Mebp, inf_FRM_Y)
         mulxx_ld(Reax, Mebp, inf_FRM_ROW)
         addxx_ld(Reax, Mebp, inf_FRM_X)
-        shlxx_ri(Reax, IB(L+1))
+        shlxx_ri(Reax, IB(L+1-RT_PLANE_HALF))
         shlxx_rr(Reax, Rebx)
 
-        movxx_ld(Redx, Mebp, inf_PTR_R)
+        PLANE_LD(Xmm1, Redx, Iedx, PTR_R)
+        mulps_ld(Xmm1, Mebp, inf_PTS_U)
         movpx_ld(Xmm0, Mecx, ctx_COL_R(0))
         mulps_ld(Xmm0, Mebp, inf_PTS_O)
-        movpx_ld(Xmm1, Iedx, DP(0))
-        mulps_ld(Xmm1, Mebp, inf_PTS_U)
         addps_rr(Xmm0, Xmm1)
-        movpx_st(Xmm0, Iedx, DP(0))
         movpx_st(Xmm0, Mecx, ctx_COL_R(0))
+        PLANE_ST(Xmm0, Redx, Iedx, PTR_R)
 
-        movxx_ld(Redx, Mebp, inf_PTR_G)
+        PLANE_LD(Xmm1, Redx, Iedx, PTR_G)
+        mulps_ld(Xmm1, Mebp, inf_PTS_U)
         movpx_ld(Xmm0, Mecx, ctx_COL_G(0))
         mulps_ld(Xmm0, Mebp, inf_PTS_O)
-        movpx_ld(Xmm1, Iedx, DP(0))
-        mulps_ld(Xmm1, Mebp, inf_PTS_U)
         addps_rr(Xmm0, Xmm1)
-        movpx_st(Xmm0, Iedx, DP(0))
         movpx_st(Xmm0, Mecx, ctx_COL_G(0))
+        PLANE_ST(Xmm0, Redx, Iedx, PTR_G)
 
-        movxx_ld(Redx, Mebp, inf_PTR_B)
+        PLANE_LD(Xmm1, Redx, Iedx, PTR_B)
+        mulps_ld(Xmm1, Mebp, inf_PTS_U)
         movpx_ld(Xmm0, Mecx, ctx_COL_B(0))
         mulps_ld(Xmm0, Mebp, inf_PTS_O)
-        movpx_ld(Xmm1, Iedx, DP(0))
-        mulps_ld(Xmm1, Mebp, inf_PTS_U)
         addps_rr(Xmm0, Xmm1)
-        movpx_st(Xmm0, Iedx, DP(0))
         movpx_st(Xmm0, Mecx, ctx_COL_B(0))
+        PLANE_ST(Xmm0, Redx, Iedx, PTR_B)
+
+        /* skip frame output if color-planes are resolved by the engine */
+        cmjxx_mz(Mebp, inf_FRM_O,
+                 NE_x, 440532f) /* FF_skp */
 
 #endif /* RT_FEAT_BUFFERS == 0 */
 
@@ -7175,8 +7588,25 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         shrxx_ri(Reax, IB(2))
         addxx_st(Reax, Mebp, inf_FRM_X)
 
+#if RT_FEAT_PT && RT_FEAT_BUFFERS == 0
+
+        jmpxx_lb(440643f) /* FF_chk */
+
+    LBL(440532) /* FF_skp */
+
+        /* advance by the number of pixels in SIMD-register */
+        movxx_ri(Reax, IM(RT_SIMD_QUADS*16))
+        movxx_ld(Rebx, Mebp, inf_FSAA)
+        shrxx_rr(Reax, Rebx)
+        shrxx_ri(Reax, IB(L+1))
+        addxx_st(Reax, Mebp, inf_FRM_X)
+
+    LBL(440643) /* FF_chk */
+
+#endif /* RT_FEAT_PT && RT_FEAT_BUFFERS == 0 */
+
         movxx_ld(Reax, Mebp, inf_FRM_X)
-        cmjxx_rm(Reax, Mebp, inf_FRM_W,
+        cmjxx_rm(Reax, Mebp, inf_FRM_R,
                  GE_x, 770598f) /* YY_end */
 
         /* advance primary rays horizontally */
@@ -7223,7 +7653,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
 
 #if RT_FEAT_MULTITHREADING
 
-        movxx_ld(Reax, Mebp, inf_THNUM)
+        movxx_ld(Reax, Mebp, inf_FRM_U)
         addxx_st(Reax, Mebp, inf_FRM_Y)
 
 #else /* RT_FEAT_MULTITHREADING */
@@ -7378,9 +7808,17 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
 
     /* flush fp-color planes after the frame */
 
+#if RT_FEAT_PT
+
+        /* skip flush if color-planes are resolved by the engine */
+        cmjxx_mz(Mebp, inf_FRM_O,
+                 NE_x, 370923f) /* TY_out */
+
+#endif /* RT_FEAT_PT */
+
 #if RT_FEAT_MULTITHREADING
 
-        movxx_ld(Reax, Mebp, inf_THNDX)
+        movxx_ld(Reax, Mebp, inf_FRM_S)
         movxx_st(Reax, Mebp, inf_FRM_Y)
 
 #else /* RT_FEAT_MULTITHREADING */
@@ -7392,7 +7830,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
     LBL(370676) /* TY_cyc */
 
         movxx_ld(Reax, Mebp, inf_FRM_Y)
-        cmjxx_rm(Reax, Mebp, inf_FRM_H,
+        cmjxx_rm(Reax, Mebp, inf_FRM_E,
                  LT_x, 370191f) /* TY_ini */
 
         jmpxx_lb(370923f) /* TY_out */
@@ -7404,7 +7842,8 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         addxx_ld(Reax, Mebp, inf_FRAME)
         movxx_st(Reax, Mebp, inf_FRM)
 
-        movxx_mi(Mebp, inf_FRM_X, IB(0))
+        movxx_ld(Reax, Mebp, inf_FRM_L)
+        movxx_st(Reax, Mebp, inf_FRM_X)
 
     LBL(380676) /* TX_cyc */
 
@@ -7414,7 +7853,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         movxx_ld(Reax, Mebp, inf_FRM_Y)
         mulxx_ld(Reax, Mebp, inf_FRM_ROW)
         addxx_ld(Reax, Mebp, inf_FRM_X)
-        shlxx_ri(Reax, IB(L+1))
+        shlxx_ri(Reax, IB(L+1-RT_PLANE_HALF))
         shlxx_rr(Reax, Rebx)
 
 #if RT_FEAT_PT
@@ -7423,16 +7862,13 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
                  EQ_x, 380134f) /* TX_rtf */
 
         /* flush fp-color planes for PT */
-        movxx_ld(Redx, Mebp, inf_PTR_R)
-        movpx_ld(Xmm0, Iedx, DP(0))
+        PLANE_LD(Xmm0, Redx, Iedx, PTR_R)
         movpx_st(Xmm0, Mecx, ctx_COL_R(0))
 
-        movxx_ld(Redx, Mebp, inf_PTR_G)
-        movpx_ld(Xmm0, Iedx, DP(0))
+        PLANE_LD(Xmm0, Redx, Iedx, PTR_G)
         movpx_st(Xmm0, Mecx, ctx_COL_G(0))
 
-        movxx_ld(Redx, Mebp, inf_PTR_B)
-        movpx_ld(Xmm0, Iedx, DP(0))
+        PLANE_LD(Xmm0, Redx, Iedx, PTR_B)
         movpx_st(Xmm0, Mecx, ctx_COL_B(0))
 
         jmpxx_lb(380234f) /* TX_ptf */
@@ -7442,22 +7878,20 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
 #endif /* RT_FEAT_PT */
 
         /* flush fp-color planes for RT */
-        xorpx_rr(Xmm1, Xmm1)
-
-        movxx_ld(Redx, Mebp, inf_PTR_R)
-        movpx_ld(Xmm0, Iedx, DP(0))
-        movpx_st(Xmm1, Iedx, DP(0)) /* reset fp-color planes for RT */
+        PLANE_LD(Xmm0, Redx, Iedx, PTR_R)
         movpx_st(Xmm0, Mecx, ctx_COL_R(0))
+        xorpx_rr(Xmm0, Xmm0)
+        PLANE_ST(Xmm0, Redx, Iedx, PTR_R) /* reset fp-color planes for RT */
 
-        movxx_ld(Redx, Mebp, inf_PTR_G)
-        movpx_ld(Xmm0, Iedx, DP(0))
-        movpx_st(Xmm1, Iedx, DP(0)) /* reset fp-color planes for RT */
+        PLANE_LD(Xmm0, Redx, Iedx, PTR_G)
         movpx_st(Xmm0, Mecx, ctx_COL_G(0))
+        xorpx_rr(Xmm0, Xmm0)
+        PLANE_ST(Xmm0, Redx, Iedx, PTR_G) /* reset fp-color planes for RT */
 
-        movxx_ld(Redx, Mebp, inf_PTR_B)
-        movpx_ld(Xmm0, Iedx, DP(0))
-        movpx_st(Xmm1, Iedx, DP(0)) /* reset fp-color planes for RT */
+        PLANE_LD(Xmm0, Redx, Iedx, PTR_B)
         movpx_st(Xmm0, Mecx, ctx_COL_B(0))
+        xorpx_rr(Xmm0, Xmm0)
+        PLANE_ST(Xmm0, Redx, Iedx, PTR_B) /* reset fp-color planes for RT */
 
     LBL(380234) /* TX_ptf */
 
@@ -7588,7 +8022,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
         addxx_st(Reax, Mebp, inf_FRM_X)
 
         movxx_ld(Reax, Mebp, inf_FRM_X)
-        cmjxx_rm(Reax, Mebp, inf_FRM_W,
+        cmjxx_rm(Reax, Mebp, inf_FRM_R,
                  GE_x, 370598f) /* TY_end */
 
         jmpxx_lb(380676b) /* TX_cyc */
@@ -7597,7 +8031,7 @@ rt_void render0(rt_SIMD_INFOX *s_inf)
 
 #if RT_FEAT_MULTITHREADING
 
-        movxx_ld(Reax, Mebp, inf_THNUM)
+        movxx_ld(Reax, Mebp, inf_FRM_U)
         addxx_st(Reax, Mebp, inf_FRM_Y)
 
 #else /* RT_FEAT_MULTITHREADING */
@@ -8450,10 +8884,12 @@ rt_void render0(rt_SIMD_INFOX *s_inf);
  * Backend's global entry point (hence 0).
  * Render frame based on the data structures
  * prepared by the engine.
+ * RT domain is built without SIMD-buffers, PT domain is built with them
+ * and also renders regular frames (pt_on == 0) if requested by the engine.
  */
 rt_void rt_Platform::render0(rt_SIMD_INFOX *s_inf)
 {
-    if (s_inf->pt_on == 0)
+    if (s_inf->pt_on == 0 && s_inf->bf_on == 0)
     {
 /* RT domain */
 
@@ -57,6 +57,26 @@
 
 #define RT_PRNG                 LCG24
 
+/*
+ * Storage of framebuffer's color-planes for path-tracer (ptr_r/g/b):
+ * 0 - rt_real, 1 - fp16 (normals only) in 16-bit rt_half words,
+ * which halves memory traffic of color accumulation at large resolutions,
+ * conversion is done in the backend (and in the engine when resolving).
+ */
+#ifndef RT_PLANE_HALF
+#define RT_PLANE_HALF           0
+#endif /* RT_PLANE_HALF */
+
+#if RT_PLANE_HALF != 0 && RT_ELEMENT != 32
+#error "fp16 color-planes require 32-bit SIMD elements (RT_ELEMENT=32)"
+#endif /* RT_PLANE_HALF, RT_ELEMENT */
+
+#if RT_PLANE_HALF != 0
+typedef rt_half             rt_pelm;
+#else  /* RT_PLANE_HALF == 0 */
+typedef rt_real             rt_pelm;
+#endif /* RT_PLANE_HALF == 0 */
+
 /*
  * Material properties.
  * Value bit-range must not overlap with context flags (defined in tracer.cpp),
@@ -246,8 +266,37 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
     rt_word srf_s;
 #define inf_SRF_S           DP(Q*0x100+0x06C*P+E)
 
-    rt_word pad11[36];
-#define inf_PAD11           DP(Q*0x100+0x070*P+E)
+    /* rows range (set by the engine) */
+
+    rt_word frm_s;
+#define inf_FRM_S           DP(Q*0x100+0x070*P+E)
+
+    rt_word frm_e;
+#define inf_FRM_E           DP(Q*0x100+0x074*P+E)
+
+    rt_word frm_u;
+#define inf_FRM_U           DP(Q*0x100+0x078*P+E)
+
+    /* cols range (set by the engine) */
+
+    rt_word frm_l;
+#define inf_FRM_L           DP(Q*0x100+0x07C*P+E)
+
+    rt_word frm_r;
+#define inf_FRM_R           DP(Q*0x100+0x080*P+E)
+
+    /* frame output (set by the engine) */
+
+    rt_word frm_o;
+#define inf_FRM_O           DP(Q*0x100+0x084*P+E)
+
+    /* SIMD-buffers (set by the engine) */
+
+    rt_word bf_on;
+#define inf_BF_ON           DP(Q*0x100+0x088*P+E)
+
+    rt_word pad11[29];
+#define inf_PAD11           DP(Q*0x100+0x08C*P+E)
 
     rt_uelm prngf[S];
 #define inf_PRNGF           DP(Q*0x100+0x100*P)
@@ -297,151 +346,182 @@ struct rt_SIMD_INFOX : public rt_SIMD_INFO
     rt_real cos_8[S];
 #define inf_COS_8           DP(Q*0x1F0+0x100*P)
 
+    /* camera position and squared pixel footprint
+     * per unit of distance for texture's mip-level */
+
+    rt_real pos_x[S];
+#define inf_POS_X           DP(Q*0x200+0x100*P)
+
+    rt_real pos_y[S];
+#define inf_POS_Y           DP(Q*0x210+0x100*P)
+
+    rt_real pos_z[S];
+#define inf_POS_Z           DP(Q*0x220+0x100*P)
+
+    rt_real lod_s[S];
+#define inf_LOD_S           DP(Q*0x230+0x100*P)
+
+    /* fp16 color-planes conversion:
+     * scales to/from fp16 exponent range,
+     * max fp16 value and rounding addend */
+
+    rt_real hlf_e[S];
+#define inf_HLF_E           DP(Q*0x240+0x100*P)
+
+    rt_real hlf_d[S];
+#define inf_HLF_D           DP(Q*0x250+0x100*P)
+
+    rt_real hlf_m[S];
+#define inf_HLF_M           DP(Q*0x260+0x100*P)
+
+    rt_uelm hlf_r[S];
+#define inf_HLF_R           DP(Q*0x270+0x100*P)
+
 #if RT_DEBUG >= 1
 
     /* asin/acos under debug as not used yet */
 
     rt_real asn_1[S];
-#define inf_ASN_1           DP(Q*0x200+0x100*P)
+#define inf_ASN_1           DP(Q*0x280+0x100*P)
 
     rt_real asn_2[S];
-#define inf_ASN_2           DP(Q*0x210+0x100*P)
+#define inf_ASN_2           DP(Q*0x290+0x100*P)
 
     rt_real asn_3[S];
-#define inf_ASN_3           DP(Q*0x220+0x100*P)
+#define inf_ASN_3           DP(Q*0x2A0+0x100*P)
 
     rt_real asn_4[S];
-#define inf_ASN_4           DP(Q*0x230+0x100*P)
+#define inf_ASN_4           DP(Q*0x2B0+0x100*P)
 
     rt_real tmp_1[S];
-#define inf_TMP_1           DP(Q*0x240+0x100*P)
+#define inf_TMP_1           DP(Q*0x2C0+0x100*P)
 
     rt_real tmp_2[S];
-#define inf_TMP_2           DP(Q*0x250+0x100*P)
+#define inf_TMP_2           DP(Q*0x2D0+0x100*P)
 
     rt_real tmp_3[S];
-#define inf_TMP_3           DP(Q*0x260+0x100*P)
+#define inf_TMP_3           DP(Q*0x2E0+0x100*P)
 
     rt_real tmp_4[S];
-#define inf_TMP_4           DP(Q*0x270+0x100*P)
+#define inf_TMP_4           DP(Q*0x2F0+0x100*P)
 
-    rt_real pad12[S*8];
-#define inf_PAD12           DP(Q*0x280+0x100*P)
+    rt_real pad12[S*4];
+#define inf_PAD12           DP(Q*0x300+0x100*P)
 
     /* quadric debug info */
 
     rt_real wmask[S];
-#define inf_WMASK           DP(Q*0x300+0x100*P)
+#define inf_WMASK           DP(Q*0x340+0x100*P)
 
 
     rt_real dff_x[S];
-#define inf_DFF_X           DP(Q*0x310+0x100*P)
+#define inf_DFF_X           DP(Q*0x350+0x100*P)
 
     rt_real dff_y[S];
-#define inf_DFF_Y           DP(Q*0x320+0x100*P)
+#define inf_DFF_Y           DP(Q*0x360+0x100*P)
 
     rt_real dff_z[S];
-#define inf_DFF_Z           DP(Q*0x330+0x100*P)
+#define inf_DFF_Z           DP(Q*0x370+0x100*P)
 
 
     rt_real ray_x[S];
-#define inf_RAY_X           DP(Q*0x340+0x100*P)
+#define inf_RAY_X           DP(Q*0x380+0x100*P)
 
     rt_real ray_y[S];
-#define inf_RAY_Y           DP(Q*0x350+0x100*P)
+#define inf_RAY_Y           DP(Q*0x390+0x100*P)
 
     rt_real ray_z[S];
-#define inf_RAY_Z           DP(Q*0x360+0x100*P)
+#define inf_RAY_Z           DP(Q*0x3A0+0x100*P)
 
 
     rt_real a_val[S];
-#define inf_A_VAL           DP(Q*0x370+0x100*P)
+#define inf_A_VAL           DP(Q*0x3B0+0x100*P)
 
     rt_real b_val[S];
-#define inf_B_VAL           DP(Q*0x380+0x100*P)
+#define inf_B_VAL           DP(Q*0x3C0+0x100*P)
 
     rt_real c_val[S];
-#define inf_C_VAL           DP(Q*0x390+0x100*P)
+#define inf_C_VAL           DP(Q*0x3D0+0x100*P)
 
     rt_real d_val[S];
-#define inf_D_VAL           DP(Q*0x3A0+0x100*P)
+#define inf_D_VAL           DP(Q*0x3E0+0x100*P)
 
 
     rt_real dmask[S];
-#define inf_DMASK           DP(Q*0x3B0+0x100*P)
+#define inf_DMASK           DP(Q*0x3F0+0x100*P)
 
 
     rt_real t1nmr[S];
-#define inf_T1NMR           DP(Q*0x3C0+0x100*P)
+#define inf_T1NMR           DP(Q*0x400+0x100*P)
 
     rt_real t1dnm[S];
-#define inf_T1DNM           DP(Q*0x3D0+0x100*P)
+#define inf_T1DNM           DP(Q*0x410+0x100*P)
 
     rt_real t2nmr[S];
-#define inf_T2NMR           DP(Q*0x3E0+0x100*P)
+#define inf_T2NMR           DP(Q*0x420+0x100*P)
 
     rt_real t2dnm[S];
-#define inf_T2DNM           DP(Q*0x3F0+0x100*P)
+#define inf_T2DNM           DP(Q*0x430+0x100*P)
 
 
     rt_real t1val[S];
-#define inf_T1VAL           DP(Q*0x400+0x100*P)
+#define inf_T1VAL           DP(Q*0x440+0x100*P)
 
     rt_real t2val[S];
-#define inf_T2VAL           DP(Q*0x410+0x100*P)
+#define inf_T2VAL           DP(Q*0x450+0x100*P)
 
     rt_real t1srt[S];
-#define inf_T1SRT           DP(Q*0x420+0x100*P)
+#define inf_T1SRT           DP(Q*0x460+0x100*P)
 
     rt_real t2srt[S];
-#define inf_T2SRT           DP(Q*0x430+0x100*P)
+#define inf_T2SRT           DP(Q*0x470+0x100*P)
 
     rt_real t1msk[S];
-#define inf_T1MSK           DP(Q*0x440+0x100*P)
+#define inf_T1MSK           DP(Q*0x480+0x100*P)
 
     rt_real t2msk[S];
-#define inf_T2MSK           DP(Q*0x450+0x100*P)
+#define inf_T2MSK           DP(Q*0x490+0x100*P)
 
 
     rt_real tside[S];
-#define inf_TSIDE           DP(Q*0x460+0x100*P)
+#define inf_TSIDE           DP(Q*0x4A0+0x100*P)
 
 
     rt_real hit_x[S];
-#define inf_HIT_X           DP(Q*0x470+0x100*P)
+#define inf_HIT_X           DP(Q*0x4B0+0x100*P)
 
     rt_real hit_y[S];
-#define inf_HIT_Y           DP(Q*0x480+0x100*P)
+#define inf_HIT_Y           DP(Q*0x4C0+0x100*P)
 
     rt_real hit_z[S];
-#define inf_HIT_Z           DP(Q*0x490+0x100*P)
+#define inf_HIT_Z           DP(Q*0x4D0+0x100*P)
 
 
     rt_real adj_x[S];
-#define inf_ADJ_X           DP(Q*0x4A0+0x100*P)
+#define inf_ADJ_X           DP(Q*0x4E0+0x100*P)
 
     rt_real adj_y[S];
-#define inf_ADJ_Y           DP(Q*0x4B0+0x100*P)
+#define inf_ADJ_Y           DP(Q*0x4F0+0x100*P)
 
     rt_real adj_z[S];
-#define inf_ADJ_Z           DP(Q*0x4C0+0x100*P)
+#define inf_ADJ_Z           DP(Q*0x500+0x100*P)
 
 
     rt_real nrm_x[S];
-#define inf_NRM_X           DP(Q*0x4D0+0x100*P)
+#define inf_NRM_X           DP(Q*0x510+0x100*P)
 
     rt_real nrm_y[S];
-#define inf_NRM_Y           DP(Q*0x4E0+0x100*P)
+#define inf_NRM_Y           DP(Q*0x520+0x100*P)
 
     rt_real nrm_z[S];
-#define inf_NRM_Z           DP(Q*0x4F0+0x100*P)
+#define inf_NRM_Z           DP(Q*0x530+0x100*P)
 
 
     rt_word q_dbg;
-#define inf_Q_DBG           DP(Q*0x500+0x100*P+E)
+#define inf_Q_DBG           DP(Q*0x540+0x100*P+E)
 
     rt_word q_cnt;
-#define inf_Q_CNT           DP(Q*0x500+0x104*P+E)
+#define inf_Q_CNT           DP(Q*0x540+0x104*P+E)
 
 #endif /* RT_DEBUG */
 };
@@ -544,6 +624,13 @@ struct rt_SIMD_BUFFER
 
 /* buffer struct size for path-tracer */
 #define RT_BUFFER_SIZE      (Q * 0x0E0*2 + Q*RT_OFFS_BUFFERS_ACC + Q * 0x010)
+
+/*
+ * Buffer pool holds one buffer per surface side per depth level, so rays
+ * shaded together already share the surface and its lists. Binning by ray
+ * direction octant on top of that grows the pool 8x and leaves more
+ * partially filled SIMD vectors to shade at the flush (measured slower).
+ */
 #define RT_BUFFER_POOL      (RT_BUFFER_SIZE * (RT_STACK_DEPTH + 1) * 2)
 
 /*
@@ -1289,6 +1376,72 @@ struct rt_SIMD_MATERIAL
     rt_real gpc10[S];
 #define mat_GPC10           DP(Q*0x1A0)
 
+    /* mip-mapped bilinear filtering,
+     * enabled if T_FLT is non-zero */
+
+    rt_elem t_flt[S];
+#define mat_T_FLT           DP(Q*0x1B0)
+
+    rt_real lod_t[S];
+#define mat_LOD_T           DP(Q*0x1C0)
+
+    rt_real mip_1[S];
+#define mat_MIP_1           DP(Q*0x1D0)
+
+    rt_real mip_t[S];
+#define mat_MIP_T           DP(Q*0x1E0)
+
+    rt_real mip_h[S];
+#define mat_MIP_H           DP(Q*0x1F0)
+
+    rt_elem mip_x[S];
+#define mat_MIP_X           DP(Q*0x200)
+
+    rt_elem mip_c[S];
+#define mat_MIP_C           DP(Q*0x210)
+
+    rt_elem mip_p[S];
+#define mat_MIP_P           DP(Q*0x220)
+
+    /* 4x4-tiled texture layout,
+     * enabled if T_LAY is non-zero */
+
+    rt_elem t_lay[S];
+#define mat_T_LAY           DP(Q*0x230)
+
+    rt_elem lay_m[S];
+#define mat_LAY_M           DP(Q*0x240)
+
+    /* 4x4-block compressed texels,
+     * enabled if T_BLK is non-zero */
+
+    rt_elem t_blk[S];
+#define mat_T_BLK           DP(Q*0x250)
+
+    rt_elem blk_t[S];
+#define mat_BLK_T           DP(Q*0x260)
+
+    rt_elem blk_w[S];
+#define mat_BLK_W           DP(Q*0x270)
+
+    rt_elem blk_i[S];
+#define mat_BLK_I           DP(Q*0x280)
+
+    rt_real blk_f[S];
+#define mat_BLK_F           DP(Q*0x290)
+
+    rt_elem blk_r[S];
+#define mat_BLK_R           DP(Q*0x2A0)
+
+    rt_elem blk_g[S];
+#define mat_BLK_G           DP(Q*0x2B0)
+
+    rt_real rcp_r[S];
+#define mat_RCP_R           DP(Q*0x2C0)
+
+    rt_real rcp_g[S];
+#define mat_RCP_G           DP(Q*0x2D0)
+
 };
 
 /*
@@ -65,6 +65,46 @@ rt_MATERIAL mt_plain01_crate01 =
     },
 };
 
+rt_MATERIAL mt_plain01_crate02 =
+{
+    RT_MAT(PLAIN),
+
+#if RT_EMBED_TEX == 1
+    RT_TEX_BIND(PCOLOR, &dt_tex_crate01),
+#else /* RT_EMBED_TEX */
+    RT_TEX_LOAD(PCOLOR, "tex_crate01.bmp"),
+#endif /* RT_EMBED_TEX */
+
+    {/* dff     spc     pow */
+        1.0,    0.0,    1.0
+    },
+    {/* rfl     trn     rfr */
+        0.0,    0.0,    1.0
+    },
+
+    RT_FLT(BILINEAR),
+};
+
+rt_MATERIAL mt_plain01_crate03 =
+{
+    RT_MAT(PLAIN),
+
+#if RT_EMBED_TEX == 1
+    RT_TEX_BIND_4X4(BCOLOR, &dt_tex_crate01_bc),
+#else /* RT_EMBED_TEX */
+    RT_TEX_LOAD(PCOLOR, "tex_crate01.bmp"),
+#endif /* RT_EMBED_TEX */
+
+    {/* dff     spc     pow */
+        1.0,    0.0,    1.0
+    },
+    {/* rfl     trn     rfr */
+        0.0,    0.0,    1.0
+    },
+
+    RT_FLT(BILINEAR),
+};
+
 /******************************************************************************/
 /**********************************   TILES   *********************************/
 /******************************************************************************/
@@ -78,56 +78,63 @@ rt_PLANE pl_cube01side01 =
     },
 };
 
+/*
+ * Cube's sides with given outer material "pmat" (inner stays gray),
+ * used to define crate-cubes with other materials in scenes.
+ */
+#define OB_CUBE01_MAT(pmat)                                                 \
+    {                                                                       \
+        {  /*   RT_X,       RT_Y,       RT_Z    */                          \
+/* scl */   {    1.0,        1.0,        1.0    },                          \
+/* rot */   {  180.0,        0.0,        0.0    },                          \
+/* pos */   {    0.0,        0.0,       -1.0    },                          \
+        },                                                                  \
+        RT_OBJ_PLANE_MAT(&pl_cube01side01, pmat, RT_NULL)                   \
+    },                                                                      \
+    {                                                                       \
+        {  /*   RT_X,       RT_Y,       RT_Z    */                          \
+/* scl */   {    1.0,        1.0,        1.0    },                          \
+/* rot */   {    0.0,        0.0,        0.0    },                          \
+/* pos */   {    0.0,        0.0,       +1.0    },                          \
+        },                                                                  \
+        RT_OBJ_PLANE_MAT(&pl_cube01side01, pmat, RT_NULL)                   \
+    },                                                                      \
+    {                                                                       \
+        {  /*   RT_X,       RT_Y,       RT_Z    */                          \
+/* scl */   {    1.0,        1.0,        1.0    },                          \
+/* rot */   {  +90.0,        0.0,      -90.0    },                          \
+/* pos */   {   -1.0,        0.0,        0.0    },                          \
+        },                                                                  \
+        RT_OBJ_PLANE_MAT(&pl_cube01side01, pmat, RT_NULL)                   \
+    },                                                                      \
+    {                                                                       \
+        {  /*   RT_X,       RT_Y,       RT_Z    */                          \
+/* scl */   {    1.0,        1.0,        1.0    },                          \
+/* rot */   {  -90.0,        0.0,      -90.0    },                          \
+/* pos */   {   +1.0,        0.0,        0.0    },                          \
+        },                                                                  \
+        RT_OBJ_PLANE_MAT(&pl_cube01side01, pmat, RT_NULL)                   \
+    },                                                                      \
+    {                                                                       \
+        {  /*   RT_X,       RT_Y,       RT_Z    */                          \
+/* scl */   {    1.0,        1.0,        1.0    },                          \
+/* rot */   {  +90.0,        0.0,        0.0    },                          \
+/* pos */   {    0.0,       -1.0,        0.0    },                          \
+        },                                                                  \
+        RT_OBJ_PLANE_MAT(&pl_cube01side01, pmat, RT_NULL)                   \
+    },                                                                      \
+    {                                                                       \
+        {  /*   RT_X,       RT_Y,       RT_Z    */                          \
+/* scl */   {    1.0,        1.0,        1.0    },                          \
+/* rot */   {  -90.0,        0.0,        0.0    },                          \
+/* pos */   {    0.0,       +1.0,        0.0    },                          \
+        },                                                                  \
+        RT_OBJ_PLANE_MAT(&pl_cube01side01, pmat, RT_NULL)                   \
+    },
+
 rt_OBJECT ob_cube01[] =
 {
-    {
-        {  /*   RT_X,       RT_Y,       RT_Z    */
-/* scl */   {    1.0,        1.0,        1.0    },
-/* rot */   {  180.0,        0.0,        0.0    },
-/* pos */   {    0.0,        0.0,       -1.0    },
-        },
-        RT_OBJ_PLANE(&pl_cube01side01)
-    },
-    {
-        {  /*   RT_X,       RT_Y,       RT_Z    */
-/* scl */   {    1.0,        1.0,        1.0    },
-/* rot */   {    0.0,        0.0,        0.0    },
-/* pos */   {    0.0,        0.0,       +1.0    },
-        },
-        RT_OBJ_PLANE(&pl_cube01side01)
-    },
-    {
-        {  /*   RT_X,       RT_Y,       RT_Z    */
-/* scl */   {    1.0,        1.0,        1.0    },
-/* rot */   {  +90.0,        0.0,      -90.0    },
-/* pos */   {   -1.0,        0.0,        0.0    },
-        },
-        RT_OBJ_PLANE(&pl_cube01side01)
-    },
-    {
-        {  /*   RT_X,       RT_Y,       RT_Z    */
-/* scl */   {    1.0,        1.0,        1.0    },
-/* rot */   {  -90.0,        0.0,      -90.0    },
-/* pos */   {   +1.0,        0.0,        0.0    },
-        },
-        RT_OBJ_PLANE(&pl_cube01side01)
-    },
-    {
-        {  /*   RT_X,       RT_Y,       RT_Z    */
-/* scl */   {    1.0,        1.0,        1.0    },
-/* rot */   {  +90.0,        0.0,        0.0    },
-/* pos */   {    0.0,       -1.0,        0.0    },
-        },
-        RT_OBJ_PLANE(&pl_cube01side01)
-    },
-    {
-        {  /*   RT_X,       RT_Y,       RT_Z    */
-/* scl */   {    1.0,        1.0,        1.0    },
-/* rot */   {  -90.0,        0.0,        0.0    },
-/* pos */   {    0.0,       +1.0,        0.0    },
-        },
-        RT_OBJ_PLANE(&pl_cube01side01)
-    },
+    OB_CUBE01_MAT(&mt_plain01_crate01)
 };
 
 /******************************************************************************/
@@ -52,6 +52,7 @@
 
 #if RT_EMBED_TEX == 1
 #include "tex_crate01.h"
+#include "tex_crate01_bc.h"
 #endif /* RT_EMBED_TEX */
 
 #endif /* RT_ALL_TEX_H */
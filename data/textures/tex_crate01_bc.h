@@ -0,0 +1,1389 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_TEX_CRATE01_BC_H
+#define RT_TEX_CRATE01_BC_H
+
+/*
+ * Texture data below was converted with (run from "test" subfolder):
+ * "./core_test.x86 -r tex_crate01.bmp", 4x4-block compressed version of
+ * tex_crate01.h (8x smaller), bind with RT_TEX_BIND_4X4(BCOLOR, ...).
+ */
+rt_ui32 dt_tex_crate01_bc[64][64][2] =
+{
+    0x62CB5A69, 0x78749484, 0x62AA4207, 0x2B2A1E1B, 0x526939C6, 0x949599D9,
+    0x52694A08, 0x42D1D4D7, 0x5A8A4A08, 0x7595D1A0, 0x62AA41C7, 0x5F1A1905,
+    0x522849E7, 0xBAB86856, 0x5A8941E7, 0xE5E5E4E4, 0x31652103, 0x54AAAAE5,
+    0x31852104, 0x50FAAAFF, 0x31852924, 0x6946AAEA, 0x39A52944, 0x0404B9FF,
+    0x31852924, 0xBE24E1FF, 0x4A072944, 0x0554E9FE, 0x4A282944, 0x0055AAFF,
+    0x4A072944, 0x00A5FFFF, 0x4A272925, 0x0155BEFE, 0x4A072104, 0x01196AFF,
+    0x4A482104, 0x000040FE, 0x6B0B2104, 0xF4F4A4AA, 0x6B0B5A89, 0x2A6ABB29,
+    0x6AEB5A89, 0x416A6B01, 0x734D62AA, 0xE591A590, 0x7B8E6AEB, 0xAEE91514,
+    0x7B8E5A69, 0xE5FAA491, 0x7B8E6B0C, 0x1A5B9655, 0x7B8D6B0C, 0x8975BD6A,
+    0x7B6D62EB, 0xAB6E5A51, 0x7B8D62EB, 0x57696466, 0x734D62CA, 0x51AA5AD5,
+    0x7B6D5A8A, 0x4556BEFF, 0x736D62CB, 0x19A5AAFF, 0x7B8D6AEB, 0x6440E4E5,
+    0x83AE62CB, 0x40555AAF, 0x7B6D62CA, 0x1506AF6B, 0x7B6C62CA, 0x0040AE15,
+    0x732B62AA, 0x05EF6F15, 0x6B2B62AA, 0x40FFFA00, 0x732B5A89, 0x696F2F15,
+    0x734B62CA, 0x1692E692, 0x83AE5248, 0xA4E4E6A5, 0x7B8D5A89, 0xAAAFAA49,
+    0x736C5AA9, 0xABAB5701, 0x7BAE5AA9, 0xF6E5E490, 0x7B8D5248, 0x2F6F6F1A,
+    0x83AE5AA9, 0xEAA59545, 0x83AD62AA, 0xDAB86450, 0x83AD62A9, 0xF0666569,
+    0x83AE5AA9, 0xEA994494, 0x7B8D5AA9, 0x57465656, 0x7B6C5A69, 0x4A055AAF,
+    0x732C62A9, 0x5E5A5A1A, 0x732B5A89, 0x4A4A4B06, 0x734C4A47, 0xB9BAAA15,
+    0x732B4A27, 0xBAFEFE54, 0x83CE5A89, 0xA5EAEA01, 0x94104A48, 0xFDF9F8F8,
+    0x94307B4D, 0x3B7B6B2F, 0x6B0C5249, 0x2B6B6A66, 0x734C49C7, 0x8686878B,
+    0x7B6C62AA, 0x42825607, 0x62AA41C6, 0x60A4A8EC, 0x732C5AA9, 0x52576663,
+    0x7B6D628A, 0xA5E2E2F2, 0x62CB5A8A, 0xBDBCE8A4, 0x62AA0861, 0x2BABBFBF,
+    0x42071062, 0xA954AAFF, 0x5A692124, 0xB8AEAFAB, 0x5A8A4A08, 0xAA8491B5,
+    0x62CB49E7, 0x1E0B1B1A, 0x524849E7, 0xABAA387D, 0x5A6949E7, 0xD5D080D0,
+    0x41C62104, 0xBF944055, 0x41E72924, 0xEABA5005, 0x39C62924, 0xEB5BAA01,
+    0x49E72924, 0xFEE9A540, 0x4A283165, 0xFFAAAA00, 0x52282944, 0xEAAAA640,
+    0x52283145, 0xFAAA5600, 0x4A282944, 0xFFAA5501, 0x52282924, 0xFEEB5500,
+    0x5A692924, 0xFFFE6A00, 0x62CA2104, 0xFEAAA910, 0x6AEB3165, 0xAAEAAAF4,
+    0x62CB5228, 0x95BF9156, 0x734D5A8A, 0xA5FA9640, 0x7B6D62CB, 0x65AAEA41,
+    0x7BAE5A69, 0x92969BEE, 0x734D41C7, 0xD5D091D1, 0x83CE5228, 0x150152AB,
+    0x7B8E49E7, 0x84619ABA, 0x7B6D62CB, 0x8664EAF9, 0x734D62CB, 0xB25AE62E,
+    0x734C62AA, 0x86791629, 0x6B0B5228, 0x1BAA9AAA, 0x6AEB5A89, 0x5041A9FA,
+    0x6B0C5228, 0x41AAABAB, 0x62EB5A89, 0x5A06BEA6, 0x6AEB5268, 0x5196BAB9,
+    0x62CA5248, 0x15BEFFEB, 0x6AEB49E6, 0x05AAFFBF, 0x6AEB4A07, 0x50AAFFFA,
+    0x6AEB5A89, 0x005A5E5F, 0x6B0B5A89, 0xB4BA6A6B, 0x734C5268, 0xA5A8A4F0,
+    0x734C62CA, 0x540458D6, 0x732B62AA, 0x00005117, 0x734C5AA9, 0x61B2B7F7,
+    0x7B8D5A89, 0x065B6B2B, 0x7B6D62EB, 0x455465E6, 0x83AE62CA, 0x041445E9,
+    0x7B8D3985, 0xFAFEFEE8, 0x83AE62AA, 0x995594FD, 0x7B8D5A69, 0x1A95EBAB,
+    0x7B6D6ACA, 0x41EEEA8B, 0x7B8D732B, 0x565F8A49, 0x83AE62CA, 0xEEAE9E45,
+    0x7B8D5A89, 0x7ABF6A15, 0x7B8D62AA, 0xB9FD6868, 0x8BCF730C, 0xA6EA9550,
+    0x9C715289, 0xB8B8B8B8, 0x94307B8E, 0x2F3B7A2B, 0x734D5A89, 0x5A6B3B27,
+    0x732C5249, 0xABABD681, 0x6B0B18C3, 0x1BABEFFF, 0x524918C3, 0xD95056BB,
+    0x732C2965, 0xD1E4E9EB, 0x7B6D62CA, 0xE494D4A0, 0x62CB5A69, 0x414195BE,
+    0x5A8A0021, 0x1B1B5B1B, 0x4A8A18E4, 0x54B8F8A5, 0x4A492944, 0xB2A3A3B1,
+    0x5AAA4A08, 0x92A363B6, 0x5AAA41E7, 0x7E3E2F2F, 0x524849E7, 0xA1F5BCAD,
+    0x5A894A08, 0x90D1D190, 0x4A082944, 0xE5F4E595, 0x526941E6, 0xAE5E1A69,
+    0x4A0739A6, 0xA62AD1CA, 0x5A8939A6, 0xB4A965D6, 0x5A694A07, 0x3454A5EB,
+    0x62CA4A28, 0xA8E4A565, 0x6AEB5228, 0x6FBFFE54, 0x6B0B5A69, 0x4011FF55,
+    0x6B2C5A8A, 0xABE8FE01, 0x732C5A8A, 0xBEAEA611, 0x6B0C5A69, 0xAFAFAA14,
+    0x732C5249, 0xFFDB9640, 0x732C5A69, 0x16AAB6E0, 0x734C5248, 0x40AAFAAB,
+    0x6B2C5A69, 0x091E5BEB, 0x734D5228, 0x554145EA, 0x734D5249, 0x16512ADB,
+    0x6B2C41E7, 0xD2A56946, 0x732C41E7, 0x25A6D976, 0x734D5228, 0xC6A2B97E,
+    0x6B2C5A69, 0x82E6BEAF, 0x6B2C5269, 0x8BD6F46F, 0x6B0B5248, 0x2F1B96AA,
+    0x62EB49E7, 0xADAE6B91, 0x62CA49E7, 0x2A01A0AB, 0x62CA41A6, 0x40E9BF55,
+    0x62EA4A07, 0xFAAB0150, 0x62CA41C6, 0xFFEB00AA, 0x62EA4A07, 0xFFBF00AA,
+    0x62CB5248, 0xEAAA146A, 0x6AEB5248, 0xAF9A5091, 0x6AEB5A69, 0xABBAA4A5,
+    0x62EB5248, 0xE8E6AA91, 0x62EB5268, 0xEAA9D5D4, 0x6B0B5269, 0x651565BE,
+    0x6B0B5A69, 0x6661A5B5, 0x734C5A89, 0x4B47479B, 0x6B2C5AAA, 0x6B58EBA9,
+    0x6B2C628A, 0x7C69AD69, 0x7B4D62AA, 0x54A4B964, 0x734D62EB, 0x64F8F9AD,
+    0x734C5AAA, 0xA2B7A262, 0x734C62AA, 0x9E429795, 0x734C62AA, 0xAB9A9B40,
+    0x7B6D62CA, 0x9B845819, 0x7B6D5A89, 0x792A696A, 0x6B2B5A89, 0xAC69A9BC,
+    0x734C62AA, 0x5081A5FE, 0x9C714A28, 0xA8F8B8F8, 0x94307B8D, 0x2B2A263B,
+    0x732C62CA, 0x7A6B266B, 0x734C62CA, 0xABABA666, 0x52481082, 0x2A2A5B5B,
+    0x636E2124, 0x54A5B9F9, 0x6B2C2145, 0xE0D6D5D6, 0x7B6D5A8A, 0xA4E4D4E5,
+    0x5A8A5249, 0xA3A3E3EB, 0x62AA1082, 0xFFFFAF2B, 0x4A080861, 0xEBA64154,
+    0x52492104, 0xF9F9B8B8, 0x5A8A4A28, 0xD8D9D591, 0x62EB4A08, 0xE8B96866,
+    0x524941C6, 0x69A96C95, 0x5A8949E7, 0xD5D19190, 0x524841C6, 0xB91A6A65,
+    0x52283986, 0xAAB9E5D0, 0x524841C6, 0xAA40FF69, 0x5A893965, 0xAAE6AA92,
+    0x62CA4A07, 0xE996E065, 0x62EB5228, 0x5B959694, 0x6AEB5248, 0x5196A5BF,
+    0x6AEB5A69, 0xBEBFAAA0, 0x732C62AA, 0x19196A6B, 0x734C5AAA, 0x7DD5F455,
+    0x734D5A69, 0x06AAFE95, 0x732C5A69, 0x06196F96, 0x6AEB4A28, 0x655065BB,
+    0x6AEB4A08, 0xF9F5A590, 0x7B8E5A69, 0xA6A9E994, 0x83CF5AAA, 0x56AB5606,
+    0x732C5228, 0xEA2A8A99, 0x62CB3986, 0xAB1BAA9B, 0x62CB41C7, 0x91643035,
+    0x7B6D4186, 0xF4E2969A, 0x734D5249, 0xF1A69253, 0x734D5249, 0x979B8706,
+    0x736D49E7, 0x6F6A1A5A, 0x732C49E7, 0xFEE9A8A4, 0x734C4A08, 0xAF2B1A19,
+    0x6B2B3985, 0xFFFEA541, 0x6B0B5A89, 0xFFAAAE45, 0x6AEB5A69, 0xAFAAAF02,
+    0x6B2C5268, 0xA5FEAA41, 0x6B0B5228, 0xAAAB5190, 0x6B0B41A6, 0xFA6F1A6A,
+    0x6AEA49E7, 0x56D0D4D1, 0x7B8D5269, 0xF9AAA954, 0x7B8D5AAA, 0xFAAA9544,
+    0x7B8D62CA, 0xAB160011, 0x734C5269, 0xBBBA7A15, 0x734C5269, 0x9B874686,
+    0x734D5A69, 0xBB590515, 0x736D5A69, 0xBB651500, 0x732C5A8A, 0x26755064,
+    0x6B0C5AAA, 0xAA29E4FA, 0x732C5269, 0x5261E6B6, 0x6AEB5A69, 0x808EAE5A,
+    0x6B0B5A89, 0x56AA6BE2, 0x734C5A89, 0x455A5AEB, 0x734C5AAA, 0x6911692E,
+    0x62CA4A07, 0xEAD1A6BF, 0x62CB5A89, 0x5A9AD1E5, 0x94304A28, 0xF8F8F8B8,
+    0x8C0F7B6D, 0x6B7F6B3B, 0x734D6AEB, 0x80909530, 0x734C62CA, 0x3E7AFABA,
+    0x52283985, 0xFE6E1A25, 0x732C18A2, 0xE9E99A01, 0x734C2944, 0xFDFDF9E8,
+    0x7B4D5A8A, 0xE9E894D5, 0x62CB5A69, 0xAABA6652, 0x62AA5A89, 0xBF297E7E,
+    0x52693165, 0x57979293, 0x52493986, 0xB5B9A4E5, 0x5A694A28, 0xD6E7D594,
+    0x5A8A1082, 0x1ABAFFFF, 0x524920E3, 0x80EAFFFB, 0x5A8941C7, 0x95D191D2,
+    0x4A083986, 0x5154F8AF, 0x522841A6, 0x50A5AEAA, 0x4A2849E7, 0xB9819510,
+    0x524849E7, 0xA9AA06FC, 0x5A895228, 0x54D4544B, 0x62CB4A08, 0x45A9AAE6,
+    0x62CB5248, 0x95A591AB, 0x6AEB5A8A, 0xA55915E4, 0x6B0C62AA, 0xF5A99156,
+    0x734D62CB, 0x16AAE5B8, 0x732C5A8A, 0x010A2A1B, 0x62AA5A69, 0x05719082,
+    0x62EB5A69, 0x506455E5, 0x6B0B5A8A, 0xE4F4D060, 0x7B8E62CA, 0x5591D1D0,
+    0x7B6D5249, 0x1B579796, 0x6AEB5228, 0x4086D1E1, 0x6AEB3965, 0x87ABAB6B,
+    0x6AEB3124, 0xFA6E9529, 0x734D4A08, 0xDBB9563C, 0x7B6D4A08, 0xAFE9EFFC,
+    0x7B6E62AA, 0xAAA73DA1, 0x83AE62AB, 0xAA6FAA81, 0x7B8E62AA, 0x6A551AAF,
+    0x734C62CA, 0xFF166895, 0x6B2C5A88, 0xAB1A15BA, 0x6B0B5248, 0x5A0001AF,
+    0x6AEB5248, 0x94E49512, 0x6AEA5228, 0xFAFF6600, 0x6B0B5228, 0xFFFE0090,
+    0x732C5228, 0x6AAF4055, 0x734D5A89, 0xB9065419, 0x732C5248, 0xBEE95AE0,
+    0x7B8D5A89, 0xE5E2E5E6, 0x83AE6AEB, 0x971156A6, 0x83AE62CB, 0xBA11BAB9,
+    0x83CE62CA, 0x46D5CBC6, 0x83CF734D, 0x2CAE6BEA, 0x7B8E41C7, 0x5F0B5B5F,
+    0x83AE5A8A, 0x7BAA6025, 0x83AE62EB, 0xFAA75600, 0x734C5228, 0xFBB7A6A2,
+    0x83AE5AAA, 0xAF565514, 0x83AE62CA, 0xAB561101, 0x734C5A89, 0xEBBFAA45,
+    0x732B41E7, 0x16AFAAAA, 0x6B0B41C7, 0x90EAFF66, 0x732C5A69, 0x555AEB40,
+    0x943041E7, 0xF8F8FCF8, 0x8C0F736D, 0x1A1B6F6B, 0x732C4A08, 0x41EAEBFF,
+    0x7B6D49E7, 0x3A3A7A7E, 0x62CB5228, 0x999D1914, 0x734C41A6, 0xE8E8E8E8,
+    0x734C5228, 0xA8E8F9F8, 0x734D6AEB, 0x98D5D2E2, 0x62CB5A8A, 0xE8A9AA5A,
+    0x62AA5A8A, 0x5E59191A, 0x5A6941E6, 0x96575703, 0x522841C7, 0xA9682470,
+    0x52694A08, 0xBF6A1A96, 0x42080841, 0x92929347, 0x4ACB2104, 0x6B6F2A15,
+    0x52492945, 0xE8ECEEEF, 0x4A2741A6, 0xBE060641, 0x4A2741A6, 0x1F915000,
+    0x4A0741C6, 0xA4E5F994, 0x4A2841E7, 0x56AB036D, 0x526949E7, 0x545554C0,
+    0x5AAA4A28, 0x4040A4FE, 0x5AAA5248, 0x0555A9EB, 0x62CB5249, 0x0095FAFA,
+    0x62EB5269, 0x40F9FFFF, 0x6B0C62AA, 0x14AAA5EA, 0x6B0B5AAA, 0x006B6B17,
+    0x6AEB5A69, 0xAEAA5601, 0x6B0C5269, 0x15FA9555, 0x6B2C5249, 0x54AAA9E9,
+    0x734D62AA, 0x50A5EAAF, 0x7B8E5249, 0xAE5F5B1B, 0x734C5248, 0xFAA99584,
+    0x62CB49E7, 0xE45A5777, 0x734D5269, 0xE9A9B46A, 0x734D62AA, 0xBAE6E6E8,
+    0x7B8E62CB, 0x55656FB4, 0x7B8E6B0C, 0x682D6910, 0x7B6D6B2C, 0xFFFEBE4A,
+    0x7B6D732C, 0x0BFFE990, 0x7B6D732C, 0xA4AAAF06, 0x7B6D6B2C, 0x6F7F1A69,
+    0x7B6D62CB, 0x196E19AA, 0x734C6AEB, 0x58FEAD42, 0x736D6B0B, 0x816B2640,
+    0x734D6B0B, 0xAAE55491, 0x736D6AEB, 0x6AAB2A05, 0x734C62AA, 0xBABFFE16,
+    0x734D62AA, 0xAABAA7A0, 0x83AE5248, 0xAA9A8BA6, 0x7B8D62CA, 0xD5864695,
+    0x83CE5AAA, 0xAD5455F9, 0x83EF5A89, 0x459A9A9B, 0x83AE62EB, 0x166595FF,
+    0x83CF6B0C, 0x1000565B, 0x8BEF62CB, 0x551226B6, 0x8BEF6AEB, 0x6410A5AB,
+    0x83AE62CB, 0x0595EAA1, 0x83AE5A8A, 0x05AAEBEB, 0x83CF62CB, 0x50ABABAF,
+    0x83AE5249, 0xAFAA6B1A, 0x734C41E7, 0xEB6A0100, 0x62CB41C6, 0x9BE9E4E4,
+    0x732C62CA, 0xE9AA4090, 0x8C0F5249, 0xFCF8F8F8, 0x83AE1904, 0x0B5B1F6F,
+    0x638E1082, 0xBEA95500, 0x736C2124, 0xB5757879, 0x62EB5228, 0x5858489D,
+    0x732C41A6, 0xA8A8A8E8, 0x6B2C5A69, 0xE5E5A4E4, 0x736D62CA, 0x94E1E5E5,
+    0x62EB5249, 0xACECE8E8, 0x62CB5A69, 0x5A1A5EAE, 0x5A8A4A08, 0x4B065656,
+    0x524941C7, 0xE0D0D0A4, 0x5A8A5228, 0xE8D55151, 0x52690882, 0xFF6F0742,
+    0x526918E3, 0xFBD44016, 0x5A8941C6, 0xD4D4A9A8, 0x4A282923, 0xFEA968FE,
+    0x524839A5, 0xFEA550AA, 0x524841E6, 0xFA5055A9, 0x526841C6, 0xFF46555A,
+    0x5A694A07, 0xFA90D050, 0x5A895227, 0xFFEAA964, 0x5AA95248, 0xFFFF5900,
+    0x62AA5228, 0xBF1A0100, 0x62EA5248, 0xFFA94000, 0x62EB5248, 0xFF551569,
+    0x6B0B5228, 0xFE950000, 0x6B2B5227, 0xBF565501, 0x732C5248, 0xFA555400,
+    0x6B0B5248, 0xFF955494, 0x6B0B5A89, 0x9B5590FA, 0x7B4D62AA, 0x90A5A9BE,
+    0x732C5A69, 0x069AFAB6, 0x734D5A69, 0xA96B5745, 0x734D5A8A, 0x96A5A5F8,
+    0x734D62AA, 0xBAA8DA89, 0x734D62CB, 0xEAEA5644, 0x7B8E6B0C, 0xFA656454,
+    0x7B8E6B0C, 0xFBF56451, 0x7BAE732C, 0xAAFF5554, 0x83AE734D, 0x51EA0550,
+    0x83CE732C, 0x55AAFA05, 0x83CF6ACB, 0xAAAFFF05, 0x83AE6ACB, 0xA6ABEF58,
+    0x838E6AEB, 0xAAEAEA01, 0x7B8D6AEB, 0xBFFFFF00, 0x736D62CA, 0x6F6BBB29,
+    0x736C5A89, 0x95BE6F15, 0x736D628A, 0xEABF5554, 0x7B6D62CA, 0xBB565166,
+    0x7B8D62CB, 0xDA8556D5, 0x7B6D62AA, 0x85E4E8FD, 0x7B8D62AA, 0x96DAAB2B,
+    0x7B8D62EB, 0x7BAA6918, 0x736D62AA, 0xABFEAA41, 0x736D62CB, 0x6EAE6D04,
+    0x7B8E62AA, 0xA6BA6515, 0x734C62AA, 0xF9FE91F0, 0x7B8D6AEB, 0xA45541F9,
+    0x7B8D62AA, 0x6A56A62B, 0x7B8D62AA, 0x1266A741, 0x736C5A89, 0x05AA65AF,
+    0x734C62AA, 0xD0AA502A, 0x734C5A69, 0xEFEAAA50, 0x94305A69, 0xFCFCFCFC,
+    0x83CF2124, 0xAF2F0B0A, 0x52EB2104, 0x9600A9BD, 0x734C2124, 0xFFBDB8B5,
+    0x62CA41C7, 0xA8BDA9BD, 0x62AA41A6, 0xB4B8B8B8, 0x732C5A89, 0xD2D29191,
+    0x734D5A89, 0x8191E1E1, 0x6B0C5A69, 0xE494585D, 0x62AA5A8A, 0x19191905,
+    0x5A8A4A28, 0x57575706, 0x526941E7, 0xE6E5E1A0, 0x5AAA5228, 0xF9B9A8A8,
+    0x62CB5249, 0xE6969114, 0x5AAA5248, 0x7BFB968A, 0x5A8949C7, 0x94D4D8D4,
+    0x62AA4A07, 0xFB969554, 0x5A8A5248, 0xFAA0A9A5, 0x62AA5A69, 0xE5404040,
+    0x62CB5269, 0xBB690556, 0x6AEB5269, 0xED554054, 0x6B0B5A8A, 0xFA4054A4,
+    0x732C5AAA, 0xFF405555, 0x732C62AA, 0xFF000515, 0x6B2B5A89, 0xFF554054,
+    0x732C5AAA, 0xFF505090, 0x734C62EB, 0xBF045495, 0x734C5AA9, 0xBA1555EA,
+    0x734C5AAA, 0xFF64A5AF, 0x7B8E6AEB, 0xE9401140, 0x83AE6B0B, 0xFF55A414,
+    0x83CE62AA, 0xFBAA5A01, 0x736C5228, 0xAB06051A, 0x7B8D5248, 0xF9A4A4A9,
+    0x7B8E6B0C, 0xFFA59496, 0x83CF6B2C, 0xAB555641, 0x7B6D6B0C, 0xEB0A5156,
+    0x7B6D62CB, 0xFF15A66E, 0x83AE62CB, 0xEA5050A5, 0x8BCF6B0C, 0xFF150055,
+    0x8BEF732C, 0xFF415055, 0x8C106B0C, 0xFF051559, 0x945062CA, 0xFF450155,
+    0x8C106AEB, 0xFF551414, 0x941062CA, 0xFF550100, 0x94306AEB, 0xFA540014,
+    0x8C0F62CA, 0xFFAA1501, 0x8BEF5AAA, 0xBF554055, 0x83AE6AEB, 0xBF590404,
+    0x83AE6AEB, 0xAB565151, 0x83AE62CA, 0xEA858545, 0x83AE62CA, 0xD99494A8,
+    0x83AE62AA, 0xEBEA9A4A, 0x838E6AEB, 0xBFAA6B26, 0x8BCF734C, 0xFA594445,
+    0x8BEF6B0B, 0xAE9A1514, 0x94306B0C, 0xFB555151, 0x8C0F62CB, 0xFD64A565,
+    0x8BEF6AEB, 0xAF559645, 0x8BEF6B0B, 0xEA545500, 0x8BEF734C, 0xEB955010,
+    0x8BEF6B0B, 0x5B151501, 0x83AE62AA, 0xFA555510, 0x7B8E62CA, 0xEF954094,
+    0x943062AA, 0xE8FCFCFC, 0x9430734C, 0x6B5B5B06, 0x7B4C5A8A, 0x6B6B5A49,
+    0x7B8D62AA, 0xA2A6B766, 0x526839A6, 0xB6B5F8EC, 0x62A93986, 0x71717575,
+    0x6B0C5A89, 0x65A2E2D3, 0x7B6D5269, 0x87864585, 0x6B0C5A89, 0xEDA9A958,
+    0x6AEB5A69, 0x1F1A1E19, 0x62CA5269, 0x17574747, 0x5A8A41E7, 0xD292D296,
+    0x62CB4A28, 0x94E6F6EA, 0x62AA5A8A, 0x41511121, 0x62AA5249, 0xD191B575,
+    0x62CB4A08, 0xC5C4C480, 0x08410000, 0xD0400000, 0x18C30000, 0xB9650440,
+    0x18E30000, 0xFFAA0000, 0x21030000, 0xAFAA0000, 0x20E30000, 0xFEA94000,
+    0x20E30000, 0xFFAA0000, 0x20E30000, 0xFFAA0000, 0x18C30000, 0xFFAA5000,
+    0x20E30000, 0xAFAA0000, 0x18A20000, 0xBFAA0000, 0x20C30000, 0xFEAA0000,
+    0x18A20000, 0xFFAA0000, 0x18C20000, 0xFFAA0000, 0x18E30000, 0xFFAA0000,
+    0x18C20000, 0xFFAA0100, 0x18E30000, 0xFFAA0000, 0x18A20000, 0xBFAA1000,
+    0x18C20000, 0xEFAA4500, 0x18A20000, 0xBFAA1000, 0x18C30000, 0xEAA60000,
+    0x18C20000, 0xFFAA5550, 0x20E30000, 0xFEAA0400, 0x18E30000, 0xAF6A1040,
+    0x21030000, 0xF9A54000, 0x18C20001, 0xFFAA0000, 0x18C20000, 0xFFAA4050,
+    0x18C20000, 0xFBBA1014, 0x20E30000, 0xFEAA0041, 0x18C20020, 0xEFAA0055,
+    0x18C30020, 0xFBAA0054, 0x18E30000, 0xEEAA4045, 0x18C20000, 0xFFAA0400,
+    0x18C30020, 0xFFAA4000, 0x20E30000, 0xFFAA5500, 0x21030000, 0xFFAA5400,
+    0x20E30000, 0xBF6A1540, 0x29440000, 0xFEA95400, 0x29240000, 0xFFAA5500,
+    0x20E30000, 0xEFAA0500, 0x29030000, 0xAFAA0500, 0x21030000, 0xFEAA4501,
+    0x20E30020, 0xFBAA1100, 0x20E30000, 0xAFAA0500, 0x20E30000, 0xFF6A0040,
+    0x20E30000, 0xBF6A0000, 0x10A20000, 0x7F5A0050, 0x10610000, 0x6E6A0040,
+    0x00210000, 0x01000016, 0x9C512924, 0xECFCFCFC, 0x8C3083AE, 0x16151647,
+    0x7B8D62CA, 0x1B1B5B9B, 0x7B8D62AA, 0xD7E2A2A2, 0x6B0B41A6, 0x93929266,
+    0x62CB41C6, 0x74746060, 0x6B0B5228, 0x7C7CBDA9, 0x7B8D3965, 0x0B5B9B9B,
+    0x6B0C5AAA, 0x6CAC9CAD, 0x6AEB5269, 0x6F6F1E2F, 0x62CB5249, 0x56571717,
+    0x5A8A41E7, 0xC6D696D6, 0x5AAA5228, 0xD6DAD1D5, 0x62AA5249, 0x49CA9AAA,
+    0x62CA5249, 0xA5A2E1D1, 0x5AAA3986, 0x2AABABEB, 0x18C30000, 0xE4D0D090,
+    0x316518A2, 0xFABA7824, 0x316520C3, 0xB9A8E8A8, 0x31652904, 0xFBFDAC01,
+    0x41C72103, 0xFAA95554, 0x39A62904, 0xEAA59140, 0x39862904, 0xBABA6A00,
+    0x398620E3, 0xEF9A5641, 0x398620C3, 0xAF6F5A05, 0x31451081, 0x6F6E2A19,
+    0x318520E3, 0xBEAE5844, 0x314520E3, 0xBEAA4000, 0x292420E3, 0xBABAD540,
+    0x314520C3, 0xEBAA5601, 0x294520E3, 0xFAB96400, 0x314520E3, 0x57969A45,
+    0x296518A2, 0xDB965211, 0x210418C2, 0xBDBA5954, 0x290418A2, 0xAB9B5645,
+    0x294418A2, 0xE6E6A551, 0x294418C2, 0x6F6B6B15, 0x294420C3, 0xF8B9A864,
+    0x292410C2, 0x6F2A2B1A, 0x39A610A2, 0xF9A9A8A4, 0x316520E3, 0xBFAA5500,
+    0x316520C3, 0x9B965500, 0x314518A2, 0xBAA6A651, 0x316518C2, 0xF5E5A954,
+    0x292418A2, 0xF7E79B46, 0x294420C3, 0xF6F7A251, 0x314518C2, 0x6E699545,
+    0x294418C3, 0xFEF9E954, 0x316520E3, 0xFAFA9550, 0x39A62924, 0xFFAE5514,
+    0x39A62924, 0xFDA95500, 0x398518A2, 0x7B2A2A26, 0x42072924, 0xFEA95858,
+    0x41E72944, 0xBFAB6915, 0x398520E3, 0xEBAA9641, 0x39852103, 0xABAB5A06,
+    0x318520E3, 0xEA955504, 0x39A62103, 0xEEEA6950, 0x39862103, 0xAEAA9645,
+    0x39A620E3, 0xBFD29040, 0x316520E3, 0xFBEFBF46, 0x29241081, 0xBF6F6A25,
+    0x18C20841, 0xAE9A5A19, 0x10820000, 0x1B1A0605, 0x9C712925, 0xACACECEC,
+    0x8C108BCF, 0x4689C502, 0x7B8D62CA, 0x67171B1B, 0x7B8D62AA, 0xC5D5D6D6,
+    0x734C4A07, 0x67574743, 0x62CA4A07, 0x6B7DB974, 0x736D5A69, 0xE2E6A564,
+    0x7BAE62AA, 0x0506165B, 0x6B0C5AAA, 0x6568686C, 0x62CB5249, 0x2E3E6F6F,
+    0x62CB5249, 0x17171616, 0x5A8949E7, 0xD682C2C2, 0x62EB5228, 0xD6C18185,
+    0x62AA5228, 0x64A59A9E, 0x62EB5228, 0x253565FA, 0x62CB4A08, 0xD4968C19,
+    0x29240000, 0xE4E4E494, 0x39C62945, 0xAEDDA8A4, 0x41E72944, 0xD6A17164,
+    0x39C63165, 0xE8B4A151, 0x41E73165, 0xABA6A2B1, 0x41E73165, 0xEBDB8685,
+    0x42073165, 0x9B975651, 0x41C73165, 0x5AAE9A89, 0x41E73144, 0x7F7A6A1A,
+    0x39A518C3, 0x1F1F1A1A, 0x41C73144, 0x5E1A1915, 0x39852944, 0xBEBE6955,
+    0x31652924, 0xFAB6A550, 0x39A62904, 0x9B464645, 0x39852924, 0xE5F4E4A4,
+    0x398520C2, 0xBEBAFF06, 0x31852103, 0x5F57584D, 0x31452103, 0x5E1A1614,
+    0x292420E3, 0xEAAA9A46, 0x29442103, 0xFDFDFD99, 0x31652103, 0xEAD55606,
+    0x316520E3, 0xA6BAF9B4, 0x314418C3, 0x1A1A1B2F, 0x41E72104, 0xBCBCB8A8,
+    0x39C62944, 0x3B262666, 0x31652103, 0x9BD79B9B, 0x39A62924, 0x7D656121,
+    0x316518C2, 0xF4E5E5E4, 0x318518E3, 0xF5E19191, 0x31842103, 0xFAB5B562,
+    0x31852923, 0x9E4D5D18, 0x31852944, 0x6E5F5F5A, 0x39A63165, 0xFEEA8140,
+    0x4A073985, 0x1B5B9656, 0x41E73185, 0xA979B9B4, 0x41E720E4, 0x393A2A2A,
+    0x526839A6, 0xED999498, 0x524841E6, 0xAF6A5A16, 0x41E73985, 0xDB864241,
+    0x41C63985, 0xEB564602, 0x41C63185, 0xBBAAD680, 0x41C73165, 0xFFEEDDC9,
+    0x41E73145, 0xDA591818, 0x4A073144, 0x5E5B4746, 0x39852924, 0xF46B5295,
+    0x296520E3, 0x4A86D797, 0x20E31082, 0x17161616, 0x10A20000, 0x1B1B1B1B,
+    0x94303165, 0xECECFCFC, 0x94107B8D, 0x1707575B, 0x7B8D6B0B, 0x8F5A6A26,
+    0x7B8D5248, 0xCDC9C9D9, 0x83AE5A89, 0x46171716, 0x734C41C6, 0x8B8B9B9A,
+    0x736C5249, 0x90D1E1E2, 0x6B0C62AA, 0xB0B5A858, 0x62CB5A8A, 0x571B0B7A,
+    0x62CB5269, 0x7A6B6A2E, 0x62AA5228, 0x67272727, 0x5A8949E7, 0x8581C192,
+    0x62AA4A28, 0x919692D6, 0x5A8A5249, 0x55101458, 0x62CB4A28, 0xABA62626,
+    0x6B2C41C6, 0x91D4D4D9, 0x31650000, 0xE4E4E4A4, 0x4A083165, 0x79685418,
+    0x4A072924, 0x6E9E9ACA, 0x42073165, 0x27679A99, 0x4A2839A6, 0xA6E5D841,
+    0x4A2839A6, 0xBF6A1555, 0x522839A6, 0x1E2F1E46, 0x41E73165, 0xBE6E2E1A,
+    0x41E739A5, 0x1666767A, 0x41E618A3, 0x2E2E2E1A, 0x41E73165, 0x565A4A1E,
+    0x39C63165, 0x15171B55, 0x39863165, 0x55504080, 0x41C63185, 0x99DA9E5A,
+    0x41C63144, 0xE5E59590, 0x42072923, 0xBA691515, 0x39A620E3, 0xBAA8A855,
+    0x31652104, 0xAB955526, 0x29442103, 0xBFAA55A9, 0x31652104, 0x6A4A9554,
+    0x39A52103, 0x98D4A4AA, 0x31652103, 0xA6E6A5A5, 0x316518E3, 0x1A1F1A5A,
+    0x4A072924, 0xADACACBC, 0x41E63164, 0x6A6A5A2B, 0x39A52944, 0xEA9ADA86,
+    0x39A62924, 0xBDB9A8A8, 0x41C62103, 0xB8F8B490, 0x39A62903, 0x7AA6A6A1,
+    0x39A52923, 0xFC6EF5A5, 0x39A62944, 0xAF594949, 0x39A63145, 0x27295C18,
+    0x41E72945, 0xF8EEEAA9, 0x52483985, 0xA65A1F1A, 0x4A083985, 0xFDB97454,
+    0x41E718C3, 0x3F3A3E7A, 0x5A8A4A08, 0x9BABDA98, 0x52694A27, 0x5666AB6B,
+    0x4A073985, 0xEA4697DB, 0x4A0741C6, 0x79647945, 0x4A073986, 0xAAB57536,
+    0x4A2839A6, 0xA7661656, 0x4A283985, 0xEAE6D685, 0x4A083144, 0xB5E64646,
+    0x4A073144, 0xAB6A9AA1, 0x39A620E3, 0x5F1B4A0A, 0x31651082, 0x17161616,
+    0x18A20000, 0x1B1B1B1B, 0x9C503145, 0xECACACAC, 0x94307B6D, 0x263A2B1B,
+    0x7B8D6AEA, 0xCB9B1F8B, 0x734C5248, 0x1E5E8ECE, 0x7B8D62A9, 0x42464756,
+    0x734C39A6, 0x96878787, 0x62CA4A07, 0xA8A8F9F9, 0x732C5A8A, 0xF4B4B5A0,
+    0x62CB5AAA, 0xE8AA6A6F, 0x62CB5A89, 0x6B3B3A2B, 0x62CB5249, 0x65571617,
+    0x524941E7, 0x92C6C6CA, 0x5AAA49E7, 0xA2A6E6E5, 0x62AA5249, 0xE7661B01,
+    0x62EB41A6, 0x86DAEAEA, 0x6AEB3165, 0xA1E2E2E2, 0x31650000, 0xA4E4E4E4,
+    0x526939A6, 0xD4909454, 0x52483165, 0xBB762514, 0x4A073965, 0xE8EABB37,
+    0x52493986, 0xBC6C5955, 0x52484A08, 0x7E1B2E6A, 0x5AAA39A6, 0x782D2919,
+    0x4A083185, 0x786969A9, 0x4A0839A6, 0xAD854505, 0x4A0720E3, 0x565B1A1A,
+    0x4A283185, 0x97160501, 0x41E73165, 0x57510000, 0x31852924, 0x7F5B2F7F,
+    0x39C63164, 0x796A3D6E, 0x4A073165, 0x64657565, 0x41E63165, 0xBAA76725,
+    0x42072924, 0xB9A55511, 0x31652924, 0x560150A1, 0x31652904, 0xAD2D2D29,
+    0x41E63164, 0x25B8A090, 0x39A52924, 0x1D2D1465, 0x31652104, 0x5450B5A5,
+    0x292418E3, 0x263A3A3F, 0x4A2839A6, 0x5A5E5D5C, 0x41E73185, 0x2A6A6F2F,
+    0x41C63165, 0x7A1B1601, 0x41E73144, 0x7C7D7968, 0x41C72124, 0x69F8FDB8,
+    0x4A283165, 0x2D2A6ABA, 0x41E72924, 0x2E6D7C79, 0x41E63185, 0x67565617,
+    0x41C73185, 0xE9AA6616, 0x4A283986, 0xD5D59494, 0x5A6941E7, 0xAB766255,
+    0x522841C6, 0x9A6E5958, 0x4A2718C3, 0x3E3F2A2A, 0x62EB5249, 0x66171601,
+    0x5A894A28, 0xBE6A5A15, 0x524841E7, 0xBEAA5601, 0x4A2841C6, 0xEFBAA555,
+    0x522841C7, 0xB5858440, 0x52694A07, 0x769C5801, 0x5A8941E7, 0x1D192A55,
+    0x62CA39A6, 0x5B555550, 0x4A2839A6, 0xF86E86C2, 0x41C73165, 0x1B166A09,
+    0x316518A2, 0x17061617, 0x10A20000, 0x1B1F1F1B, 0x9C512944, 0xFCFCFCFC,
+    0x94106AEA, 0x3A7BBBBA, 0x7B8D62CA, 0x49465B9B, 0x734D5248, 0x363A3A2A,
+    0x734C5268, 0xD4A95A96, 0x62EA4A07, 0x61929393, 0x62EA41E7, 0x64B8B9B9,
+    0x734C5A89, 0xE0E0F1F5, 0x62EB5A8A, 0x2B1B5AA9, 0x62CB5A69, 0x1A2E6E7F,
+    0x62AA5269, 0x26267575, 0x526941E7, 0xFAAA5581, 0x52494A08, 0xD0A693A3,
+    0x62AA5249, 0xD2C2D292, 0x5A892904, 0x5F5B0B5B, 0x62CA3165, 0xE1D1D1E1,
+    0x21040000, 0xF4F4F4E4, 0x4A283185, 0xACADEDE9, 0x526941C7, 0xDBD7D352,
+    0x52693986, 0x2659D9D4, 0x526941A6, 0xB7E6E5A8, 0x5A6939A6, 0xFAB8BCBD,
+    0x526949E7, 0x66737679, 0x4A083985, 0x96979525, 0x4A283165, 0xACADADAE,
+    0x4A272924, 0x5A5B0706, 0x528A41E7, 0x57165641, 0x4A073985, 0x5B564602,
+    0x39C63165, 0xAFAAD584, 0x42072944, 0x6E296969, 0x39C63185, 0xBB656579,
+    0x41E73164, 0x2B2B2B7A, 0x4A072924, 0x64B8B8B8, 0x39A52944, 0x15555607,
+    0x39853144, 0x99AD6944, 0x39853144, 0xFEBB3621, 0x31852924, 0x7F7F192D,
+    0x29252904, 0x95A5A5B5, 0x292418C3, 0x7E3A2A2A, 0x420749E6, 0x97975757,
+    0x42063985, 0x9B5B1A1A, 0x41E72924, 0x2A2B3B7A, 0x41E62944, 0x2E6D7D7C,
+    0x39A620E4, 0xC0804055, 0x4A273164, 0x5B1A1E2E, 0x4A073144, 0x8B4F5F1E,
+    0x42073985, 0x061B6B56, 0x42073165, 0x74B5F5E9, 0x5A8A39C6, 0xE5E5D490,
+    0x5A8A4A28, 0x561B5B5A, 0x52694A07, 0x2E2A1A55, 0x52481903, 0x6E2E2E3E,
+    0x6AEB5A69, 0x2B161726, 0x62CB5268, 0x6B6B5A15, 0x5A894A27, 0xBE7E2A69,
+    0x524949E7, 0xEF5A0556, 0x5A8A4A08, 0x6B2A6410, 0x5A8A5228, 0x2A2A6270,
+    0x62CA4A07, 0x67978659, 0x62AA41E7, 0x59544507, 0x5A8A41C6, 0x5F5A5551,
+    0x49E72924, 0x57161666, 0x316518A2, 0x0B161617, 0x18C30000, 0x1B1B1B1A,
+    0x9C712944, 0xFCFCFCFC, 0x94304A07, 0x3B3B3B3E, 0x734C3164, 0xFDFCE8FD,
+    0x7B6D5248, 0xA2B67777, 0x734C4A27, 0x404090D4, 0x6B0B41C6, 0x74746065,
+    0x5A6949E7, 0xACA9A4A8, 0x734C5A69, 0xF5F1E1E1, 0x6AEB5A8A, 0x796A2A26,
+    0x62AA5A69, 0xAF5F1E1A, 0x62AA5249, 0xBBA62626, 0x5A694A08, 0x6B2729B5,
+    0x52492924, 0xF9F4F4F9, 0x62AA5249, 0xAAEFE692, 0x5A8A3986, 0x4B4B5B4A,
+    0x62CA3145, 0xE1E1E1E1, 0x31450000, 0xE4E4E4A4, 0x4A082944, 0xB9B8F8F8,
+    0x5A8A4A07, 0x6C498A9A, 0x5AAA3986, 0xA7676626, 0x62AA49E7, 0xD8995222,
+    0x5A894A07, 0xA2B6FAE5, 0x52694A07, 0xA6ABA762, 0x4A083986, 0x17475695,
+    0x4A072945, 0x9295A5B9, 0x41E62944, 0x5E4F4E4E, 0x5A8A4A28, 0xABEA6A16,
+    0x526941C6, 0x5B560602, 0x49E739A6, 0xBE691404, 0x41E73985, 0x6B565256,
+    0x4A073986, 0x57925212, 0x4A073164, 0x6B2B3A2B, 0x39852903, 0x869F59AA,
+    0x31852944, 0xAFE6A696, 0x39852924, 0x64B4A9A9, 0x39852924, 0x14AA56AF,
+    0x31652924, 0x296A9696, 0x29242104, 0x41419797, 0x294418E4, 0xAFAA6A2A,
+    0x528949E6, 0x464B0605, 0x4A0739A6, 0xA2A28383, 0x42072924, 0x5D5D1D1E,
+    0x4A072944, 0x6F6A2A2E, 0x41E62104, 0xE5E0D0C0, 0x41E739A6, 0xCB9F975B,
+    0x4A283985, 0xDBD79646, 0x41E73165, 0xAE1D5F5B, 0x4A483985, 0xA5B46454,
+    0x5AAA41C7, 0xF5F5A1D1, 0x5A695228, 0x7601551B, 0x5A8949E7, 0x5F1E1A19,
+    0x5A892945, 0x1F1F1E1E, 0x6B2C5A69, 0x5B0B0B1B, 0x6AEB5A68, 0x6F2B2B6B,
+    0x62CA4A28, 0x5E1A1919, 0x52695228, 0x95E4A995, 0x5A8A5249, 0x599AB534,
+    0x5AAA5248, 0xDAD98591, 0x62AA4A28, 0xA9642177, 0x62CB5248, 0x2969A9D5,
+    0x62CB49E7, 0x2E1A1A1A, 0x4A073144, 0x171B2616, 0x292418A2, 0x5B5A4B0B,
+    0x18E30000, 0x2B2B2B2B, 0x9C713165, 0xFCECFCFC, 0x94305A69, 0x2B3B3B3A,
+    0x6B2B4A07, 0xF8F9FDAC, 0x732B5248, 0xA7B3E3A3, 0x5A6941C6, 0x96D2C195,
+    0x732C39A5, 0x7975B5B4, 0x5A8941E6, 0xE9F9EDEC, 0x7B8D62A9, 0xA4E5E5E1,
+    0x62EB5A8A, 0x29796A2A, 0x6AEB5A89, 0x1E0A1A59, 0x62CB5269, 0x7A6A2666,
+    0x52695228, 0x131A0D0E, 0x524941E7, 0xE5E999A8, 0x62AA5A69, 0x23231256,
+    0x5A8A41A6, 0x5707070B, 0x62CA3185, 0xD1D1E1E1, 0x29240000, 0xE4E4E4E4,
+    0x4A283165, 0xE1E5F5F4, 0x5A8A39A6, 0x6578786D, 0x5A8941E7, 0x8889AAA7,
+    0x5A8A3985, 0x9898ADE9, 0x52693985, 0xB8BD6AA6, 0x524949E7, 0x92D1D0E0,
+    0x4A283165, 0x1B2B2B2B, 0x41E73145, 0x996662A3, 0x42072945, 0x5E5E1D1E,
+    0x6B0C5269, 0x17565500, 0x5AAA49E7, 0x1A6B5757, 0x522841E7, 0xA6FBDA85,
+    0x522839C6, 0x6A5B5616, 0x4A2839C6, 0x56979B57, 0x522839A5, 0x1B1A5646,
+    0x39C62104, 0x5A45469B, 0x39C62924, 0x786864A5, 0x39A52924, 0x0055A9B9,
+    0x29442104, 0xAC68569B, 0x42072924, 0xE5A45410, 0x62AA2103, 0xBEAA5540,
+    0x4A272104, 0x1F1F1A05, 0x4A4841C6, 0x1A6FBFEA, 0x420739A6, 0x357566A6,
+    0x4A272924, 0x87979A9A, 0x4A2739A6, 0xAFAB5B2F, 0x4A283985, 0x6FAF5A50,
+    0x4A073165, 0xCBDBCBCA, 0x4A2841C6, 0x52529797, 0x420739A6, 0xFADA8A89,
+    0x4A2839C6, 0xB8B8B9A5, 0x5A8941E7, 0xF9B9F4F4, 0x5A895248, 0xC6C5D576,
+    0x5A8941E6, 0xAB5A1A5F, 0x5A892104, 0x2F2F5F5F, 0x6B2C5AAA, 0x46565B1B,
+    0x62CB5A89, 0x656A7F3F, 0x62AA4A07, 0x47475B5B, 0x5A8A5248, 0xB4E495D5,
+    0x62CA5A69, 0xBF696E58, 0x62CA5269, 0x6F7B2B6F, 0x62CA5A89, 0xBEBFBBD4,
+    0x5A8A4A08, 0xBE0A066A, 0x62AA4A08, 0x2839793C, 0x4A083165, 0x16161717,
+    0x292418C3, 0x4B464242, 0x18E30000, 0x2B2B2B2B, 0x9C713986, 0xFCFCECFC,
+    0x945062CA, 0x2B2B2B2B, 0x734C4A27, 0xA4A8F8F4, 0x734C5AA9, 0xE0FAF7A2,
+    0x62EA49E7, 0x9B6B5702, 0x736C5268, 0x57662520, 0x62CA4A07, 0xD4945454,
+    0x7B8D5268, 0xA8E5E9A5, 0x62CB5A89, 0x859A9F6F, 0x62AA5A8A, 0x5501055B,
+    0x62EB5A69, 0x5B1A1A6A, 0x5A895228, 0x4B06056A, 0x62AA4A08, 0xD5959490,
+    0x6AEB5249, 0x1B1B2762, 0x5A8A39A6, 0x06060707, 0x62CA3985, 0xE1E1E0E0,
+    0x29240000, 0xE4E4E4E4, 0x52493185, 0xD5D4E4E5, 0x5A8941C6, 0xF6F1B1B1,
+    0x5A8941E7, 0x291898C8, 0x5A8A41C7, 0x67A69584, 0x5AAA41C7, 0x47429594,
+    0x524941A6, 0xA9A4E9E8, 0x4A283985, 0x2F6B6A6E, 0x41C72944, 0x94555A6C,
+    0x42062924, 0x5F1A1A4B, 0x62CA3985, 0x054069FA, 0x5AAA2103, 0x95A469AF,
+    0x52482945, 0x9A1655FB, 0x52693165, 0x46A4FEBF, 0x5A6939C6, 0x6E6B4505,
+    0x4A283985, 0x6F56464B, 0x4A272103, 0x2B2E2E1A, 0x39A62104, 0x5E29697E,
+    0x41C618C3, 0xFEA55554, 0x5A892924, 0x65A5E0E0, 0x62CB49E7, 0xD8E8AE45,
+    0x62CB5269, 0x1B575F4D, 0x5A892104, 0x1B1B1B1B, 0x524839A6, 0xABAB5B1A,
+    0x4A2741C6, 0xAA8F4BA7, 0x52492924, 0xF8E1A185, 0x52483165, 0xE1ABAE9A,
+    0x52483165, 0x869BAFEB, 0x4A283165, 0x9A9B8A87, 0x4A2841C6, 0x55525253,
+    0x420739A6, 0x1296BAAA, 0x4A073985, 0x6469F9BD, 0x62AA4A07, 0xB9B8A479,
+    0x62AA5A69, 0xB5B45510, 0x62CA4A07, 0x474B4B46, 0x5A683166, 0x1B1F1F1F,
+    0x6B0C62AA, 0x0342031B, 0x62EA5A89, 0xD58152A5, 0x62CA4A28, 0x16574743,
+    0x62CA4A27, 0xF4E5A5E5, 0x6AEB62AA, 0xE96111A6, 0x62CB5A69, 0xFFEBDA8B,
+    0x6AEB5A8A, 0x55DA9A15, 0x6AEB5A8A, 0x519B9BFE, 0x62CB5228, 0x3B272565,
+    0x4A282945, 0x2B171717, 0x290418A2, 0x171A1919, 0x20E30000, 0x2B2B2B2B,
+    0x94303165, 0xF8FCFCFC, 0x942F5248, 0x06175B2F, 0x736C4A27, 0xA5A4E5D4,
+    0x7B6C5268, 0xBEA9A450, 0x6B0B5228, 0x545596C6, 0x6B0B5248, 0x61A6AAAB,
+    0x62CA41C6, 0xDCDCD8D9, 0x734C5A68, 0xE4E4E4E5, 0x6AEB5A89, 0x4657A795,
+    0x62AA5A69, 0x692A65BA, 0x62EB5A69, 0x26666A6B, 0x5A895228, 0x1055895F,
+    0x5AAA4A08, 0xC1D1E1D5, 0x6B0B5248, 0x2A16971A, 0x52693185, 0x474B5B5B,
+    0x62AA39A6, 0xE4E5E1E1, 0x29240000, 0xE4E4E4E4, 0x4A283185, 0xE8E9E9E9,
+    0x5A894A07, 0x92A2E5E1, 0x52493986, 0xBB6B2A7A, 0x5AAA41A6, 0x69662627,
+    0x5A8939A6, 0x2A2B5B57, 0x524941C7, 0xA3622525, 0x52483985, 0x6A6B2F2F,
+    0x41E72944, 0x869695D4, 0x52482924, 0x4A4A4E5E, 0x5A8941C6, 0x165A5B16,
+    0x4A273185, 0xF9FEAB45, 0x4A073985, 0xAAABEA2E, 0x39C62944, 0x4AFF9FBE,
+    0x4A283165, 0xE9B9A5A4, 0x5A8941C6, 0xAE65190A, 0x52893164, 0xAA6E5A1A,
+    0x41E73145, 0xFFAA15D0, 0x4A073164, 0xE9EAA4B9, 0x5A8A41C7, 0xFAEAA954,
+    0x6B0C5249, 0xF5A59180, 0x6AEB5269, 0x06555A1B, 0x5AA92945, 0x0F0B0F0B,
+    0x52894A07, 0xD6961151, 0x52682944, 0x2F2F7F7F, 0x4A282924, 0xFBFFBEB8,
+    0x52482904, 0xEE5A55E4, 0x62CA20E3, 0x5B1A5542, 0x4A283985, 0x8B8A9A96,
+    0x4A0741E6, 0x86566565, 0x4A2839A6, 0x79756261, 0x526941C6, 0x06475915,
+    0x62CA4A28, 0xF9B8A8A9, 0x62CA5269, 0xFDB9B6B2, 0x62CA5228, 0x97A69681,
+    0x62A93165, 0x4E0E1A1A, 0x6B2C62AA, 0x66260716, 0x6B0B5A89, 0xFA959495,
+    0x5AAA5248, 0x43969767, 0x6AEB5249, 0xE4F9B9F4, 0x6B0B62AA, 0x2969E8F9,
+    0x734D62CB, 0x5D595005, 0x734D5A69, 0x96470A11, 0x6B0C5A8A, 0x47978050,
+    0x6AEB4A28, 0x1A2A175B, 0x52493165, 0x566B1617, 0x294510A2, 0x17171717,
+    0x20E30000, 0x161A2B2B, 0x8BEE3165, 0xBCFCFCFC, 0x83CE4A08, 0xAB93571B,
+    0x7B6C62CA, 0xF5A96491, 0x736C4A07, 0x2B2F7E7F, 0x6B0B3986, 0xB8B8A9A9,
+    0x6AEA5268, 0xAB8A8655, 0x62CA41A6, 0xA6A9D8DC, 0x732B5A68, 0xA0F4F4F4,
+    0x62CA5A69, 0xAEAF9B86, 0x62CB5A69, 0x286D6864, 0x62EB5249, 0x66171727,
+    0x5A894A08, 0xE1E595A5, 0x62CB5228, 0x90A591D1, 0x6B0B5248, 0x66676727,
+    0x5A693165, 0x1B1B5756, 0x526839A5, 0xC591A0F5, 0x29040000, 0xE4A4A4E4,
+    0x4A283165, 0xB9B8A8E9, 0x5AA941C6, 0x478786D6, 0x5AAA41E7, 0xD2A5A661,
+    0x5AAA41C7, 0x989C9D68, 0x526939A6, 0xECA8A869, 0x524839A6, 0xA8FAEBD7,
+    0x526939A5, 0x7F2F2E6A, 0x41E72103, 0x5282D2D6, 0x52482945, 0x1F4F4B4F,
+    0x5A8939A5, 0x9A5B5B1B, 0x4A273985, 0xAE9A95A4, 0x524841C6, 0xD1D1A455,
+    0x524839A6, 0xA66F6A15, 0x52482944, 0xFABA5550, 0x526939A6, 0x5D8455A8,
+    0x4A273985, 0xEABAAB2E, 0x52682903, 0xBF2E6AA5, 0x4A4839A6, 0xAAACADD5,
+    0x5A8941E7, 0xE5E4A5F6, 0x6B0B5A89, 0x6969A4B8, 0x62CA5269, 0x42966A5B,
+    0x5AA93165, 0x8F4B0B0F, 0x5A894A07, 0x16579787, 0x52482924, 0xDE0B1F1F,
+    0x526939A6, 0xEA955119, 0x5AA93165, 0xEBFEE580, 0x5A893986, 0x57838246,
+    0x4A2841C6, 0x63978B8B, 0x4A4841E7, 0x5E5C4844, 0x4A4841C6, 0xDF9E5D68,
+    0x526941C6, 0xE6961511, 0x62CA5269, 0xAFAEE9E8, 0x6B0B5A89, 0xBDB9B4A4,
+    0x62CA5A69, 0x6BA6A283, 0x6AEB3165, 0x0F0F4F4E, 0x734C62AA, 0x03535666,
+    0x6B2B62CB, 0xE5A5EA50, 0x62EA4A27, 0x1B171756, 0x6B0B5228, 0xA4A4E4E4,
+    0x6AEB5249, 0x455A6EBF, 0x6AEB5268, 0x4695EAFE, 0x732C5249, 0x549095EA,
+    0x734D5A89, 0x13034242, 0x62CB4A08, 0x1E2D6E6A, 0x5A693165, 0x97576716,
+    0x31651082, 0x17171616, 0x10820000, 0x2B2B2B2F, 0x8BEE3986, 0xFCFCFCFC,
+    0x83AD62CA, 0xCA8A8A97, 0x734C62AA, 0x64B4BAF6, 0x7BAD5248, 0x9B5A5A1B,
+    0x732B41C6, 0xE7E5B4B8, 0x7B6C4A06, 0x0116ABAB, 0x6AEB4A07, 0xA8AA5716,
+    0x734C5A69, 0xA6BAB6A1, 0x62CB5A8A, 0x83431B08, 0x62AA5269, 0x6F6E6A7C,
+    0x62AA5A69, 0x2E2E2F36, 0x5A694A28, 0x92565BE5, 0x5A894A07, 0x2625B5B5,
+    0x62CA4A07, 0x061566BB, 0x5A893185, 0x1B1A5F1F, 0x524839A5, 0xE6E1A1D4,
+    0x29450000, 0xE4E4E4E4, 0x52493165, 0xF4B8A869, 0x5A8941E7, 0x1D5A4A47,
+    0x62CB41C6, 0x8B879392, 0x526941C6, 0x65B9ECEC, 0x5A8941E6, 0x1296D9D8,
+    0x52283165, 0xBEBAF9E8, 0x5A6939A6, 0xA762667A, 0x4A072944, 0xAF665653,
+    0x4A282924, 0xDEDE8A5B, 0x4A2849E7, 0x4BDFC087, 0x524841E6, 0xAE5A1605,
+    0x4A2739C6, 0x629195FE, 0x52484A07, 0x619C2A3A, 0x52483185, 0x8A9FAABB,
+    0x528939A6, 0xE4A8582D, 0x524839A6, 0x579190D1, 0x5A694A27, 0x616A1B52,
+    0x524841C6, 0xBAA9A4BB, 0x5A6941E7, 0xA4E5F5B4, 0x62CA5249, 0xBC98E86D,
+    0x5AA95248, 0xEBD196FA, 0x5A892924, 0x8B8F8F8B, 0x52484A06, 0xBB7F3B7B,
+    0x5A8A4A07, 0x76E69541, 0x62CA41C6, 0x6DA9B6A2, 0x5A894A27, 0x56829B9B,
+    0x5AA941A6, 0x86478716, 0x4A2841C6, 0xB5A0A056, 0x4A4841E7, 0x561B2B1F,
+    0x526941E7, 0x82969687, 0x62EA41E7, 0xD0D0D090, 0x62EB5A89, 0xEAEA6A16,
+    0x732C62AA, 0xB9696858, 0x6AEB5A8A, 0xB5A55224, 0x732C2945, 0x4B4B4B4E,
+    0x6B2B5A89, 0x2657A657, 0x6B2B5A89, 0xF4F9FAE9, 0x6AEA5248, 0x06060717,
+    0x6AEB5228, 0xB8B8B8A9, 0x5A8A5249, 0x694504DA, 0x5A8A5248, 0xAA5B1656,
+    0x62CA5248, 0x05D9E9EF, 0x6B2C5A69, 0xA0629297, 0x62EB49E7, 0x5E11172F,
+    0x526941C7, 0x79050287, 0x4A2810A2, 0xBEBE1606, 0x39860000, 0x1B1A1515,
+    0x8C2F39A6, 0xECFCFCFC, 0x83CE6AEB, 0x5F8BCACA, 0x7B6C6289, 0xE9A4A4B4,
+    0x7BAD62AA, 0xC5D6D69B, 0x7B8C5A89, 0x0A064647, 0x6AEA41A5, 0xE1E0E1A7,
+    0x62CA41C6, 0xBAB9B8B8, 0x6B0B5A89, 0x91E1E6E1, 0x62CB5A89, 0xFAF7E7D3,
+    0x62AA5A69, 0x6A292E6F, 0x62AA5269, 0x25797A6A, 0x52494A27, 0x558686D6,
+    0x526949E6, 0x6E2B6B6B, 0x62CA4A27, 0x5D595546, 0x52693186, 0x161A1B1B,
+    0x524839A5, 0xF1A6E6E6, 0x31650000, 0xE4A4E4A4, 0x52282944, 0xE5E0E5E4,
+    0x5AAA41A6, 0x793D3D29, 0x62EB41E7, 0x0D5A5A4A, 0x52693985, 0xA3367666,
+    0x5AAA39A6, 0x692B2753, 0x5A8941C6, 0x9593A652, 0x52494A07, 0x145EAA53,
+    0x4A283165, 0xAF9A998A, 0x4A283144, 0xC6C5C989, 0x5A894A07, 0x76555501,
+    0x5A694A07, 0x091B0A05, 0x524839A5, 0x9AAFAA91, 0x5AAA4A07, 0x66195A17,
+    0x524839A5, 0x6E9A9E8A, 0x4A4839A6, 0xC293D1D5, 0x526841E6, 0xD5919257,
+    0x62C94A07, 0x76A4A450, 0x522841C6, 0x12156A7E, 0x524841C6, 0x905050F4,
+    0x62AA4A08, 0xA96868AD, 0x5A895248, 0xFA50A0FB, 0x52682104, 0x8B8B8B8B,
+    0x5A894A28, 0x52D69656, 0x62CA5228, 0x894C1830, 0x62CA39A6, 0x1A2A6B6F,
+    0x52693165, 0x9090A5EB, 0x5A8941C7, 0x97565242, 0x524839A5, 0xEEA4A9A5,
+    0x52484A07, 0xCBE29241, 0x4A4841E7, 0xB9371242, 0x6AEB41E7, 0xE5E4D0D0,
+    0x62CB5A89, 0xBADB469A, 0x6B0C62AA, 0xAA1A28BC, 0x6B0C5AAA, 0x646979A0,
+    0x7B6C2945, 0x4B4B4B4B, 0x6B0B5AA9, 0xB5A5B629, 0x734C5A89, 0xA6EAA9A4,
+    0x6B0B5268, 0x06474206, 0x6AEB4A28, 0xE4F4F4B8, 0x5A8A5249, 0x9A6C1855,
+    0x62AA5249, 0x5AE94445, 0x5A8A4A08, 0x0B1A1905, 0x62CB4A28, 0x0659A5E8,
+    0x62EB4A08, 0xEA7D5919, 0x5A8A41A6, 0xA7652565, 0x41E73165, 0x6A64697D,
+    0x31650000, 0x1B2B1B1B, 0x8C0F39A6, 0xECECECEC, 0x8C0F736C, 0x6FAF6B1A,
+    0x7B8D62A9, 0x4191D5D5, 0x7B8D5228, 0x4A85DAD6, 0x7B8D3165, 0x1F0F1B6B,
+    0x6B2B2945, 0xA4E5F9E9, 0x62AA5228, 0xBE9DA4A1, 0x6AEB5A69, 0xF0A1A1A1,
+    0x62CB62AA, 0xA0A1F1F1, 0x5AAA5A8A, 0x1415191A, 0x5AAA5268, 0x66667676,
+    0x52474A28, 0x59595959, 0x52684A07, 0xEB6B6B2E, 0x62AA5248, 0x47460908,
+    0x4A073165, 0xAEAE2A5B, 0x526841C6, 0xC9A960A0, 0x31650000, 0xA4A4E4E4,
+    0x52493145, 0xA4A490E0, 0x5AAA49E7, 0x78B4B975, 0x62CA41A6, 0x6EAE6D2D,
+    0x62CA41A6, 0x97975753, 0x5A893985, 0xACECDCA9, 0x524941C6, 0x5CADE995,
+    0x52694A27, 0xB262A5A4, 0x4A0741C6, 0x12255A4A, 0x52682924, 0xCADBDBC6,
+    0x62AA5248, 0x26766A16, 0x52694A07, 0x5FAC58A9, 0x52694A07, 0x5E6A0605,
+    0x52484A07, 0x6A16127B, 0x524841E6, 0x7E2DACAD, 0x4A4839A6, 0x0A4A9BC7,
+    0x4A4839A6, 0x65A1AAA7, 0x524839A5, 0x6879B9BA, 0x522739A5, 0xA66A1B6B,
+    0x4A2739C5, 0xD6E5E4E5, 0x5A895248, 0x5D9EED78, 0x52684A07, 0x4707976F,
+    0x52482124, 0xDBCBCB8B, 0x5A895248, 0xEBA56051, 0x5A894A27, 0xA2B7979E,
+    0x5A894A07, 0xF4904207, 0x52493965, 0x43929191, 0x5A6941E7, 0x415292D3,
+    0x524841E7, 0x8DA8ADA9, 0x52484A07, 0x68E8EADB, 0x4A2841E7, 0xB8A45165,
+    0x62CA4A07, 0xF9F4F4F4, 0x6AEB5A89, 0xE5A5B665, 0x732C62CA, 0x296A6B96,
+    0x6AEB62AA, 0xEDA8B8B8, 0x7B4D2924, 0x8B4B4B4B, 0x732C62AA, 0x7F6B6621,
+    0x6B0B62CA, 0xBFEB97BA, 0x62EA5248, 0x87875757, 0x6AEB5228, 0xE6E5E0E0,
+    0x6AEB5249, 0xFEEF9A45, 0x62CB5269, 0xFFEA9511, 0x62CB4A08, 0xAFBB2505,
+    0x5A6941C7, 0xAFAAD541, 0x62CB5269, 0xBD7E1998, 0x5AAA4A08, 0xBBBBA7A3,
+    0x41E739A6, 0x0F0F0B0B, 0x31650000, 0x1B1B1B1B, 0x8BEE39A6, 0xECECFCEC,
+    0x8C0F734C, 0x25297E6F, 0x734C62CA, 0x13161651, 0x734C4A28, 0x9BEBAB2B,
+    0x7B6D3165, 0x6B6E6E1E, 0x6B0C2924, 0xFEAEF9E8, 0x62EB5248, 0xF9ACA5A6,
+    0x6B2C5269, 0xD0A094A4, 0x6AEB5A8A, 0x7672A1A1, 0x5A8A5A69, 0x66A7ABBE,
+    0x5A8A5248, 0x2A2A6A7A, 0x52484A07, 0x8A4A9AD9, 0x52694A27, 0xD685D9DA,
+    0x5AAA5228, 0x51564647, 0x4A0839A6, 0x8895E595, 0x52883165, 0xE4E5E599,
+    0x29240000, 0xE4E4E4A4, 0x4A282924, 0xE9E9F8F8, 0x5AAA41E7, 0xB4B4B9B8,
+    0x62CA5228, 0x28286D1E, 0x62CA5228, 0x56424742, 0x62CA41E7, 0x9898D988,
+    0x5A8941A6, 0xA8BDAC5C, 0x5A894A07, 0x9652D7E7, 0x4A2739A5, 0xEB562A6B,
+    0x52482924, 0xCAC6C5CA, 0x5A894A07, 0x91A2F6FA, 0x5A894A28, 0x57060602,
+    0x52484A07, 0xAF1F6F6A, 0x52694A07, 0xD0566969, 0x526841E6, 0xE2A56579,
+    0x5A893985, 0x2E2E1A1A, 0x4A073165, 0x40556AEF, 0x4A2739A5, 0xAF5F1D69,
+    0x522741C6, 0x66120617, 0x4A2741E6, 0xD6EA9594, 0x5A894A27, 0x68783D7E,
+    0x52484A07, 0x0B4B86C2, 0x52482924, 0xCBCBCB8B, 0x5AA949E7, 0x64A9EA9A,
+    0x5AAA5228, 0xC50D0C04, 0x62CB41E7, 0x1AAAAEA9, 0x5A892944, 0x90869757,
+    0x4A2839C5, 0xA2E7BBF6, 0x4A4839A5, 0xA8A5A9AE, 0x4A4841E7, 0x445C2C2D,
+    0x4A4841E7, 0x10B6ADAC, 0x62CA41E7, 0xA5F8B9B9, 0x732C62AA, 0xD0D49540,
+    0x7B6D62AA, 0x53561615, 0x6B0B62AA, 0xECD8D9ED, 0x734C2104, 0xCB8B8B8B,
+    0x7B6D6AEB, 0x5B495955, 0x734D62CA, 0x5E6F2A65, 0x62CA5248, 0xFEFA96CB,
+    0x6B0C5A8A, 0xB5F9D1C1, 0x732C62AB, 0xF9291969, 0x7B6D5A69, 0xFA651155,
+    0x734D5A8A, 0xEB594404, 0x734D4A08, 0x1B165641, 0x62CB4A08, 0x94959ABE,
+    0x62CB5269, 0xDA965151, 0x5A6939A6, 0x6B170606, 0x31650000, 0x1F1F1B1B,
+    0x942F39C7, 0xACACACAC, 0x83AE732B, 0xD3929A6A, 0x734C62CA, 0x4B874203,
+    0x7B6C5A68, 0xF6A75A1A, 0x6B2B4A07, 0x2B26242A, 0x6B2C4A07, 0x454156EA,
+    0x6AEB5228, 0x8A983476, 0x734C5A69, 0xD4C4D4D0, 0x6B0C5AAA, 0x35357161,
+    0x5AAA5A69, 0xA5753535, 0x5A8A5228, 0x6A2B2B2B, 0x52484A07, 0x8A5B5B8B,
+    0x5A694A28, 0x418585C1, 0x52494A08, 0x4A5A6A7B, 0x42083165, 0x2A6969BD,
+    0x5A893986, 0xE4E9A8D8, 0x29440000, 0xE4E4E4E4, 0x52493185, 0xE4E4E4A4,
+    0x5A8A4A07, 0xF1F1B5B4, 0x62EB5228, 0x6C686868, 0x62EB4A48, 0xCACAD696,
+    0x5A8A41E7, 0xC8DDDDD8, 0x526941C7, 0xEC6CBCB8, 0x5AAA41E7, 0x85C5CADA,
+    0x524841A6, 0x9C9495D6, 0x52692103, 0xC6CA899A, 0x5A894A27, 0xD5A55550,
+    0x5A894A27, 0x1E5D5A1A, 0x52694A07, 0x3A2A2A2A, 0x52484A07, 0xD05959E6,
+    0x524841E6, 0xE1E19156, 0x5A6941C6, 0xB9796919, 0x4A072944, 0xEA965590,
+    0x524841C6, 0x0E0E1A5A, 0x522741E6, 0x17126266, 0x4A2749E6, 0xFEF99595,
+    0x5AA94A27, 0xFAB96964, 0x526949E6, 0x6B6B1A1A, 0x62EB2924, 0xC6864686,
+    0x6B2B41A6, 0xABAF6D15, 0x62CA4A28, 0xEBD6D2C1, 0x62EB4A07, 0x156A6B5B,
+    0x52683185, 0xE9AA9580, 0x4A2841C6, 0xA55152A3, 0x526939A5, 0xBF995494,
+    0x5A8939C6, 0xBF585455, 0x4A0739A6, 0xBE6742A9, 0x5A893986, 0xF469A5E6,
+    0x7B8D49E7, 0x6AF0BA6A, 0x734C5A8A, 0x6A646567, 0x732C62AA, 0xEE98A898,
+    0x734C2124, 0x8BCBCB8B, 0x7B6D732C, 0x19D8A011, 0x734C5A8A, 0x9142172F,
+    0x732C62AA, 0xF6F9A550, 0x7B6D5A8A, 0x111AAFF9, 0x736D5249, 0x0544AABF,
+    0x7B6D5249, 0x5450456E, 0x7B6D5A8A, 0x5055A0F9, 0x730C5228, 0x0506162B,
+    0x62EB41E7, 0xE5905595, 0x62CB4A08, 0x5B154096, 0x5A8A41C7, 0x1A1A6A6B,
+    0x39C60000, 0x1B1B1B1B, 0x940F41E7, 0xFCECACAC, 0x8BEF732B, 0x579783C3,
+    0x734C62CA, 0x691D1D0E, 0x734C5AA9, 0x461642E1, 0x6B0B4A07, 0x42061B2F,
+    0x6B2B5248, 0x58A8E8E8, 0x62AA4A27, 0xEDA4B197, 0x732C5A69, 0x62639294,
+    0x6AEB5A8A, 0x252A7A7A, 0x62AA5A69, 0x3B7E7878, 0x5A694A28, 0x3E6E6A6A,
+    0x524841E7, 0x161A6E7E, 0x5A694A07, 0xC4C18585, 0x5A8A41E7, 0x2B7F6A1A,
+    0x41C73185, 0x1E5A5968, 0x5AA939C6, 0xE4E4E4D4, 0x31450000, 0xE4E4E4E4,
+    0x52693985, 0xA4E4E4E4, 0x5AAA4A08, 0xE2E2E2E2, 0x6AEB4A28, 0xF5B5B4B8,
+    0x62CA4A28, 0x1D5D8D89, 0x5A894A07, 0xB3E6E5D8, 0x5AAA41C6, 0xDBDA8594,
+    0x5A6941C6, 0xA9EC9DA9, 0x526941E7, 0xA7BB6918, 0x52682924, 0x8ACACAC6,
+    0x62AA4A48, 0xEAA8A475, 0x5A894A28, 0x1A1B6F6F, 0x52694A07, 0x29296D6D,
+    0x52484A07, 0xAF9B4A06, 0x526841C6, 0x91D1D190, 0x526949E6, 0xB9B9BDA8,
+    0x4A2741E6, 0xD3E79A9A, 0x4A2841C6, 0x9A9E4F4F, 0x4A2741E6, 0x4393E3A7,
+    0x5A6941E6, 0x94E4E590, 0x62CA5228, 0xD4E5E591, 0x5AAA5248, 0x6A2B6F19,
+    0x62EA2944, 0xCADACAC6, 0x62EB5268, 0x95465A5F, 0x62CA5228, 0x1420A0F5,
+    0x526839C6, 0x0B4B5B5B, 0x5A694A07, 0xD4D19044, 0x5A6949E7, 0x172A2524,
+    0x5A694A07, 0x90D498E8, 0x62AA5248, 0xA4AAEA5E, 0x5A894A07, 0x17576B2A,
+    0x6AEB49E7, 0xA9F8E490, 0x734C5A89, 0x90E5E6E6, 0x736D62CB, 0x287DBEA5,
+    0x734C62CB, 0x8A9FAFAE, 0x734C2104, 0x8B8B8B8B, 0x734C41E6, 0x19556ABB,
+    0x6AEB5228, 0x404594E4, 0x736D5A89, 0x79A85416, 0x6AEB5249, 0x5FABA62D,
+    0x5AAA4A08, 0x6F460A5B, 0x62CB49E7, 0xB9E51586, 0x6AEB41C7, 0x4E6FBEAA,
+    0x62CB4A08, 0x164069E7, 0x62CB49E7, 0xC1A6B9E4, 0x62AA3124, 0xEF5A1A16,
+    0x52493165, 0xAF965464, 0x41C70000, 0x1B1B1A16, 0x942F4208, 0xBCBCBCBC,
+    0x8BCF6ACA, 0x1B5B9B9B, 0x83AD62CA, 0x57525165, 0x6B2B5A88, 0xA66E6E29,
+    0x6B0A49E6, 0xAFAB9642, 0x6B0A41A6, 0x4B1F1E6E, 0x6B2B4A07, 0x71B1E5D5,
+    0x732C5248, 0xE9ECA8A5, 0x62CB5269, 0x292A7A7A, 0x62CB5A69, 0x1A1B2B2B,
+    0x62AA4A28, 0x2E2E2929, 0x4A2841E7, 0x0D191916, 0x5A8A4A07, 0xE4D49595,
+    0x5AAA41C7, 0x2F2F2E2A, 0x41E73165, 0x2A691C1D, 0x62CA3985, 0xE4E8E8E8,
+    0x31450000, 0xE4E4E4E4, 0x52283185, 0xE4E4E4E4, 0x62CA4A07, 0x95D6D2D2,
+    0x6B0B5249, 0x95A1B1B1, 0x62AA49E7, 0x2A3E2E6E, 0x5AAA41E6, 0x27266666,
+    0x62CA41E7, 0x16575797, 0x5A8A4A07, 0xA4741408, 0x5A6941C6, 0xABAB9651,
+    0x52682944, 0xCADBCA8A, 0x62CA5269, 0x144091A6, 0x5AA94A28, 0x6F6F5B1A,
+    0x52694A28, 0x2A2E6C18, 0x5A694A07, 0x2A3A7969, 0x524841C6, 0x8595D081,
+    0x5A894A07, 0xB5B47525, 0x4A283164, 0x2F5A9AAA, 0x4A2739A5, 0x449AEAAE,
+    0x4A2741C6, 0x46478292, 0x4A2841C6, 0x1568A4E5, 0x5A894A07, 0x80E5E5E9,
+    0x62AA5248, 0x66761515, 0x5AAA3165, 0xC6C6CACA, 0x5A894A27, 0x2B6B6BFF,
+    0x5A8949E7, 0x2D999C6C, 0x52683165, 0x5450575B, 0x52484A07, 0x878AC4C9,
+    0x52484206, 0x6A6A5A6B, 0x52684A07, 0x9192E1D1, 0x5A894A27, 0x18686EFA,
+    0x524841E6, 0x95D5DA5F, 0x5AA95268, 0xA5AA5FAD, 0x6B0B5A89, 0xF5B5B5A0,
+    0x734D62CA, 0xABAE6D2D, 0x736D62CB, 0xA5D1D185, 0x7B8D2104, 0x8B8B8B87,
+    0x732C5247, 0xFBFF5A19, 0x6AEB5248, 0xBEFEE990, 0x6B0C5228, 0xE62A1AFA,
+    0x62CA41C7, 0xDE8A57A2, 0x6AEB3124, 0x662959EF, 0x6B0C41C7, 0x4A8554AB,
+    0x5A8A3986, 0x4448AAAE, 0x5A8A41A6, 0xFCC606AE, 0x5AAA3965, 0x9E2A3695,
+    0x52693145, 0x229796FB, 0x52693185, 0x6F6DAC6A, 0x41C70000, 0x1A1B1B1B,
+    0x942F4208, 0xA8ACACAC, 0x8BEF732B, 0xABAB6B1B, 0x8C0F4A07, 0x2B272766,
+    0x736C5248, 0x4B4B9392, 0x6B0B4A28, 0x066BAAAA, 0x62CA39A6, 0x6965968B,
+    0x6B0B4A07, 0x9E592925, 0x6B2C5A69, 0x9192A7DA, 0x62AA5A89, 0x566A3A3A,
+    0x62CB5A89, 0x5615161B, 0x5AAA4A28, 0x1A2E2E2F, 0x4A2841E7, 0x5A59091D,
+    0x62AA4A08, 0x9494D4D4, 0x5A8A41C6, 0x1A1A6F2F, 0x4A283185, 0x16171B16,
+    0x62C939A6, 0xA9E5E5E4, 0x29440000, 0xE4E4E4E4, 0x4A083145, 0xE8E8E5E5,
+    0x5AAA4A07, 0x4499D9D9, 0x62EB5248, 0xD4D5E6EA, 0x62AA4A07, 0x67623666,
+    0x5AAA49E7, 0xE9692A26, 0x5A8941C6, 0x6D6A2A67, 0x62EB41E7, 0x97868190,
+    0x5AAA4A07, 0x546A1752, 0x52892924, 0xC6CBCAC6, 0x5AAA5248, 0xA97D3E29,
+    0x62CA5228, 0x1B1A0A06, 0x52694A27, 0xBEAA6959, 0x5A894A07, 0xBAA56465,
+    0x522841C6, 0x4682C2C6, 0x5AA94A07, 0xD6E2E2F1, 0x4A472924, 0xAB571ABE,
+    0x4A272944, 0x6FAEF8AE, 0x4A4741C6, 0x994A4B46, 0x524841C6, 0xEAA66514,
+    0x52684A07, 0xEE4540C0, 0x62CA5228, 0xBAA55151, 0x5A893185, 0xC7C6C6C7,
+    0x5A894A27, 0x2B6B2B2B, 0x62EA41E6, 0x0B16173A, 0x4A283165, 0xA6E7E6E1,
+    0x52694A07, 0xD9440105, 0x52484A07, 0x58181919, 0x52484A07, 0xA56091E2,
+    0x524841C6, 0x591D1E6E, 0x524841E6, 0xBDF9E490, 0x62CA5A89, 0x06EFEA00,
+    0x732C5269, 0x6574B474, 0x734D6AEB, 0x8B4A0A4E, 0x7B6D6AEB, 0xF5F5E5A4,
+    0x7B6D2144, 0xC787878B, 0x734D6AEB, 0xADA465A5, 0x734D62CB, 0x2F2A1955,
+    0x6AEB5A69, 0xE9FEB987, 0x6B0C5228, 0xBF7E3E19, 0x6B0C3986, 0xEFBF3B37,
+    0x62AB2904, 0x79299E9B, 0x5AAA3125, 0x7C9B665D, 0x5A893986, 0x40FF65E5,
+    0x6AEB3965, 0x6ED66992, 0x52493145, 0x9EB8E78D, 0x526939C6, 0x6E5E1967,
+    0x39A60000, 0x1B1B1B1B, 0x9C704A07, 0xACACA8A8, 0x8BEF7B8D, 0xD69A252A,
+    0x8BEE5268, 0x6A6B2B2B, 0x736C41C6, 0x1D1E6E6E, 0x52483165, 0x8695A69B,
+    0x62CA41C6, 0x874A1929, 0x6B0B5228, 0x9393C6CA, 0x6AEB4A27, 0xA9A8A8E5,
+    0x62CB5A8A, 0x4084C800, 0x62EB5249, 0x17175766, 0x5AAA4A07, 0x2A2A2F6A,
+    0x4A0741E7, 0x1515169B, 0x5A8941E7, 0xE4A4A4D9, 0x526939A6, 0x5A5F2F6F,
+    0x41E73145, 0x56564617, 0x5A8941E7, 0xE5E5E594, 0x31650000, 0xE4E4E4A4,
+    0x52482924, 0x959090E4, 0x5A894A07, 0x74A8EC99, 0x62CB5228, 0x8ECAC6C0,
+    0x6B0B5228, 0xE7A69653, 0x6B0B4A08, 0x9A9594D0, 0x62EB5248, 0xC6855414,
+    0x62AA4A28, 0xA854A5D6, 0x5A894A28, 0x25B8AD58, 0x52892924, 0xCACACACA,
+    0x62EB5269, 0xF5E59594, 0x62EA5228, 0x1F1F1F1B, 0x52694A28, 0x2979A8EA,
+    0x5A895228, 0x28287879, 0x4A2841C6, 0x1A5A1A47, 0x5A8A4A07, 0x80D0D0D5,
+    0x526839C6, 0x565B4746, 0x4A0739A5, 0x56916A5B, 0x526849E6, 0x4D404149,
+    0x524849E6, 0x7D68A993, 0x5A894A07, 0xD594E8D5, 0x62CA5A89, 0x53012776,
+    0x5A893186, 0xD7D6C7C7, 0x5A894A27, 0xABBB6B2B, 0x62CA4A07, 0x56464207,
+    0x5A8939A6, 0x46475746, 0x52694A07, 0xA9565AD8, 0x526841E6, 0xAD5D4799,
+    0x524849E7, 0x864651D4, 0x526941E6, 0xBEA9A950, 0x5A895228, 0x07061614,
+    0x62CA5A69, 0x8B8B870A, 0x6B0B5A69, 0xE8E4A565, 0x736D6B0B, 0x12165A9B,
+    0x7B6D6B0C, 0xA4A4A5E1, 0x7B6D2124, 0xC7C787C7, 0x734D6AEB, 0x70B666A9,
+    0x734D6AEB, 0x54945A2B, 0x6B2C628A, 0xBE2A5645, 0x732C62AA, 0xEAE8C45A,
+    0x734D5229, 0xA7265989, 0x6B2C3124, 0x2D9EEBA6, 0x7B6D3965, 0xAEAA0691,
+    0x62EB49E7, 0xFF5504FA, 0x62CB49E7, 0x57BEE495, 0x62CA4A28, 0x5A28A657,
+    0x524939C6, 0x6B6F6E2B, 0x39A60000, 0x1B1B1B1B, 0x9C914A28, 0xACAC6C6C,
+    0x8BEF734C, 0x61A6A7E6, 0x83CE6B0B, 0x6B6B2616, 0x734B41C6, 0x3E2D2D6D,
+    0x5A683985, 0xD5824142, 0x6AEB3985, 0x52828287, 0x62CA49E7, 0x6C7976B3,
+    0x6B0B5A89, 0x96CBD695, 0x62CA5269, 0x47175656, 0x62CB5249, 0x12171717,
+    0x5A8A41E7, 0x1B2E2F2F, 0x4A0741C6, 0x7A54565B, 0x5A8941E7, 0x94A4E4D4,
+    0x522841C7, 0x0A0E191A, 0x39C63185, 0xE6DADAD7, 0x5A894A07, 0xF4A5A5A5,
+    0x31650000, 0xE4E4E4E4, 0x4A073165, 0xB49484C0, 0x5A694A07, 0xB1A1A4B8,
+    0x6AEB49E7, 0x2D6A5E9A, 0x6B0B5248, 0x8A8B9B96, 0x62CA5249, 0x37372756,
+    0x6B2C41E7, 0x5B879796, 0x62EB41E7, 0x6B2F2564, 0x5AAA4A07, 0x5B564112,
+    0x62EB3144, 0xC5C5C6C6, 0x6B0B5AAA, 0x55061150, 0x62EA5248, 0xAB1B5F2F,
+    0x5A895228, 0x66590104, 0x62CA5248, 0x54E09414, 0x5A6941E6, 0x1A175606,
+    0x5A694A07, 0x8180C0C0, 0x526941E6, 0x5B5A0B06, 0x4A4741C6, 0x2A257535,
+    0x524841A5, 0x9D999A8E, 0x5A8941E6, 0x6BAF9855, 0x5A894A28, 0x9080D080,
+    0x62EA5248, 0x5A575742, 0x62AA3185, 0xD6D68282, 0x5A694A28, 0xCA9A9696,
+    0x5AA94A07, 0x4B1B1B5B, 0x52483165, 0x86469797, 0x526941C6, 0x95A4A9AE,
+    0x52484A07, 0x040569AD, 0x52284A07, 0xA8899485, 0x5AAA5228, 0x042C2C68,
+    0x5A894A27, 0x561A5B5B, 0x62EA5A89, 0xDADBDA96, 0x6B2C5A89, 0xE9E8E8E8,
+    0x734C62CB, 0x929797A7, 0x7B6D6B0B, 0x61B5B6A6, 0x7B8D2965, 0xC3C3C7C7,
+    0x6B0C62CA, 0xAEA5DCEA, 0x6B2C62CB, 0xE696673B, 0x734C5A8A, 0x9B1B5A5A,
+    0x732C5A8A, 0x2969E499, 0x732D62CB, 0x165A8DC7, 0x734D5228, 0xAAE7E574,
+    0x6B2C41C7, 0xBEAF5790, 0x6AEB4A08, 0x9B4510A6, 0x62CB4A08, 0x0B2FB8A5,
+    0x62AA4A28, 0xAB5A2592, 0x524939A6, 0x162B1E2A, 0x39860000, 0x1B1B1B1B,
+    0x94504A28, 0xACBCACAC, 0x8BEF732C, 0xB4B8A4B4, 0x940F6AEA, 0x2A6B6B6B,
+    0x7B8C4A07, 0x5F6F2E2E, 0x5AA939A5, 0xE6E1E1E5, 0x62AA3985, 0x72726262,
+    0x6AEB41E6, 0xDDDDD8A8, 0x6AEB62A9, 0xA5A8D4A0, 0x5AAA5249, 0x52526107,
+    0x62AA5248, 0x571B5B6B, 0x5A8941E7, 0x1A5A5A1B, 0x4A2841E7, 0x35162222,
+    0x524941E7, 0xD49894D4, 0x4A2841E7, 0xDADA4B0B, 0x4A283165, 0x0656D695,
+    0x5A894207, 0x5998A8E4, 0x31650000, 0xE4E4E4E4, 0x41E73165, 0xA8E8F8B8,
+    0x526949E7, 0x95E5F5B1, 0x62AA4A28, 0x7979793D, 0x6B2C5269, 0x1C1C5949,
+    0x6B0B5249, 0x87576726, 0x62CB4A08, 0x6D6E6B1B, 0x62CB4A08, 0xC7829717,
+    0x5AAA41E7, 0x6D080456, 0x62EB3985, 0xC5C5C5C5, 0x6AEB5AAA, 0x26671712,
+    0x62EA5269, 0x6E1B5B09, 0x5A895248, 0x0A15116B, 0x5A895248, 0xB9B8696A,
+    0x52694A07, 0x6B5B0615, 0x524841E6, 0x9687C787, 0x526939A6, 0x1A1A1A5B,
+    0x4A273185, 0xF8F8F9FA, 0x522741C6, 0x3D1DA8D6, 0x52484A07, 0x181A6A14,
+    0x5A684A07, 0x9191D590, 0x5AA94A27, 0x1A5EAE9F, 0x62CA3186, 0xD2D2C6C2,
+    0x62AA5248, 0xC4408181, 0x62CA49E7, 0x5546470B, 0x5A693165, 0x6F968242,
+    0x524841E7, 0xEAD195A8, 0x526841E6, 0x6A9B8A5D, 0x5A894A06, 0xD8D5E5A4,
+    0x5A895248, 0x15000168, 0x5A694A27, 0x86569B56, 0x62CA5A89, 0xC699CB9A,
+    0x6B0B62AA, 0xE0B1F5E9, 0x734C62EB, 0x5797E6D2, 0x7B6D62EB, 0xA4B4B575,
+    0x7B6D2924, 0xD2D3D3D3, 0x734C5A8A, 0x1A5BAB9A, 0x734D62CB, 0xD4A4AAE5,
+    0x7B6D62CB, 0x97975717, 0x734D6AEB, 0x96A5EB44, 0x734C62AA, 0x4D6A6653,
+    0x7B6D5249, 0x96A9BA2A, 0x6B0C5249, 0x6F1B4199, 0x62AA41C7, 0xE74196EF,
+    0x5AAA4A08, 0x2BBEE592, 0x5A8A49E7, 0x0A28296B, 0x522839A6, 0x161F5A59,
+    0x31850000, 0x2B1B1B1B, 0x940F4207, 0xBCBCBCBC, 0x8C0F734C, 0xBBF5F4F4,
+    0x8C0F62C9, 0x17171B2B, 0x7BAD39A5, 0x07074B4B, 0x62EA41E6, 0x2C5C8581,
+    0x5AA93985, 0x67272722, 0x6B0B49E7, 0xA4E8E9D9, 0x732B62A9, 0xFAE9A8A4,
+    0x5A8A4A28, 0xF9A4A4F5, 0x62AA5249, 0x07172A17, 0x526941C6, 0x1F2F5F1B,
+    0x4A2841C6, 0x793D2975, 0x526941E7, 0xE5D0D4D4, 0x52694A07, 0x91818181,
+    0x42073165, 0xFBEA5B1B, 0x52694A07, 0x6A561716, 0x29440000, 0xF8F4E4E4,
+    0x41E73165, 0xE4E4B8F9, 0x526841E6, 0xACACADED, 0x62CB5269, 0xB0A0B474,
+    0x6B0B4A28, 0x6C7C2C2C, 0x62EB5248, 0xDD8E8ADB, 0x62AA4A28, 0xAEE9A87D,
+    0x62CA5228, 0x1D598AC7, 0x5A8941C6, 0x266B6F6F, 0x6B0C3185, 0xC1C5C5C5,
+    0x732C62AA, 0x15155557, 0x6B0B5A89, 0x191869BA, 0x5AA95228, 0x6A651F46,
+    0x5A894A28, 0x51A9F9FE, 0x62AA4A07, 0xBAAA2A1A, 0x5AA941E6, 0xA7565155,
+    0x526941C6, 0x9A8B4646, 0x526839A6, 0xABA7A160, 0x526841C5, 0x7A7A2B39,
+    0x524841E6, 0x64B469AE, 0x52484A07, 0x561251E6, 0x5A684A07, 0xE4A4692E,
+    0x62CA39A6, 0xD2D2D1C1, 0x5AAA5228, 0x898984D4, 0x5A894A27, 0x86A6D285,
+    0x5AAA3145, 0x067E6F6F, 0x5A8941E7, 0xD9E8E99A, 0x524849E6, 0xD7EAD68A,
+    0x5A894A07, 0x85DA95D5, 0x5A894A07, 0x5A5E195A, 0x5A694A07, 0x94D59055,
+    0x62CA5A89, 0x94818559, 0x732C5AA9, 0xE4D49494, 0x734C6AEB, 0x8AD59217,
+    0x7B8D6AEB, 0x5165B8A8, 0x7B6D2924, 0xD2D2D2D2, 0x736C5A8A, 0xAB9B1A06,
+    0x7B6D62AA, 0xE4E5A494, 0x7B6D62CB, 0x57AF6A52, 0x734D6AEB, 0xA5B8641A,
+    0x732C6AEB, 0x840221FE, 0x734D5A8A, 0xA9AD2E5B, 0x6B0C4A08, 0x0611AA7F,
+    0x62AA3986, 0x5165AAFB, 0x5A894A08, 0x6560824B, 0x524939A6, 0x6425A79F,
+    0x4A0739A6, 0x19190A13, 0x31650000, 0x2B2B2B2B, 0x8C0F4A08, 0xFCFCFCFC,
+    0x8C0F83AD, 0x5F2F6F6B, 0x83CE6B0B, 0x86565617, 0x736C41C6, 0x51525307,
+    0x5AA93965, 0x2B2B2A29, 0x62CA41C6, 0x88854657, 0x62CA41E6, 0xACACACA8,
+    0x734C62CA, 0xAAAB93A2, 0x5AAA5268, 0x56A6F5F4, 0x62AA5228, 0x195A1A1B,
+    0x5A8941C6, 0x1A1A1B1B, 0x4A0839C6, 0x5869A9B9, 0x526949E7, 0x61A1B1B4,
+    0x52694A27, 0xA7AB6691, 0x52893186, 0xE1E1D191, 0x5A8941C6, 0xC6D7A76B,
+    0x29440000, 0xF8F8F8F8, 0x41C62944, 0xF4F9F9F9, 0x524841C6, 0xE8ECACAC,
+    0x62EB4A28, 0xE0E0A1A1, 0x6AEB4A28, 0x68A8A86C, 0x62CB4A08, 0x686CACED,
+    0x6B0B5249, 0x2766A296, 0x62AA4A28, 0x7A69692C, 0x5AAA41E7, 0x9A976327,
+    0x6B0C3185, 0xC5C5C5C5, 0x6AEB5AAA, 0x86969BAB, 0x6AEB5A89, 0x5B1B1A1A,
+    0x5AAA5268, 0xE5D595A5, 0x5AAA5248, 0xAA6B1B12, 0x62CA5269, 0xA1AAABA7,
+    0x5A895228, 0xA7929253, 0x52694A07, 0xA5A1E786, 0x5A694A07, 0x6E5A5A06,
+    0x5A894A07, 0xD1865611, 0x52694A07, 0xAEAE6964, 0x524849E6, 0x5F5B4B9B,
+    0x524849E6, 0xE95A1AAA, 0x5AAA39A5, 0xE6E5E1D1, 0x5A895248, 0xC4C9C9C9,
+    0x6B0B5227, 0x30A19480, 0x6B0B3165, 0x56465B17, 0x6AEB4A08, 0xE5AA9A5C,
+    0x62AA4A07, 0xAAAA5B46, 0x5A894A27, 0x8591E5D0, 0x5A894A07, 0xB4A8A9AE,
+    0x52484A07, 0x2465AAEA, 0x62CA5A89, 0xF8F8E4D4, 0x732C62AA, 0xB4D0E4A8,
+    0x734D62EB, 0x999B4A09, 0x7B8D6B0C, 0xD091A110, 0x7B8E2124, 0xD2D2D2D2,
+    0x7B6D6B0B, 0x56571B5B, 0x732C62CB, 0xD1D5A8E8, 0x7B8D6AEB, 0x6A6A0B5B,
+    0x7B6D6AEB, 0xD091E1A5, 0x732C6ACB, 0x1B078B05, 0x6B0C5A69, 0x8B87A7E2,
+    0x6B0C4A28, 0x5B5B5B0B, 0x5AAA41E7, 0x6BAAAA45, 0x52493986, 0x875B2F7F,
+    0x4A2841C6, 0xF7EADE9C, 0x524839C6, 0x575A1615, 0x31650000, 0x1B2B2B2B,
+    0x8BEF4A27, 0xFCFCBCBC, 0x8C2F83AE, 0x47978B4A, 0x8BEE6AEA, 0x4686CACA,
+    0x62EA4A07, 0x9FAEA854, 0x6B2B41C6, 0xA9BE6B16, 0x526939A5, 0xA9ED9C8D,
+    0x6AEA4A07, 0xE5F9AD6C, 0x732B5AA9, 0x84D9E9AA, 0x5A8A5249, 0x0A6FABA6,
+    0x62AA5248, 0x0A1B1A16, 0x524841C6, 0x2F2F1F1F, 0x4A0841C6, 0xA4282864,
+    0x4A2841C6, 0x56A1E1D2, 0x5A894207, 0xD9B9A529, 0x5A893185, 0xB6E1E1E1,
+    0x52694A07, 0xD1D59595, 0x31650000, 0xE4E4E4F4, 0x4A283165, 0x91D1E0A0,
+    0x526941A6, 0x60A5A5E4, 0x62CA4A28, 0xD6D6E6A2, 0x6AEB5248, 0xA1A1B570,
+    0x62EB4A08, 0x75787878, 0x62CB5228, 0xA9AA6A3A, 0x5AAA5249, 0xE6D79624,
+    0x5AAA4A28, 0x8A1D5A87, 0x62EB3145, 0xC6C5C6C5, 0x62EB62AA, 0xA6968585,
+    0x6AEB5A89, 0x2ABEAE2A, 0x62AA5A89, 0x36070591, 0x6B0B5248, 0x27165959,
+    0x62EB5249, 0xABBAA652, 0x62CA5248, 0xA7F7A71B, 0x5A8A4A28, 0xBDB8A4D1,
+    0x5AAA5248, 0x3D3D7A0A, 0x5A894A28, 0x08999B47, 0x52694A07, 0xAAFEFD98,
+    0x52694A27, 0x6B3F2A44, 0x62AA4A27, 0xA4E4E4A4, 0x5AA939A6, 0xE7E7E793,
+    0x5AA949E7, 0xE5F4FE5F, 0x62CA4A07, 0x6DBDBCE9, 0x52693986, 0x5A5A4B47,
+    0x6AEA5248, 0x1166A5E5, 0x6AEB5248, 0x5494D8D8, 0x62AA5228, 0x59474745,
+    0x52694A08, 0xF4F4F8B9, 0x52684A27, 0xE7B7D346, 0x6AEB5268, 0xE8ACE9F9,
+    0x732C62AA, 0xE5E0A4A0, 0x7B6D6AEB, 0x5EAE6918, 0x736D5AA9, 0x065BAAEA,
+    0x7B6D2104, 0xE1D1D2D2, 0x7B6D6AEB, 0x6F6F6B2B, 0x732C6B0C, 0xBAAA96F9,
+    0x7B6D6B0C, 0x692A1E1E, 0x732C6B0B, 0xE2E7EBEB, 0x734D62CB, 0x0945465B,
+    0x62EB5269, 0xE7F5A52A, 0x62CB41A6, 0x0B5AAEFE, 0x5A8939A6, 0x0065BAAB,
+    0x52483985, 0xB8F4E592, 0x522841C6, 0x78787572, 0x4A0739A6, 0x5B5A6B1B,
+    0x31850000, 0x2F2F2F2F, 0x8BEF41E7, 0xE8ECFCFD, 0x8BEF730B, 0x3A6A6B6A,
+    0x8BEE62A9, 0x67272626, 0x736C4A26, 0x0B5B5B5A, 0x62C93145, 0xD1A1EBFF,
+    0x5A8939A5, 0x93A77732, 0x6AEA41C6, 0xF8A8E9E5, 0x732B62CA, 0xEAD94568,
+    0x5AAA5249, 0x5B5B0706, 0x5A8A4A28, 0x5F1F1E1A, 0x524841E6, 0x1B2B2E2F,
+    0x4A0739C6, 0xF1F5F9F5, 0x4A2741C6, 0x26265657, 0x524941C6, 0x6568A4E6,
+    0x524820E4, 0xFEEAE4F5, 0x5A8941E7, 0xD5D5D4D5, 0x31650000, 0xE4F8F8E4,
+    0x49E73185, 0xD4D49595, 0x4A2839A6, 0xF9F5F5B0, 0x5ACA5248, 0x955499C9,
+    0x62CA5269, 0xB592A3A2, 0x62CA4A28, 0xE6E2A2A5, 0x62CB5248, 0xD49494A8,
+    0x5A8A5249, 0x94A99DF8, 0x62CA4A28, 0x1505995D, 0x6B2C3145, 0xC1C5C5C5,
+    0x6B0C62AA, 0xA7A26151, 0x62EA5A89, 0x8BEBBE5A, 0x62CA5269, 0x064BBEF9,
+    0x62EB5269, 0x6919F92C, 0x736D39A6, 0x51A9AEAB, 0x6B0B5A69, 0xB9A61713,
+    0x6AEB4A08, 0x5B1B1B5A, 0x5A894A07, 0x7A352A6E, 0x526941E6, 0x5464B9AE,
+    0x526941C7, 0x014496AB, 0x526841E7, 0xF594FEFF, 0x62CA5248, 0x91A5D050,
+    0x62EA39C6, 0x62676752, 0x5A8949E7, 0xFF6A2665, 0x62CA3165, 0x5B5B1B2E,
+    0x4A283185, 0xADECE9EE, 0x62CA4A07, 0x16272626, 0x5AAA5228, 0x3B6BBABA,
+    0x62CA4A28, 0x5956195C, 0x52694A07, 0xACACBDF8, 0x5A895228, 0x56465A92,
+    0x62EB5A89, 0xF9A9A8A8, 0x732C62CA, 0xE8D5A9AD, 0x734D6AEB, 0x9DED5B4B,
+    0x6B2C62AA, 0x2BBAAA07, 0x7BAD2104, 0xE2E2D2D2, 0x83AE6AEB, 0x1F1A2A6A,
+    0x734C62EB, 0xE8F9AAAA, 0x7B8E734C, 0x69755919, 0x732C62CB, 0x9568B8EA,
+    0x734C5269, 0x2A6A6B6E, 0x62EA5248, 0xD1D1D2E7, 0x62EA5248, 0x5B6E6E1F,
+    0x5AA93145, 0xAB424111, 0x524839A6, 0x1F2F2E6D, 0x4A2841C7, 0xA2577F3D,
+    0x4A0839A6, 0x53175707, 0x39860000, 0x2B1B1B1A, 0x8C0F4A07, 0xBCACACEC,
+    0x83AE732C, 0x58282839, 0x8BEE6AEA, 0x46460713, 0x736C39C5, 0x5A5A5B1B,
+    0x52472944, 0x2F5A86D1, 0x62EA39A6, 0x5A524392, 0x734C41A6, 0xA0A4B9B5,
+    0x734C6ACA, 0x94AA9F5A, 0x5A8A5269, 0x5B5B5B5B, 0x5A895248, 0x4F0F0F0F,
+    0x524841E6, 0x2B2B2B1B, 0x4A0741C6, 0xF9F5F5F1, 0x4A2739A5, 0x2B6B6B6B,
+    0x4A2841C6, 0x59D8D8E5, 0x52693986, 0xA4A4B8A8, 0x5A8941E6, 0xE8D4E5D5,
+    0x39850000, 0xE4E4E4E4, 0x49E73985, 0xE9E9D494, 0x4A2841E7, 0xFEAEEAA8,
+    0x62CA5228, 0x2425D5D5, 0x6AEB4A08, 0x5E4A86AA, 0x6AEB5269, 0xD6969191,
+    0x62CB5249, 0xAAD5C5C0, 0x5AAA5228, 0x7E6A6868, 0x5AAA49E7, 0x2B6B1A16,
+    0x630C3165, 0xC5C5C5C5, 0x6B0B62AA, 0xE69BAAEA, 0x6B0B5249, 0x96869B5B,
+    0x6B0B5A69, 0xEE565514, 0x734C5269, 0xF6A555A4, 0x6B0B3985, 0xBFAFAF07,
+    0x62EB3985, 0xEABA55D0, 0x6B0B4A07, 0x41455B9B, 0x5A8A39A6, 0x60854FBF,
+    0x732B41C6, 0x94A9E4A9, 0x5AAA4A07, 0x965AAE06, 0x62CA4A28, 0xA9F9B5A4,
+    0x62EA5A69, 0xC0D08182, 0x6B0B4208, 0x87839253, 0x5ACA5248, 0x6A297969,
+    0x5A8941A6, 0x2F2F2B6F, 0x41E739A6, 0xD69A1A5F, 0x524941E7, 0xE6A55156,
+    0x62CA5248, 0x36372736, 0x62EA4A28, 0x5717165A, 0x5A894A08, 0x4594D4AD,
+    0x62AA5248, 0xC4805010, 0x6B2C62CA, 0xE99998A8, 0x734D62CB, 0xE8945898,
+    0x7B6D62CB, 0x9E5F6E1A, 0x7B6D6AEB, 0x1AF5F520, 0x83CE20E4, 0xD2E2D2E2,
+    0x83AE62CA, 0x5E1E2F2B, 0x7B8D5A8A, 0x95D0D495, 0x7B8E732C, 0xA159AC94,
+    0x6B2C49E7, 0xA8B6FABA, 0x6AEB4A27, 0x7E7F3F7F, 0x5AA94207, 0x458585D5,
+    0x62EA5A69, 0x4A829647, 0x5AA95248, 0x5A170617, 0x52483144, 0x8F4F5F5F,
+    0x4A2841C6, 0xA3A6A6E2, 0x4A073986, 0x1B1B2767, 0x39A60000, 0x1B1B1B2B,
+    0x940F5248, 0xACACACAC, 0x83AE7B6C, 0xD9D98A48, 0x7B6D62CA, 0x1A2A5A5F,
+    0x62CA4A27, 0x11054A5F, 0x5A883144, 0xBF7F7F2F, 0x62EA41A6, 0x199C4C49,
+    0x62CA39A6, 0xA0A0B0B0, 0x7B8D6ACA, 0x9094D594, 0x62AA5269, 0x17171306,
+    0x5A895248, 0x1F1F1F4F, 0x524841E7, 0x1B1B1B2B, 0x4A2741E7, 0xE9EDD9B8,
+    0x4A273985, 0x5A5A6A2B, 0x4A0739C6, 0x6A59156E, 0x4A073145, 0xA2E2E2FA,
+    0x526941E6, 0xA9ACACE8, 0x39A60000, 0xE4E4E4E4, 0x4A2839A6, 0xB4555494,
+    0x5A8A39A6, 0x1495E9A6, 0x6AEB49E7, 0x94EEF9E8, 0x734D5A89, 0x81BF5504,
+    0x7B8E5A89, 0x6E064141, 0x6AEB5249, 0x7B6585D9, 0x62AA5A69, 0xC1682A1A,
+    0x62CA41C6, 0x6B162A6A, 0x6B0C3165, 0xC5C585C5, 0x6B0C62AA, 0x9A9AD692,
+    0x6B0B5248, 0x0A0A5B5A, 0x6B0B5249, 0x549569B9, 0x6B0B5A89, 0xD192F2F5,
+    0x6B0B62AA, 0xE2965B01, 0x62AA5227, 0x47979A98, 0x5A8941E7, 0x3B36566A,
+    0x4A2839C6, 0xFDA8E5F5, 0x5A894A27, 0xFEBE95A0, 0x62CA5248, 0xA1A5E694,
+    0x6AEB5A8A, 0x55752651, 0x6B0B5268, 0xE5E59096, 0x62EA41E7, 0xD3D3D2D3,
+    0x62CA5A68, 0x8586D259, 0x52683965, 0x5F6F5F2F, 0x52493965, 0xE5E59095,
+    0x62CA41C7, 0xD4E4A095, 0x6AEB5269, 0x7B7B6B25, 0x62EB5249, 0x1B560603,
+    0x52494A28, 0xE86A6E85, 0x62EA5248, 0xD5D1D5C5, 0x732C6B0B, 0x5591D080,
+    0x7B6D6B0B, 0xD5D5E495, 0x83AE6B0C, 0x84989D58, 0x7B6D6AEB, 0xF9BA693E,
+    0x7B8D2103, 0xE2E2E2E2, 0x7B8E6B0C, 0xAA1E0E5E, 0x734C62AA, 0xE1D45896,
+    0x7B6D6B0B, 0x242A693A, 0x6B2C62CB, 0xF6766390, 0x6B0B5248, 0x6A6E2F6A,
+    0x62CA4A07, 0x1E1D1D15, 0x5AAA5248, 0xE0E5E5ED, 0x5A894A28, 0x97965A8A,
+    0x52693144, 0x8B8B8B8B, 0x4A2839A6, 0xA6A676E3, 0x4A073145, 0x2B2B2B6F,
+    0x39A60000, 0x1B1B1B1B, 0x8C0F4A28, 0xBCBCBCBC, 0x8BEF7B6D, 0x5C484949,
+    0x7B6D5A89, 0x1A1E1E1E, 0x5AA941E6, 0x36B6A6A6, 0x62C92944, 0xE4E9EEAA,
+    0x62EA39A6, 0x263A3A2E, 0x6B2B41C6, 0xD1D1D191, 0x736C62A9, 0x6DACACF9,
+    0x62AA5249, 0x2B575727, 0x5A8A5228, 0x1E5A5A5A, 0x524841E7, 0x2F1B1B1B,
+    0x4A2841E6, 0xFAB5A1A1, 0x41E741C6, 0x4209291A, 0x4A2739A6, 0xAB6A2915,
+    0x41E72924, 0xF6E2E2F2, 0x52484A07, 0x04DCDCDC, 0x31850000, 0xF8F8E8E8,
+    0x4A0739C6, 0xE9B9A8A8, 0x52693986, 0xEAEAA9A0, 0x52693144, 0x5B1FE6A6,
+    0x5A893144, 0x7A5A1A47, 0x7B6D2903, 0x410050E9, 0x732C3986, 0xA850A9FB,
+    0x6B2C4A07, 0x91BAAFAA, 0x62EA49E7, 0x075B575B, 0x62EC3185, 0xC085C5C5,
+    0x730C62CA, 0x6DA89455, 0x6B0B5249, 0x0A0B5B0B, 0x62CA5A69, 0x7CFD7924,
+    0x62CB5A69, 0xA1F5E1E6, 0x6B0B5A89, 0x4796EBA6, 0x62EA5248, 0x172B5B46,
+    0x62AA4A07, 0x3E6E6F2A, 0x524841C7, 0xBEEAF9A8, 0x62AA4A28, 0xB469A5A9,
+    0x5A694A27, 0x89DAEBEA, 0x6AEB5A69, 0x9544547D, 0x732C5A69, 0xE5A4A090,
+    0x6AEB41C7, 0x93E2E2D2, 0x6AEA5268, 0x9B5F5A4A, 0x5A893985, 0x070B4A4A,
+    0x52693986, 0xA85CA4E1, 0x6AEB41C6, 0xE8E8E4E9, 0x6B0C62AA, 0x2B3A3A37,
+    0x62EB5249, 0x17071757, 0x5A894A28, 0x94E09455, 0x62EA5248, 0xD6D6D691,
+    0x734C6AEB, 0x485A5A97, 0x7B6D6B0B, 0xE9D89898, 0x7B8E62CB, 0xDBCADA99,
+    0x7BAE732C, 0x97265551, 0x83CE2103, 0xE2E2E2E2, 0x83CF5A89, 0x2B2B6B6A,
+    0x734C62AA, 0xD08091D5, 0x7B8D6AEB, 0x7969552A, 0x6B0C5A8A, 0xA8A8D1E6,
+    0x6AEB5268, 0xAE6B2A56, 0x6B0B41C6, 0x091D1D5D, 0x62EA5248, 0xF464A4A0,
+    0x5A894A07, 0x51A797D7, 0x52683985, 0x9B8B8B8B, 0x4A0741C6, 0xA4D1E1F1,
+    0x4A283986, 0x47070707, 0x31650000, 0x1F1F1F1F, 0x8C0F4A28, 0xACACACAC,
+    0x8BEF7B6D, 0x1C5C5C5C, 0x734C5A89, 0x2B1B1B1F, 0x5A893185, 0xAB6B5B1A,
+    0x5A882924, 0x568180D0, 0x62CA39A6, 0x6B672727, 0x6B2B41C6, 0x54D4D0D1,
+    0x736C62CA, 0x36363968, 0x62AA5249, 0x9B97572B, 0x62AA4A28, 0x07171A5A,
+    0x524841E6, 0x2E6F2F6F, 0x4A2841C6, 0x161ABA6F, 0x41E739A5, 0x1A6AABAB,
+    0x4A2841C6, 0x9196AB9B, 0x4A073185, 0xF5F2F6A1, 0x5A894A07, 0x98D49454,
+    0x31860000, 0xF4F4F8E8, 0x524839C6, 0xA4B4F4A4, 0x526941E7, 0xE4D0D1E1,
+    0x5AAA4A27, 0xEFEF9646, 0x62AA41C6, 0xEAD646D6, 0x62EB2903, 0xEAFA6A1A,
+    0x6B2B2103, 0xBF5B01A5, 0x62CA3144, 0x4550F9AF, 0x5A892924, 0x5001A5BE,
+    0x62EB20E3, 0xD0C1C6DA, 0x6AEB5AAA, 0xA8A8A4A9, 0x6B0B5A8A, 0x570A4606,
+    0x62CA5A69, 0x295E3D78, 0x62CB5269, 0xE4F4E5B5, 0x6AEB5AAA, 0xE9995A4A,
+    0x6B2C4A28, 0x2B2B2A5A, 0x62CB4A28, 0xA6A66B2F, 0x5A8A41C7, 0xC2D6AA69,
+    0x62AA4A28, 0xF9F9BCB8, 0x5A894A07, 0x4A5646DA, 0x62CB5249, 0xA45494F9,
+    0x83CF62CB, 0x54D45090, 0x94502944, 0x51575656, 0x62EA4A07, 0x27276B9B,
+    0x52683985, 0x2B17171B, 0x4A2839A6, 0x6A5BA9AC, 0x62CB39C6, 0xE9E9E9E8,
+    0x6AEB5248, 0x6A6A2BBB, 0x62AA5248, 0xA6965157, 0x5A894A08, 0xEEB9A9A8,
+    0x6AEB5A69, 0xE2A29280, 0x6B0B62CA, 0xAA9BDFDE, 0x7B6D6B0C, 0x68B8A9E8,
+    0x83CF6B0C, 0xD0D09182, 0x83AE6B2B, 0x262B7A6B, 0x83CF2104, 0xE1E1E1E2,
+    0x83CE62AA, 0xAA6B6F2B, 0x6B2C62CA, 0x95E4F590, 0x734D6AEB, 0x65AE1A29,
+    0x734D5A8A, 0xB86458A4, 0x6B0C5A89, 0x1A6DAA59, 0x6B0B41C6, 0x8B4A4A0A,
+    0x62CA5228, 0x61262539, 0x5A6939A6, 0xFAF9A5A4, 0x524841A6, 0x8B8B9F9F,
+    0x4A2841C6, 0xF8F4E090, 0x4A2839A6, 0x06070707, 0x31850000, 0x1B1B1B1B,
+    0x8C0F4A28, 0xBCBCACAC, 0x8BEE734C, 0xA8A8ACAC, 0x7B8D5248, 0x5A5B1B1B,
+    0x5AA94A07, 0xAEAE5541, 0x526839A5, 0xAF6B7F2B, 0x5A8941C6, 0xECADEDEA,
+    0x524839A5, 0x696868AD, 0x7B8D62A9, 0xE2F2B276, 0x62CA5A69, 0x17275686,
+    0x62AA4A08, 0x17171757, 0x524841E7, 0x2E591A2F, 0x4A073986, 0x56475B2F,
+    0x420739A6, 0x6A562A34, 0x4A0741C7, 0x46469692, 0x4A283986, 0x1252A1B1,
+    0x5A894A07, 0x5C585494, 0x39A60000, 0xE4E4E4E4, 0x524839A6, 0xF8F8B8B4,
+    0x52494A07, 0xD09094E4, 0x62CA5269, 0xE5D5D8D9, 0x6B0B4A28, 0xF6E7E692,
+    0x6AEB5269, 0xB5B1A161, 0x6B0C41E7, 0xAAA9E9E8, 0x7B6D2103, 0xEAEFAA06,
+    0x736D2124, 0xFFBF6605, 0x736D18C3, 0x9B969090, 0x62CB5A69, 0x9041AAFA,
+    0x6AEB5249, 0x5F1E1E5B, 0x62AA5A69, 0x7E691864, 0x62EB5228, 0xF9E5E5B8,
+    0x6B0C5A8A, 0xC2C6D5E4, 0x6B2C4A28, 0x6F1B1B2B, 0x62CA5248, 0x90D0E4F5,
+    0x5A8941E7, 0x4195DFC7, 0x62CA41C7, 0x64B9BAB6, 0x5A8949E7, 0xD4596E5A,
+    0x734C4A08, 0x6EA9E994, 0x734D41A6, 0xD05655AA, 0x7B6D39A6, 0x97929151,
+    0x62CA49E6, 0x1A1B2A2B, 0x52893965, 0xA5665B1B, 0x4A4841C7, 0x31361757,
+    0x6AEB4A28, 0xE9E998D8, 0x6AEB5248, 0x3929656A, 0x62EB5268, 0x519195D5,
+    0x5AA95269, 0xC69DD9E4, 0x6B2B5A89, 0xD1D2D1E1, 0x732C62EB, 0x95946065,
+    0x734D6B0B, 0x4645D5A5, 0x8BEF6B0C, 0xD1D0D0D4, 0x83AE62EA, 0x3A3A3A2B,
+    0x83EF2924, 0xE1E1E1E1, 0x83CE62EA, 0x1B6B6BBB, 0x6B0B5A69, 0x6293D7EB,
+    0x6B2C62AA, 0x78BCB9A7, 0x732C5A89, 0x64686ABA, 0x6AEB5228, 0x5B6E6F2E,
+    0x6B2C41C6, 0x96574A4B, 0x62AA3985, 0x1A2E7EBA, 0x5A8941A6, 0xA0E4F9FA,
+    0x526941C6, 0x9B57474A, 0x4A4841C6, 0xAE6ABDBC, 0x4A073165, 0x2F2A6B6F,
+    0x39860000, 0x1B1B1B1B, 0x8C0F4A08, 0xACACBCFC, 0x8BCE730C, 0xA85868B9,
+    0x732B5268, 0x17262A2B, 0x62CA4A07, 0xA5A4A4F8, 0x5AA94A27, 0xB3AAAABF,
+    0x5AA941E6, 0x227679B8, 0x526841E6, 0x6A266B6A, 0x83AD5AA9, 0xD4D5D1A1,
+    0x62AA5269, 0x65561717, 0x62CA4A08, 0x571B1B1B, 0x524841E7, 0x1B2B2F2E,
+    0x41E73985, 0xF1A1A5A6, 0x41E639C6, 0x3F2E7F6E, 0x4A0741E7, 0x02020202,
+    0x4A283145, 0xC2966656, 0x52684A07, 0x564885D6, 0x39C60000, 0xE4E4E4E4,
+    0x5A6939C6, 0xE5A5A5A4, 0x52694A08, 0xFAFABA91, 0x6AEB5228, 0xE1E1A5A5,
+    0x6B2C5248, 0xF6F5F1B1, 0x6B2C5A89, 0xA1B5B5B1, 0x6B0C5269, 0xC8D9DA89,
+    0x62AA5248, 0xC5A878E8, 0x7B6D5A89, 0x515169BE, 0x62EB3145, 0xCBC6CACB,
+    0x62EB5A8A, 0x464B4680, 0x6AEB5A69, 0x1B5B1B1B, 0x62CA5249, 0x5A5A2F7E,
+    0x6B0C5249, 0xF9B8A4A5, 0x6B0C5A69, 0x555150D0, 0x6B2C5248, 0x9A6A7E2F,
+    0x62EB5268, 0xE6E59591, 0x52693144, 0x1B57ABAB, 0x52693965, 0x171B6AA9,
+    0x734D41A6, 0x35E09054, 0x7B8D2904, 0xF9E5961F, 0x83AE5A8A, 0x966A65B4,
+    0x736D41C7, 0x53535393, 0x526941E6, 0x7A2A2A2F, 0x5AAA39A6, 0x16979A99,
+    0x5A8941C7, 0x55145153, 0x6B0C5249, 0x555585C8, 0x6B0B5248, 0x1B6F2E29,
+    0x62EA5268, 0xE3DBEBBA, 0x62CA5268, 0x1A25B5A5, 0x6B2C5A69, 0xE1E0E0E0,
+    0x6B0C6AEA, 0xE5E5E5A4, 0x7B6D6B0B, 0xD6599986, 0x83CE6B0C, 0xE5E5E4E4,
+    0x7B8D62CA, 0xBB3B3B3B, 0x83CE2945, 0xE1A1E1E1, 0x7B6D62CA, 0x5756561B,
+    0x62CB5248, 0xFEBA6176, 0x734C5248, 0x1A1A2E79, 0x6B0C5248, 0x68A9BDB9,
+    0x6AEB5A69, 0xD696C78A, 0x5AA95248, 0x24B1F2F3, 0x5AA941A6, 0xE8E65347,
+    0x5A6941A6, 0xA6EAD5E1, 0x5A694A07, 0x18BE5707, 0x524839C6, 0x2B6BBFAA,
+    0x4A283165, 0x411A6B6A, 0x31850000, 0x2A1B1B1B, 0x83CE41E7, 0xACBCACBC,
+    0x83AD6B0B, 0x9455A9B9, 0x736C4A07, 0x17171717, 0x62C941C6, 0x2E6DBCB9,
+    0x5AA92944, 0x8590E5FA, 0x6B0A41E6, 0xC6D55652, 0x526841C6, 0xF9A4A9BE,
+    0x83AD4A28, 0xD4E4E4E5, 0x5A8A5249, 0xA592D2D2, 0x62AA4A28, 0x161A5757,
+    0x4A2839A6, 0x2E2E2F1B, 0x4A2739A6, 0xF9B8A4E0, 0x4A0741C6, 0x06154546,
+    0x4A2839A6, 0x9585D5D5, 0x4A073164, 0xE5918282, 0x5A894A27, 0xC1D49451,
+    0x39A60000, 0xE4E4E4E4, 0x524841E7, 0x44C4C090, 0x5AAA4A08, 0xA9E8E9B6,
+    0x62EB5228, 0xB8B5A697, 0x6B0C5A89, 0xB5B5F1F0, 0x732C5A8A, 0xB8747464,
+    0x732C5A69, 0xC8898998, 0x5A8A5228, 0xD6E5A0B4, 0x62EB5249, 0xA9EAE6E1,
+    0x6B0B3145, 0xC6C6CACA, 0x6B0B62AA, 0x43828686, 0x6B0B5A69, 0x0B1B0706,
+    0x62AA5228, 0x6A1A5AAE, 0x732C5A69, 0xA4E4F4A4, 0x6B2C62CA, 0xE2BA6B56,
+    0x6B0B5249, 0xAF1A1665, 0x62EA5269, 0xA0A5EAA7, 0x6AEA3165, 0x6B6F2B1B,
+    0x734D41A6, 0x35E59541, 0x734D41A6, 0xEAF9E70E, 0x7B8E62CB, 0x6965550B,
+    0x736D5A69, 0x6FEA9A74, 0x7BAD41C6, 0x52535352, 0x5A884A27, 0xD8D9597A,
+    0x4A483986, 0x2D2A2621, 0x5AA941E7, 0xE8E8A555, 0x6B0B5268, 0x9195D695,
+    0x6B0A5268, 0x8515070F, 0x62CA5A89, 0x6F114260, 0x62CA5A68, 0x1B5E4691,
+    0x734D5A69, 0xE5E1D1D1, 0x734D62AA, 0xBAAAA9A8, 0x736D62CB, 0xE8E9EEAA,
+    0x83CE734C, 0x1555D0D0, 0x8C0F6B0B, 0xE4A195A5, 0x732C2125, 0xF1F1F2F2,
+    0x736D6ACB, 0x4505566F, 0x6B0C62AA, 0xEA454505, 0x732C5A69, 0x6B0A5A5F,
+    0x734D5A89, 0xA5E45455, 0x6B2C5A69, 0x1F292693, 0x6B0B49E6, 0xEB9B5E19,
+    0x6B0C5A69, 0xAB6B6968, 0x5AAA4A08, 0x5B6B5A06, 0x524841E7, 0x267F6B59,
+    0x524941C7, 0x6A2E3920, 0x4A283145, 0xAFBFAA06, 0x39C60000, 0x1B1B1B1A,
+    0x83CE41E7, 0xACACACBC, 0x736C4A27, 0xA4E8FEFF, 0x732B41E6, 0x1A1A1B1B,
+    0x62A941C6, 0xAFBE7F2F, 0x52483144, 0xAB6F2A99, 0x62CA41C6, 0x4989D9C6,
+    0x5AA94A07, 0xD2D2A1A0, 0x736C41E6, 0xB4B4A5E5, 0x5AAA5269, 0xD9955050,
+    0x5A8A4A27, 0x6B1A1B1B, 0x524839A6, 0x4F4F1E1E, 0x524841E7, 0x7968A5A0,
+    0x4A0741C6, 0xD6D64607, 0x4A2841E6, 0x2E2E6959, 0x4A273185, 0xF5F5F4F4,
+    0x5A894A07, 0xD2D2D281, 0x39860000, 0xE4E4E4E4, 0x4A4841C6, 0x79392D09,
+    0x5A693165, 0x64A8BEFF, 0x6B0B5228, 0xE9E8E8A8, 0x6B0C5A89, 0xB1A1A4B4,
+    0x732C4A08, 0xA8B9B9B9, 0x6B2C5A69, 0xCCCC8888, 0x5A895248, 0x539BDAD9,
+    0x5AAA5249, 0x175BFDBC, 0x6B2C3985, 0xC6C6C6C6, 0x6B0B62AA, 0xE7934303,
+    0x6B0B5248, 0x4A4B4B5B, 0x62AA5269, 0xD595E6C6, 0x6B0C62CB, 0xB6707C6C,
+    0x732C62AA, 0xA5F4A591, 0x6B2C5A89, 0x45464A9E, 0x6AEB4A28, 0x5469FCE9,
+    0x62CA3144, 0x5525166B, 0x732C49E7, 0xBCAA9648, 0x732C5A8A, 0xAAA5E491,
+    0x7B6D5A8A, 0x905416BE, 0x736D62AB, 0xE19195D0, 0x736D41E7, 0x53535353,
+    0x526841C5, 0x672B7FFE, 0x4A483986, 0x155A596C, 0x62AA39A6, 0x99ECFDFD,
+    0x734C5248, 0xFAEAA681, 0x6B2C5268, 0xAEE99949, 0x62EB5249, 0xA6D75B0A,
+    0x62EB5A89, 0x5F5A5A05, 0x734C5A8A, 0xA0E1E1D6, 0x734D6B0B, 0xE95599B8,
+    0x7B6D6B0C, 0xE9E59494, 0x7B6D6B0C, 0xA263B3B6, 0x7BAE732C, 0xE594A5E1,
+    0x732C2945, 0xF1F1F1F1, 0x6AEB62AA, 0xAB2A7A3B, 0x6B2C62CA, 0xD5D4D545,
+    0x6B0B5A89, 0x96EBA717, 0x6B0B5228, 0xFE6E3FEB, 0x732C4A08, 0xEBBA605B,
+    0x6B2C5248, 0xFEAE5960, 0x6B2C5A8A, 0x2F5F1905, 0x5A894A08, 0x2D2F5A5A,
+    0x524941E7, 0xFBFB6169, 0x524941C6, 0x9AAB1A6E, 0x524841A6, 0x6717166B,
+    0x39A60000, 0x1B1B1B1B, 0x83CD41C6, 0xACACACAC, 0x6AEB5268, 0x575FAAE4,
+    0x6AEA41C6, 0x6F2B1B1A, 0x62EA4A07, 0x475B5B5A, 0x5A894A27, 0xDA9A5551,
+    0x5A8939A5, 0x67363A69, 0x5A8949E7, 0x86C2C1D2, 0x732B41C6, 0xE4A4E4F4,
+    0x62AA5269, 0x8599D9D9, 0x5A8A5249, 0x16EB9B0B, 0x5A693985, 0x4195575B,
+    0x526941E7, 0x90A5797A, 0x4A0741E6, 0x5E9A9B9B, 0x4A0739A6, 0x646969AE,
+    0x5A8941C6, 0xE4D0D090, 0x62AA4A27, 0xE4E5D191, 0x41C70000, 0xE4E4E4E4,
+    0x52684207, 0xE5E5A564, 0x5A8A3986, 0xFEFAD150, 0x6AEB5A8A, 0xB4E4E0E1,
+    0x6B2C5AAA, 0xE1F1B560, 0x732C5228, 0xB6B9E4A4, 0x6B0C5248, 0x696CACDD,
+    0x6AEB41C7, 0x13535656, 0x62CB5249, 0xEAAB6642, 0x6B2C3165, 0xC6C6C6C6,
+    0x732C6AEB, 0x6BA79742, 0x6AEB5269, 0x5A5B1B0B, 0x62CB4A28, 0xA5E06095,
+    0x6B2C62CA, 0x3975B4FA, 0x734C5AAA, 0xF0F5A666, 0x6AEB5AAA, 0x9A9AAA59,
+    0x6B0B5A69, 0x72376100, 0x52283145, 0xFABE1696, 0x62CB3145, 0xB4E4E8E9,
+    0x6AEB5A8A, 0x699A6A2B, 0x6AEB5A8A, 0x98BEBAEA, 0x7B6D62CB, 0xA9F8F4E4,
+    0x736D41E7, 0xA2535353, 0x62EB4A27, 0x6E6E2A01, 0x4A2839A6, 0x7979A551,
+    0x62AA3985, 0xD9E894D8, 0x734C5A69, 0xE5A9A4F5, 0x736D62CA, 0xAD586969,
+    0x62CB5269, 0x6191A5F6, 0x62EB5A69, 0xAA6915AB, 0x736D5A89, 0xA9E5D091,
+    0x7B6D6B0B, 0xBBB274A8, 0x734D6B0B, 0xDAC69AE9, 0x7B6D6B0C, 0x7AB66561,
+    0x7BAE732C, 0x68B96494, 0x6AEB2965, 0xF1F1B1F1, 0x732C5A8A, 0x0556551C,
+    0x6AEB5AAA, 0x51EB95D4, 0x62EB5A89, 0x02EBA6BA, 0x6B2C4A28, 0x1AAEAAAA,
+    0x6B0C5A89, 0x65E6A691, 0x6B0C5A69, 0xB9A8A868, 0x6AEB5269, 0x55071B6E,
+    0x5AAA4A08, 0x9B565A19, 0x52694A08, 0xD544A591, 0x5A6941E7, 0xDB454555,
+    0x4A2839A6, 0x6E5A1A6B, 0x31860000, 0x1B1B1B1B, 0x7B8D41A6, 0xACACACBC,
+    0x732C5247, 0x55594A47, 0x62A95227, 0x5949595F, 0x62CA39A5, 0x474B4B4B,
+    0x5AA95247, 0x419695C9, 0x5A8941C6, 0xDAD6D293, 0x5A8941C6, 0x686C6C5E,
+    0x62EA41A6, 0xD1E2E2F5, 0x5A895228, 0x8A9D55EA, 0x62CA3124, 0xAEBE2E6A,
+    0x4A283165, 0x56465847, 0x4A083185, 0x545454F5, 0x4A073165, 0x8A4595AF,
+    0x41E73165, 0x182D65B8, 0x5AAA41E7, 0xA8BCA894, 0x6B0B41E7, 0x4094E4A5,
+    0x41E70000, 0xE8E4E4E4, 0x524941C6, 0x58A9FAAA, 0x62AA41A6, 0xA4A5FAEA,
+    0x6B2C5A69, 0x6EA5A9A8, 0x732C5A8A, 0xC691D1A2, 0x732C5A69, 0xE6E6E2F1,
+    0x732C5A69, 0x76762225, 0x734C39A5, 0x171B1716, 0x62CB5248, 0xD88596AA,
+    0x734D3145, 0xC6C6C6C6, 0x732C6AEB, 0x55061356, 0x6B0B5A69, 0x1B1A6B4A,
+    0x62AA5269, 0xE5918266, 0x6B0C62AA, 0x5A596610, 0x7B8E5AAA, 0x6464B4A0,
+    0x6B0B5A69, 0x5A1E2FAF, 0x62EB5A69, 0xABA7A3F6, 0x62CA4A08, 0xE6954591,
+    0x5A8A39A6, 0xD6A5A5B0, 0x62CA5249, 0xA9A8DC88, 0x6AEB62AA, 0x59045094,
+    0x734D6AEB, 0x4998E868, 0x6B0B39A6, 0xF3E3A3A3, 0x62CA41E7, 0x3E3E6E6F,
+    0x4A4739A6, 0xB86478A9, 0x6AEB41C7, 0xE5D49494, 0x736D5A6A, 0x6165A1E1,
+    0x7B8D5A8A, 0x5858596D, 0x62CB5248, 0x5869AD65, 0x6AEB5A89, 0x295955D9,
+    0x734C62CA, 0xE0E4D556, 0x7B8D6B0B, 0x6B317579, 0x7B6D6B0B, 0xD0C589E9,
+    0x7B6D6B0C, 0xE2A2767A, 0x7B8D732C, 0x7B7BA978, 0x6B0C2944, 0xF4F4F5B1,
+    0x6B0C62AA, 0x97AA9B0D, 0x732C5249, 0xBEAA2A56, 0x6B0C5A69, 0xBEBDE991,
+    0x734D5A89, 0xD6955A1E, 0x7B6D5A89, 0xADB8F5A1, 0x7B6D5228, 0xB4A4E5A4,
+    0x6B0C5A89, 0x5756561A, 0x5AAA4A28, 0xFA46A641, 0x62CA4A07, 0xFA95A900,
+    0x5A8941C6, 0xBEAAAA45, 0x524939A6, 0xAB6A2B04, 0x39A60000, 0x1B1B1B1B,
+    0x7B8D4207, 0xACACACAC, 0x6AEB5A68, 0x5B5A0695, 0x5A894A07, 0x5F9F5F1E,
+    0x62EA39A5, 0x969B8B47, 0x52684206, 0x86A7529A, 0x62A95248, 0x2554845C,
+    0x5AA94A07, 0xD1D1D4A4, 0x6B2B41C6, 0xC5C5D191, 0x5A8A5228, 0xC5859669,
+    0x62AA5248, 0x595E5D08, 0x524839A6, 0x5B4B0B56, 0x41E73986, 0xA595A4C4,
+    0x42073985, 0xD59196C7, 0x41E72904, 0xDE9A1A2E, 0x5A6939A6, 0x7E7AB9B8,
+    0x5A6941E7, 0xAB9A9A45, 0x29450000, 0x9494A4F8, 0x4A2818C3, 0xE0D0E4F9,
+    0x6B0C3985, 0x545494E5, 0x734D3965, 0x414556AF, 0x6AEB41C7, 0xB065AAEF,
+    0x6B0C5A8A, 0x9BD8EEAB, 0x732C5A69, 0xA6727166, 0x7B6D41E6, 0x0D4A0B07,
+    0x6AEB3986, 0xB5A8A8E9, 0x732C3165, 0xC6C6C6C6, 0x732C6AEB, 0x91B47171,
+    0x6B2B5A8A, 0x5646571B, 0x6AEB5A8A, 0x94E5A460, 0x6B2C5AAA, 0x57875716,
+    0x6B2C5AAA, 0x0AE9EA79, 0x62EA4A27, 0xA6479BAF, 0x62EB5248, 0x1D2866AB,
+    0x6AEB5249, 0x4BB495D1, 0x62CB41C7, 0xEAA9A991, 0x6B0B5249, 0x87529699,
+    0x6AEB5A89, 0xD2869796, 0x7B4D62AA, 0xD1C08595, 0x6B2C39C6, 0xA3A3A3A3,
+    0x62CA41C6, 0x2E6F2E3E, 0x5A892924, 0xB4787879, 0x62CB3986, 0xF9A8A8E9,
+    0x6B0C5A8A, 0xFEA6B662, 0x6B0C5A69, 0x4E5E4A5D, 0x5A893145, 0x0BAABFBF,
+    0x62CB5249, 0xA8796555, 0x732C5A8A, 0xD5D6D1E0, 0x7B6D6AEB, 0x554655EA,
+    0x83AE6B0B, 0x54A1D1D5, 0x7B8D732C, 0x82C0D1A3, 0x83AE6B2C, 0xAA7A2E2A,
+    0x6B0C2924, 0xF4F4B4B4, 0x732C62AA, 0xB5BB81A5, 0x734D5A69, 0xEEAA00AA,
+    0x6B2C5228, 0x6BAE58AF, 0x734D5228, 0xEAD51166, 0x734D5A69, 0x6A46012F,
+    0x734D5249, 0xBFA6056D, 0x6B0C4A07, 0x5B1B115B, 0x5A8A4A28, 0xB9550455,
+    0x526941C7, 0xFA9396FB, 0x5A6941E7, 0x6F4495A9, 0x52493165, 0x69166AAB,
+    0x39860000, 0x1B1B1B1B, 0x83CE4A07, 0x6C6C98A8, 0x6B0B5248, 0x6A291A5B,
+    0x5A894A27, 0x7B2B2A5E, 0x5AA941C6, 0x8B47478B, 0x5A882124, 0x0757579B,
+    0x62C92945, 0xF8B9B9BE, 0x62A94A07, 0x015595D1, 0x62CA41C6, 0x558585D5,
+    0x5A8A5228, 0x9A9A9AC5, 0x5A895248, 0x5A55599D, 0x524839C6, 0x47475B5B,
+    0x41E739A6, 0xF4F5B1B1, 0x420739C6, 0xDAD9D5C4, 0x41E73145, 0x4E8989CD,
+    0x526949E7, 0x42071F2E, 0x52684A07, 0xE9E5E6D7, 0x41E70000, 0xE4E4A450,
+    0x52482924, 0xEFE6B5A4, 0x5A8A4207, 0xAAAB5A18, 0x6B2C39A6, 0xEAFA2915,
+    0x7B8D3145, 0xFAFA9480, 0x734C62CA, 0xB5A7AB47, 0x734C5AAA, 0xA6D6C696,
+    0x6B2C2924, 0xBE7E2E6D, 0x62AA3145, 0xBBF5E4F9, 0x6B2C3165, 0xC5C5C6C6,
+    0x6B0C62CA, 0xE6E6EAEA, 0x6B0B5A8A, 0x03071747, 0x6AEB5A89, 0xD1919591,
+    0x62AA5248, 0x2BFFFBA7, 0x6B0C5269, 0x1012071E, 0x62CB5A69, 0xDAEC5CE4,
+    0x6B0B5269, 0xBF29679E, 0x62EB2924, 0xE89096A7, 0x62EB5269, 0xFBAFEDF8,
+    0x62EB5269, 0xB9B1A282, 0x6ACB5249, 0x81D5A5E6, 0x7B6D5AAA, 0x90E5E5E5,
+    0x6B2C4207, 0xF3F3F3B3, 0x62EB41E6, 0x2A2F2E6D, 0x52882924, 0x252874B5,
+    0x62AA2904, 0xF8B9F9FA, 0x6B0C5AAA, 0xDAD5465B, 0x6B0C5228, 0x6D6CA8AE,
+    0x5AAA41A6, 0xEBFEAE1A, 0x62AA4A28, 0x1569AEBE, 0x732C5A69, 0xD0D1D1E1,
+    0x732C6AEB, 0x22B2AB91, 0x7B6D6AEB, 0x75F0A0E4, 0x7B6D732C, 0xC1C08080,
+    0x7BAD734D, 0xC5D6D6EB, 0x732C2945, 0xB4F4F4F4, 0x732C62AA, 0x74A0A6BA,
+    0x732C5A8A, 0x6642EBAB, 0x6AEC5A69, 0x16197FA6, 0x6AEB5A69, 0x3111ABDA,
+    0x734D5A8A, 0xFEA9F9A8, 0x734D62CB, 0x06DAF9DF, 0x62EB5248, 0x5E1B5F57,
+    0x62AA41E7, 0x525065BA, 0x5A895228, 0x1A651B7B, 0x52694A08, 0x805E99D6,
+    0x4A2839A6, 0x1F6F2B2A, 0x31860000, 0x1B1B1B1B, 0x83EE49E7, 0xACAC6C6C,
+    0x6B0B5247, 0x1B1B5B6A, 0x5A895227, 0x32656566, 0x5A6841A6, 0x9B8B8B8B,
+    0x5A8839A6, 0x66A6AB07, 0x62A92945, 0x91A1E1F4, 0x526849E6, 0xCB9B9B66,
+    0x4A2841E6, 0x969595AE, 0x5A8A5248, 0x95D1D5C5, 0x5A895248, 0x57565B5B,
+    0x526939A6, 0x47474746, 0x420739A6, 0xEDECF8F4, 0x4A0841C7, 0x00C08080,
+    0x4A082944, 0x1D1E5A5A, 0x526839A6, 0xF4F5E1E6, 0x52684A07, 0x9EDDE9E8,
+    0x4A080000, 0xE4E4E4E4, 0x52483165, 0x9B8ADEDB, 0x5AAA5249, 0xF95A5519,
+    0x62CA49E7, 0xC78786D6, 0x732C4A08, 0x2E2A7FFF, 0x7B8D5249, 0x5AA9ACB8,
+    0x734D5A69, 0x2C28A5A6, 0x734C5A69, 0xDB9D9CAC, 0x6B0B5A89, 0x06425667,
+    0x734C3165, 0xC6C6C6CA, 0x732C62CB, 0x57478191, 0x6B0C5A69, 0x16174717,
+    0x62EB5269, 0x9495A1D5, 0x62CB5248, 0x5A1B2B26, 0x62CA5228, 0xEA4795EC,
+    0x62EB49E7, 0x9AEAD297, 0x734D49E7, 0xE5E65A1A, 0x7B6D5228, 0xAA6A90E1,
+    0x6B2C5A69, 0x574A191A, 0x62CA5249, 0x6869A6E6, 0x6ACB5A69, 0x441451D1,
+    0x732C5AAA, 0xE5A0E0E1, 0x734D41E7, 0xF2F2F2F2, 0x6B0B41E6, 0x2F6F6F2B,
+    0x734C3165, 0xE8F8F8A4, 0x6B0C41A6, 0xEEAAFAA4, 0x6B0C5269, 0x929599DA,
+    0x6AEB5A89, 0x363E7A19, 0x62EB5249, 0xD7929382, 0x62AA5228, 0x1B5A5716,
+    0x732C5269, 0xD490A1D0, 0x734C62CB, 0xB1B5A6B7, 0x7B8D6AEB, 0x69787969,
+    0x7B8E6B0C, 0x8599999D, 0x8C30732C, 0xD1844444, 0x734D2965, 0xA4B4F4F8,
+    0x734D62AB, 0xE99594E5, 0x734C62CA, 0x41050167, 0x6B0B5A69, 0x5B2B2A3F,
+    0x62EB5249, 0xFAF97A3A, 0x734C41C7, 0xFB2B2BAF, 0x6AEB39A6, 0x5F1450FB,
+    0x62CB5249, 0x47091E5A, 0x5A8A41C7, 0xA5A1B6B6, 0x5A8A4A08, 0x25667BAA,
+    0x5A8A41E7, 0xD1115696, 0x524820E3, 0x92BFAEAF, 0x39A60000, 0x1B1B1B1B,
+    0x83EE41A6, 0xA8ACACAD, 0x6B0B4A07, 0x1A2B6B6B, 0x5A8949E6, 0x6468B9BA,
+    0x62CA4A27, 0x52671656, 0x52483144, 0xF8B9E5FA, 0x52682965, 0x8786D1E1,
+    0x526849E6, 0xAB9ECACB, 0x524841C6, 0x1F1A5B5B, 0x5A895249, 0xD6959594,
+    0x5A695228, 0xD1D2D697, 0x524939A6, 0x03030747, 0x41E739C6, 0xAAAABDED,
+    0x4A2839C6, 0xC4844455, 0x4A282944, 0xAD5E5A1E, 0x5A893185, 0xBAB9B8B4,
+    0x62AA4A07, 0x47465645, 0x4A070000, 0xE4E4E4E4, 0x526941A6, 0x5E9E9A8A,
+    0x62CA5269, 0xD4D5A5F5, 0x62CA49E7, 0x8782C6C3, 0x6B0C4A08, 0x6E2E2E2E,
+    0x734C49E7, 0x2A2B7FBF, 0x6B0C41A6, 0x8A9EAE6E, 0x736D5249, 0x52A79B9B,
+    0x62CA4A28, 0x1E5D6D6E, 0x6B2C3165, 0xC6C6C6C6, 0x6B0C6ACB, 0xB9A19297,
+    0x6B0B5A69, 0x1E1B1B5B, 0x5A894A07, 0x9296E6FB, 0x62AA5249, 0xA69A8A9E,
+    0x6B0B5A89, 0x57569691, 0x62CA39A5, 0x7F2F5B9A, 0x6B0C41C6, 0x0151A4F5,
+    0x6B2C5228, 0x4551A5E9, 0x6AEB5228, 0x6865266B, 0x62AA5269, 0x1726676A,
+    0x628A5269, 0x94949495, 0x730C62AA, 0x642070A0, 0x7B6D39C6, 0xA1E2F2A2,
+    0x736C3986, 0x9A6B2B1A, 0x6AEB41E7, 0xAB9B86C5, 0x732D5A69, 0x5B165545,
+    0x6B0C5269, 0x56676791, 0x6B0B5269, 0x76723671, 0x6B0B5249, 0x51A6D6D7,
+    0x6B0B5248, 0x47070706, 0x6B0C5249, 0x98D8D8D4, 0x6B2C5AAA, 0xFBB6B2B2,
+    0x7B8D62CA, 0x74B9B469, 0x7B8D6AEB, 0xAEEA9645, 0x83EF732C, 0x418195D4,
+    0x6B0C2944, 0xF4F4F8F8, 0x732C62EB, 0xABA6E554, 0x734D5A89, 0x9B056A96,
+    0x6B0C5249, 0xCA8A9E6A, 0x62EB5249, 0x3C297E09, 0x734D5A8A, 0xAD18BF55,
+    0x6AEB4A08, 0xBBABFE46, 0x62AA4A08, 0x2666BB57, 0x5A6949E7, 0xFFA9FDB8,
+    0x62AA4A28, 0x5669BD68, 0x5A8A4A08, 0x072AAB66, 0x5A8939A6, 0x05655A07,
+    0x39650000, 0x1B1B1B2A, 0x7BAD3986, 0xACACA8A8, 0x732C5227, 0x17161615,
+    0x52683985, 0x787878BD, 0x5AA941E6, 0xA2A2A76B, 0x52683164, 0xFDFCF8F9,
+    0x52473165, 0x5F8B8B8B, 0x526841E6, 0x1B2F3F7E, 0x526841C6, 0x2B594909,
+    0x5A8A4A08, 0xE6E6D2D2, 0x5A895228, 0xDA978787, 0x4A0839A6, 0x16161707,
+    0x41E741C6, 0x9AAA6B6B, 0x41E639A6, 0x25695919, 0x52693985, 0x9D9898A9,
+    0x5A894207, 0x9E999494, 0x52684A07, 0x44589AD7, 0x41C70000, 0xE4E4E4E4,
+    0x5A8941C7, 0x19191E1E, 0x5AAA5269, 0xCB8A8645, 0x62CA41C6, 0x8A86C6D7,
+    0x62EB3986, 0xBEB8BE7E, 0x6B2C41C6, 0x1A2A2B3F, 0x734C4A07, 0xC5C58586,
+    0x6B0B5228, 0x21627273, 0x62EB4A27, 0x5B6B5B1B, 0x734D39A6, 0xC5C5C5C6,
+    0x6B0C62CB, 0x055999AD, 0x6B0C5248, 0x5B5B5B1A, 0x5A894A28, 0x47470A49,
+    0x62CB5248, 0x45455657, 0x5AAA5249, 0x4786D1E1, 0x62CA4A27, 0x1B0B0B5A,
+    0x526839A5, 0x96511217, 0x5AAA41E6, 0xE8D895D1, 0x5AAA5248, 0xAAAB6A90,
+    0x5AAA5248, 0x6A175A6B, 0x5A894A28, 0xB5A0A5B9, 0x6AEB5A89, 0x286DBDFE,
+    0x62CA3165, 0x8266F6F6, 0x62CB39A6, 0xEAE8A1D7, 0x6AEB4A28, 0xB9A8E4E6,
+    0x6B2C5A69, 0x4256595E, 0x62CB5A69, 0xDD9E9AC6, 0x732C62AA, 0x99E89498,
+    0x62CB5249, 0xA86DACBD, 0x6AEB4A07, 0x5A574757, 0x6B0B5269, 0x69A9E9F8,
+    0x734D6AEB, 0x86913030, 0x734D62AA, 0xF9B8F9F9, 0x83AE6B2C, 0x25656517,
+    0x83EF734C, 0x4A0A4707, 0x62EB2924, 0xA8F8F8B8, 0x732C5249, 0x85EEFFA5,
+    0x6B0C5248, 0x15BAFB45, 0x732C5249, 0x009B9B45, 0x62CB41C7, 0xA9EDAE39,
+    0x732C5228, 0x19FFFFAE, 0x6B0C5269, 0x411E1929, 0x5A894A28, 0x069E5A6A,
+    0x62AA5228, 0x84D65521, 0x62AA5249, 0x405A6917, 0x5A8A49E7, 0x490D091B,
+    0x5A8A39A6, 0x1B1B1619, 0x31650000, 0x1B1B1B1B, 0x83CD41E7, 0xACACACAC,
+    0x6AEA5247, 0x07575B5B, 0x526841C6, 0xA1607470, 0x5A8941C6, 0x22225363,
+    0x52674206, 0x197EAD59, 0x5A682944, 0x3E7A2A2A, 0x5A8841E6, 0x296D6D6A,
+    0x52484A06, 0x146A6A5A, 0x5AAA4A08, 0xD6D59196, 0x5A895228, 0x91D1D5D6,
+    0x41E739C6, 0x75767777, 0x41E739C6, 0x7AAADEDE, 0x41E739A5, 0x37A7A6A6,
+    0x524841C6, 0xFCFDE9EC, 0x52892944, 0x1B6BABAF, 0x4A4839A6, 0xE8BDFEEA,
+    0x41E70000, 0xE4E4E4E4, 0x524841A6, 0x8F8F5E5E, 0x5AAA5A69, 0xA57E1F5F,
+    0x5AAA3986, 0x878687C7, 0x62EB4A08, 0x2E2E2E6B, 0x6AEB4207, 0x7E7F7F2B,
+    0x6B2C4A08, 0x9E9A89C9, 0x6B0B49E7, 0x36363635, 0x734C4A28, 0x43070757,
+    0x736D3165, 0xC5C5C9C5, 0x732C5AAA, 0x565B1A5A, 0x6B0C5249, 0x6F6A1B5B,
+    0x52694A07, 0x465695DB, 0x5AAA4A28, 0x295B5A9F, 0x62AA4A28, 0x549292AB,
+    0x62EB4A07, 0xA9BA3A2A, 0x62AA49E7, 0xAE5D5B51, 0x62AA5228, 0xE8E9486C,
+    0x62CA5269, 0xD6451569, 0x62AA5248, 0x57020605, 0x5A694A28, 0x5D002060,
+    0x62EA5228, 0xE1F9FDBD, 0x62CA3985, 0xB2F2E2A6, 0x6B0B41E7, 0x191A1B5B,
+    0x6AEB4A28, 0xC1D5D5A5, 0x6B0B5249, 0xAA979692, 0x6B0C5A8A, 0x1A6D5C48,
+    0x732C5A8A, 0xA4A5AAEA, 0x62CB5A69, 0x2F6F7B9A, 0x62CA4A28, 0x1E1E1E1A,
+    0x62CB5269, 0x147A7979, 0x732C62AA, 0x448A96EA, 0x7B8D62CB, 0x85A4A0E1,
+    0x7B6D6AEB, 0x693A397E, 0x7BAE62CA, 0x195A5F5F, 0x62CB2944, 0xE8F8E8E4,
+    0x732C5A8A, 0x6A196AAF, 0x6AEB5A8A, 0xAF2B2DAC, 0x732C5249, 0x5156025B,
+    0x6B2C5249, 0x96D1C598, 0x6B2C5A69, 0xBEAA5A87, 0x5AAA41C7, 0x6BABAB19,
+    0x62AA41C7, 0x16A6D790, 0x5A8A49E7, 0x59AEE954, 0x5A694A08, 0x392A1742,
+    0x5A8941E7, 0xB5B06501, 0x4A283165, 0x2F1F1B16, 0x29440000, 0x2F1B1B1B,
+    0x83CE41E7, 0x6C6C6CAC, 0x62EA2944, 0x1B1B5B5B, 0x52273165, 0xE8E8E9E5,
+    0x526841C6, 0x37272323, 0x524741C6, 0x2C6D7C58, 0x62C93165, 0x79792A29,
+    0x5A8939A6, 0x9C9C5959, 0x4A0741C6, 0x5EE9AC68, 0x62AA4A07, 0xA4A1D1D6,
+    0x526941E7, 0x2E7EB9FA, 0x41E73985, 0x94A5A9B9, 0x41E739A6, 0x828292A2,
+    0x42072944, 0x3A7A7B7B, 0x52483145, 0x4A197DBD, 0x41E720E3, 0x2F6E2E2B,
+    0x524841C6, 0xFAEAE9D4, 0x39C60000, 0xE4E4E4E4, 0x4A2839A6, 0xCFCFCFDF,
+    0x5AAA5A69, 0xA96F5B95, 0x5AAA3986, 0x8B8B8B87, 0x62CA4A08, 0x7E7E7F3F,
+    0x62EB5249, 0x2D3D7E3E, 0x732C5A6A, 0x898D8E8E, 0x6B0B5229, 0x32323131,
+    0x6B2C5248, 0x43434303, 0x6B2C2924, 0xC9C5C6C6, 0x732C62CB, 0x5A0B1655,
+    0x6B0C5A69, 0x5F5F1F1F, 0x5A894A07, 0x83070281, 0x5AA95248, 0x7F266978,
+    0x5A8A5248, 0x5A460659, 0x62CA5248, 0x1058D8D8, 0x6B0C41C6, 0x4A16A5B9,
+    0x62CB5249, 0x96EFEC99, 0x5AAA4A28, 0x469B9BEB, 0x5A895228, 0x48112977,
+    0x52694A07, 0x55445D9D, 0x6AEB41C7, 0x69B9A6D2, 0x5AAA3986, 0xA2B2A3A3,
+    0x62AA4A07, 0x051A5B1A, 0x62CB49E7, 0x91D0D591, 0x6AEB5269, 0xEEA591A9,
+    0x6AEB5A8A, 0x296A2A2E, 0x62CB5A8A, 0x5B2F65F0, 0x62CB5249, 0x2222266B,
+    0x62AA49E7, 0x16172B17, 0x5A8949E7, 0xA0D4D9AE, 0x6AEB4A28, 0xE4E8E9E9,
+    0x732C62CA, 0xD095D595, 0x734C62CB, 0xF9F9E4E5, 0x734C5248, 0x2E2E2E6E,
+    0x62EB20E3, 0xFCF8F8F8, 0x62CB5A69, 0x97BF2F58, 0x62EB5269, 0x89DB5BEF,
+    0x62AA5249, 0xD9E652B7, 0x6B0C4A28, 0xA2E292E6, 0x6B0C5A8A, 0xF9A56AB4,
+    0x62AA5249, 0x071A40AA, 0x526941C7, 0xFEA562BB, 0x5AAA4A08, 0xA36200FA,
+    0x5A8A49E7, 0x6F252466, 0x5A894A08, 0x6C585464, 0x52282945, 0x1B1A1A1A,
+    0x29240000, 0x1B1B2F2F, 0x83CE41E6, 0x6C6C6C6C, 0x5A892944, 0x1B1B1B1B,
+    0x4A072965, 0xE9E8E8E8, 0x524841E6, 0xA5666673, 0x4A4741C5, 0x6B6F2A69,
+    0x5AA841E6, 0x68647578, 0x5A883985, 0x696C9CAC, 0x4A2741C6, 0xDAE91E1F,
+    0x52694A07, 0xE1E1F1B4, 0x526941E7, 0x2A2A2A2F, 0x41E73985, 0x5F55F9D4,
+    0x41E73185, 0xA8A868EA, 0x39C62924, 0x3A6EBF7B, 0x52692104, 0x544297AF,
+    0x42082924, 0x9EBF6F2F, 0x524841E7, 0x489E9AEA, 0x39860000, 0xE4E4E4E4,
+    0x4A2839A6, 0x4D4EDDDE, 0x5AAA5249, 0xE5F4E4F5, 0x5AAA41C7, 0x0A0B4B4F,
+    0x62CB5249, 0x25293979, 0x62CB5228, 0x28286D2D, 0x6B0C5249, 0x889C9D8D,
+    0x62EB4A08, 0x67777736, 0x6AEB4A28, 0x56465747, 0x62EB2924, 0xC9C9C5CA,
+    0x6B0C62CB, 0x1001EBBA, 0x6B0C5A69, 0x1A1A2B1F, 0x52494A07, 0x07464682,
+    0x5AAA5248, 0x081D6C59, 0x5AAA4A08, 0x015A6F59, 0x5AAA4A28, 0x55266174,
+    0x62CB49E7, 0xB8B8BD9A, 0x62EB5249, 0xE5E5E5E8, 0x62CA4A28, 0x05060747,
+    0x52694A07, 0xA8A9A7D9, 0x52694A07, 0xE5A55511, 0x62CA4A08, 0xB9A9A978,
+    0x52693165, 0xF6F3B3F3, 0x5A694A07, 0x05060716, 0x5A8A49E7, 0x9495A0D4,
+    0x62EB4A08, 0x91A9FAFB, 0x62AA5A69, 0xE78F2E3F, 0x62CB5249, 0x155446E6,
+    0x62CB5228, 0x48551967, 0x5AAA41E7, 0x1859A55B, 0x526941A6, 0x64A9A9FA,
+    0x62EB41E7, 0xE0E5E5F9, 0x6B0C62CA, 0xA998E995, 0x736D62CA, 0x6196E6B5,
+    0x734C5AA9, 0x296A6D1D, 0x6AEB2104, 0xF8FCFCFC, 0x6AEB5A8A, 0x07AF5996,
+    0x62CB4A08, 0x16A7EBAA, 0x6AEB5249, 0xD89580D1, 0x6B0C4A08, 0xADA4A576,
+    0x6AEB5AAA, 0x0B16656D, 0x62CB4A28, 0x2B165515, 0x5A8A49E7, 0xE4809555,
+    0x62AA41E7, 0xBAA5A551, 0x524849E7, 0x82666E6F, 0x5A6941C7, 0xA9A99D6C,
+    0x4A283165, 0x1A1A172B, 0x29240000, 0x1B1B1B2F, 0x83AD41E7, 0x6C6C6C6C,
+    0x5A892965, 0x17171B0B, 0x4A273165, 0xE8E8E8E9, 0x524839C5, 0xDAA6A2B6,
+    0x4A272945, 0x1B1B2F7F, 0x5AA82945, 0xE0E5A9A9, 0x5A8839A6, 0xB4B8B86D,
+    0x4A2741C6, 0xFAAA1E87, 0x526941C7, 0xA4B4B5E5, 0x522839A6, 0x3F3E7E7F,
+    0x41C73165, 0x5A99455F, 0x41C63165, 0xE9A4B9BD, 0x42072924, 0xB6BA3726,
+    0x4A082924, 0xAEEE3D2C, 0x52482944, 0x96978A89, 0x4A2841E6, 0xC489E9A9,
+    0x31650000, 0xE4E4E4E4, 0x4A283985, 0x1E2E6E5E, 0x5A894A08, 0xD1969BAB,
+    0x52693986, 0x2A5B5B5B, 0x5A8A4A28, 0x2A6A6A7E, 0x62AA4A08, 0x7C296D6D,
+    0x62CB5228, 0x8D8C8D8D, 0x62CA4A07, 0x27777777, 0x5A894A08, 0x49525757,
+    0x62CA2924, 0xCACACACA, 0x62CB62AA, 0xA6A6FB57, 0x62CB5A69, 0x296B6B6F,
+    0x526949E7, 0x6A5B5B17, 0x5A6941E7, 0xA469FDAE, 0x5A6941E7, 0x45165B4B,
+    0x526941E7, 0x4696E5FA, 0x5A8A41C7, 0xD192E5F4, 0x62CA4A08, 0xE2A6A6F6,
+    0x526941C6, 0x0B16966B, 0x524841C6, 0xA5A8A9FD, 0x524841C6, 0x90E5AAFA,
+    0x5AAA4A07, 0xA079AAB9, 0x5ACA3144, 0xE2A1A2A2, 0x5A6939A6, 0x5A1B1A5A,
+    0x524841C6, 0x69E465A4, 0x62CB41C6, 0x1545A5D5, 0x62CB4A28, 0x38569BDF,
+    0x5AAA4A28, 0x631369B9, 0x62AA4A28, 0x111155D5, 0x5A694A07, 0x6A13156D,
+    0x524839A6, 0x5295E5A9, 0x62CB3985, 0xD0D1D1D1, 0x6AEB5A69, 0x9499A9DA,
+    0x6B0C5A8A, 0x551696F7, 0x6B0B5248, 0x20796A6D, 0x732C2104, 0xF8FCE8E8,
+    0x6B0C5249, 0x1696962B, 0x62AA41E7, 0x2A2AABAF, 0x62AA41C6, 0x25357A65,
+    0x62AA49E7, 0x1B9AAD58, 0x62AA3986, 0x40919B56, 0x5A8A41E7, 0x156B1756,
+    0x526941C7, 0x46DA94D4, 0x526941C7, 0xE9F968BA, 0x524941C7, 0x107A55FB,
+    0x526941E7, 0x529B5AFF, 0x49E72924, 0x161A065F, 0x29040000, 0x1A1B1A1B,
+    0x7B4C39C6, 0xACACAC6C, 0x62892124, 0x4B171757, 0x4A273165, 0xE8D9E9ED,
+    0x52683165, 0x98D8D9D9, 0x4A272125, 0x4B5B5B1B, 0x5A892124, 0x91D1E4E4,
+    0x52683165, 0x7272B6B5, 0x524841C6, 0x161261B5, 0x524841C6, 0xB4B8B8F8,
+    0x524841C6, 0x7A7A2E2E, 0x41E73985, 0x6A5A4B46, 0x39C639A6, 0xDFCBC7C2,
+    0x41E73165, 0xA2B2B2B2, 0x4A0841C6, 0x42474706, 0x4A072924, 0xA2A2A797,
+    0x4A2841C6, 0xD191D0D4, 0x29440000, 0xE4E4E4E4, 0x4A073165, 0x19296E6E,
+    0x526941C7, 0x1555A6E6, 0x524939A6, 0x192A2B2F, 0x526939C6, 0x98AEBFBF,
+    0x5A8A41C7, 0xA8A8A8BD, 0x5AAA41C7, 0x282D6DEE, 0x5A8A41C7, 0x5252637B,
+    0x524941C7, 0x2828195E, 0x528A2924, 0x8686CACA, 0x62AA5269, 0x1565AAFE,
+    0x5AAA5249, 0x142D6DBE, 0x524941E7, 0x06554697, 0x524839A6, 0xA4B9B9F9,
+    0x4A0841C7, 0x151E1F5F, 0x4A2841C6, 0x5429598E, 0x52493986, 0x454595D5,
+    0x5AAA39A6, 0x409592E7, 0x52693986, 0x15261657, 0x4A0739C6, 0x565BAAFA,
+    0x524841C6, 0x155995D5, 0x5AAA41E7, 0x509494E5, 0x52692924, 0x92E2E2E2,
+    0x4A2739A6, 0x565B1A5B, 0x41E739A6, 0xDBDAA5BE, 0x4A073986, 0x3B5A697E,
+    0x5A8A3986, 0x20357D7D, 0x62EB4A08, 0x04050613, 0x522841C7, 0xD4E9B9BA,
+    0x524939A6, 0xE1A5A9BE, 0x4A283985, 0x4797B6A6, 0x52693164, 0x9495D5D6,
+    0x5AAA5249, 0x054095EE, 0x62CB5249, 0x181899EA, 0x62CA4A28, 0x26256975,
+    0x62CB2945, 0xB8ACBCFC, 0x5A8A4A08, 0x020515B6, 0x5A6939A6, 0x561B1B6E,
+    0x524839A6, 0x879EEDBE, 0x5A693165, 0x461A2B6B, 0x41C72924, 0x004091E5,
+    0x52283986, 0x14546AAF, 0x52483165, 0x4459AAAF, 0x52493986, 0x5056EAEA,
+    0x4A283986, 0x15156ABF, 0x524939A6, 0x151566BB, 0x41C62104, 0x1A165A6B,
+    0x29040000, 0x061A1B1B, 0x6B2B3185, 0xACACACAC, 0x5A892945, 0x07470707,
+    0x52473985, 0xE4E4A8A4, 0x52483985, 0x99D95948, 0x41E62945, 0x95C2D287,
+    0x52672945, 0x818185D1, 0x526841C6, 0x5762A363, 0x4A2741E6, 0x253A6767,
+    0x524839A6, 0xBCA8A8A8, 0x4A4839A6, 0x2F6F6E7E, 0x41E73165, 0x1A2B1B5A,
+    0x420739A6, 0xC2C28555, 0x41C63165, 0xB5F6F2F2, 0x42073145, 0xE1E1E6FB,
+    0x41E72924, 0xF6E6A6A2, 0x524839A5, 0xA4E4E5E5, 0x29240000, 0x9090E0E4,
+    0x39C618C2, 0x196A6EAF, 0x41E72944, 0x1469BABF, 0x41E72944, 0x54A9AEAF,
+    0x4A082924, 0x54A4A9ED, 0x4A283145, 0x10A4A8FD, 0x52482924, 0x156969BD,
+    0x5A692924, 0x415696A7, 0x42072924, 0x1868BEBF, 0x41E720E3, 0x458A8BCB,
+    0x524939A6, 0x0055AABF, 0x4A283185, 0x54A9BEFF, 0x42073165, 0x0056AAFF,
+    0x4A082945, 0x0055A9B9, 0x41E72945, 0x005AABAF, 0x39C62924, 0x00AAEAFE,
+    0x41C72924, 0x0559A9EA, 0x41E720E3, 0x4156FAFA, 0x39A63145, 0x13A195FB,
+    0x41C72924, 0x54A9AEBE, 0x41C63165, 0x00AAAABF, 0x42073165, 0x54A9FAFA,
+    0x41E720E3, 0x6162A2E2, 0x41E72924, 0x4596ABBA, 0x41A62924, 0x0055AAFB,
+    0x41C72944, 0x1555AAAF, 0x41E72944, 0x4095D9E9, 0x52483165, 0x41969AAF,
+    0x42082924, 0x5155AAEE, 0x4A282944, 0x1155AAEA, 0x4A283145, 0x04468A9B,
+    0x39C72924, 0x425757E5, 0x52493185, 0x546AAAEF, 0x5A6939C6, 0x4499EEEE,
+    0x5A8A3185, 0x155AABBF, 0x5A892104, 0xA8A8BCFC, 0x52283185, 0x156AABBB,
+    0x41E73165, 0x4196ABAB, 0x4A283165, 0x115297DA, 0x42072924, 0x5469669B,
+    0x39A63145, 0x055B1A00, 0x41E73145, 0x14257D6E, 0x39A620E3, 0xA9EAEA8A,
+    0x39A62904, 0x54A9F9BE, 0x41C62945, 0x4095AABE, 0x41E72944, 0x156ABFBF,
+    0x318518C3, 0x156A6F6F, 0x20E30000, 0x06060B0B, 0x6AEA3186, 0xACACACEC,
+    0x5A883165, 0x07070607, 0x4A273165, 0xE8E8E8E5, 0x4A4741C6, 0xE8685454,
+    0x4A483145, 0xB4A8A9A4, 0x5A882945, 0x1F1A0646, 0x526739C6, 0xC9C58596,
+    0x4A4739A5, 0xAD6D5899, 0x524839A6, 0xA8ACBCBC, 0x524839C6, 0x1A5A6E2E,
+    0x41C73165, 0x0A0A0B1B, 0x41E73185, 0xCBDA96E7, 0x39C63164, 0x3B7A7EBE,
+    0x41E618C4, 0xE4E4E5F5, 0x41E63165, 0xA4E0A5B5, 0x52693185, 0x99D5E5A4,
+    0x10610000, 0x000040D0, 0x21040000, 0x001469BE, 0x29240000, 0x0055AAFF,
+    0x29240000, 0x0055AAFF, 0x29240000, 0x0055AAFF, 0x31450000, 0x0054AABB,
+    0x31450000, 0x0055AABF, 0x31450000, 0x0055AAFB, 0x29440000, 0x0055AABE,
+    0x29240000, 0x00459AEF, 0x31650000, 0x0055AAFF, 0x31650000, 0x0055AAFF,
+    0x29240000, 0x0055AAFF, 0x29450000, 0x0055AAFA, 0x29240000, 0x0055AAFF,
+    0x29040000, 0x0055AAFF, 0x29240000, 0x0055AAFF, 0x29450000, 0x0055AAFA,
+    0x31450000, 0x0055AABB, 0x29240000, 0x0055AAFE, 0x29240000, 0x0055AAFF,
+    0x29450000, 0x0055AAFF, 0x29440000, 0x0055BAFB, 0x29240000, 0x0055AEFF,
+    0x21040000, 0x0055AAFF, 0x29040000, 0x0055AAFF, 0x29240000, 0x0055AAFF,
+    0x31650000, 0x0055AAFF, 0x29450000, 0x0055AAFF, 0x29450000, 0x0055AABF,
+    0x29440000, 0x0055AABF, 0x29040000, 0x0055AAFF, 0x31650000, 0x0055AAFE,
+    0x39A60000, 0x0055AAFF, 0x39860000, 0x0055AABF, 0x39C60000, 0x0054A9FE,
+    0x31650000, 0x0055AABF, 0x31650000, 0x0055AAFF, 0x31650000, 0x00556ABF,
+    0x29450000, 0x0055AAFE, 0x29240000, 0x0055AAFF, 0x29240000, 0x0055AAFF,
+    0x29240000, 0x0055AAFF, 0x29040000, 0x0055AAFE, 0x29240000, 0x0055AAFF,
+    0x29240000, 0x0015AAFF, 0x20E30000, 0x00005AAF, 0x08410000, 0x0001061B,
+    0x734B3986, 0xAC6C5868, 0x5A682965, 0x06460607, 0x4A272945, 0xE494A4E8,
+    0x4A273985, 0xA89C9CED, 0x4A272924, 0x934291F5, 0x52672925, 0x1A1A1A1F,
+    0x4A473185, 0xC4C9C9DE, 0x524841C6, 0xA8948484, 0x4A2841C7, 0xD8D8ACAC,
+    0x524839A6, 0x1F1F1F1F, 0x39A62944, 0xDB9B8B8B, 0x41E73185, 0xD2C68646,
+    0x41C618E3, 0x2A7A7E7E, 0x39C618C3, 0x41E1F5F5, 0x41C618C3, 0xA8BCB9F9,
+    0x4A2739A6, 0xE0A4E4F8, 0x4A4818C2, 0xAAFFFE50, 0x52682944, 0xAAEAFF40,
+    0x5A893985, 0x55AAFE40, 0x5A8941C6, 0x54BAAB00, 0x5A6939A6, 0x55BABA00,
+    0x62CA39A5, 0x55A5E550, 0x62CA41C6, 0x5556AB00, 0x5A8941E6, 0xFAAAFF00,
+    0x62EA4A08, 0x5555FA00, 0x734C5228, 0x0055FE00, 0x734C5248, 0x0055FF00,
+    0x736C5248, 0x5595BF04, 0x734C41E7, 0xAAAAAF01, 0x7B8C4A28, 0xAAAAFE54,
+    0x736C5A89, 0x0001BF10, 0x732C5268, 0x1A5AFF05, 0x734C5268, 0x95E9FE00,
+    0x7B6C5268, 0x96ABEB50, 0x7B8D5A89, 0xA5AAFB40, 0x83CE62CA, 0xA9A9FE10,
+    0x83AE62CA, 0xAAAAFF40, 0x83CE6AEB, 0x05AAFF00, 0x83CE62AA, 0xA565FB05,
+    0x83EE5A8A, 0xFEBAFF00, 0x83CE62CA, 0xAFFAFF00, 0x8BCE62EA, 0xAAABFF00,
+    0x8BEF62EB, 0x55AAFF40, 0x9450732C, 0x0056FB00, 0x8C0F5AAA, 0xA9AAAB01,
+    0x8C0F62CA, 0xAAAAFF14, 0x8C0F5AA9, 0xAAAAFF10, 0x8BEF5269, 0xAAAAAF01,
+    0x8C0F5A69, 0xFEAAAB00, 0x8C0F5A89, 0xBFAAAB00, 0x83CE5248, 0xEAAFFF05,
+    0x94305228, 0xFAFEEA40, 0x9C715A6A, 0xAEAAFF00, 0x9C715249, 0xAFAAFF00,
+    0x9C514A29, 0xEAAAFF00, 0x94305249, 0xEBAAFF00, 0x94515228, 0xAFAAFF00,
+    0x9C714A28, 0xEABAFF00, 0x9C514A28, 0xFFFAFF00, 0x9C9141C7, 0xFFBFBF00,
+    0x9C5039C7, 0xFFFFFF00, 0x94503986, 0xFFFFFF00, 0x9C913986, 0xFFFEFF00,
+    0x9C513145, 0xFFFFFF00, 0x7B8D4A27, 0x16575B28, 0x5A892944, 0x07175657,
+    0x4A272925, 0x90A0D0E4, 0x522741C6, 0x045C5E0D, 0x4A072924, 0xABA6B1E2,
+    0x4A0731A6, 0xAB1F2E2B, 0x52683165, 0x6C5C8DC9, 0x4A4741A6, 0x1A1F2E79,
+    0x4A2841E7, 0xC5C5C4D8, 0x524939A6, 0x06070B1B, 0x39C63185, 0x6B6BEB87,
+    0x41E73165, 0x4480D4D5, 0x41E70841, 0x2E2E6E6E, 0x52EB0841, 0xE5A49400,
+    0x4A891081, 0x5B9A9694, 0x4A2839A5, 0xE4E5A9A5, 0x31652104, 0x06015AE9,
+    0x39A62104, 0x000004FE, 0x39A62104, 0x005550FF, 0x41C62104, 0x005155FF,
+    0x41E62924, 0x001055FA, 0x4A072124, 0x105465FA, 0x41E72924, 0x004045FB,
+    0x42072924, 0x000515FF, 0x4A072104, 0x004155BF, 0x4A272924, 0x0005A9FA,
+    0x52482104, 0x0040AAFA, 0x5A893165, 0xA4A5EAFF, 0x5A8941C6, 0x01A5AAAF,
+    0x5AA941C6, 0x90AAAEFF, 0x5AA95248, 0x0055B9AB, 0x62AA5248, 0x4040561F,
+    0x62EA4A27, 0x51918AFD, 0x6B0B41C6, 0xFEEAE692, 0x736D62CA, 0xFAA6A550,
+    0x7B8D6B0B, 0x56FEFA51, 0x83AE6AEB, 0x456ABA55, 0x7BAD732C, 0xA900FFBD,
+    0x7B8D6ACB, 0xFF45EF01, 0x7B8D6AEB, 0x42FAFEE5, 0x83CE7B6D, 0xB845A8FE,
+    0x8BEF7B8D, 0x5565162B, 0x83CE6B2C, 0x5BFF6901, 0x83CF734C, 0xA5BA51E4,
+    0x8BEF734C, 0x559645EA, 0x83CE6AEB, 0x904256FF, 0x83CE6B0B, 0x6EA405AF,
+    0x83AE6B0B, 0x50FAA4AA, 0x8BEF734C, 0x1469ABAF, 0x83AE6AEB, 0x54016B1B,
+    0x83AE39A6, 0xAA6A1ABE, 0x8C0F5248, 0x009195FA, 0x8C0F5A89, 0x00AEAAFF,
+    0x8C0F3144, 0x15FFFEFF, 0x8C0F41E7, 0xE4FFFFFF, 0x942F7B6D, 0x5A19BEBE,
+    0x94307B6D, 0x95A4A5FA, 0x9430838D, 0x41AA96E6, 0x8C0F7B6D, 0x055A99AF,
+    0x8BEF7B6D, 0x58A5F692, 0x94307B8D, 0x0165AAE9, 0x9410736D, 0x00AAAAAB,
+    0x9430734D, 0x40FFFEAA, 0x9430732C, 0x45BEFFAA, 0x734C4A07, 0x16575353,
+    0x528918C2, 0xE592461B, 0x636D18C2, 0x1B194050, 0x52483165, 0xE8E99699,
+    0x52273165, 0x561B1E59, 0x526839C5, 0xE5986855, 0x52683145, 0x15192C2C,
+    0x4A4839A5, 0x6F6F2F69, 0x4A2841C6, 0x4595D5DA, 0x4A283985, 0x1B1A595A,
+    0x39A63185, 0x55555A6B, 0x41C63164, 0x2A7625A5, 0x4A071082, 0xBEBE6A29,
+    0x428A1062, 0x150154E5, 0x422818A2, 0xA9A4959B, 0x524841C6, 0xA59585C4,
+    0x31852104, 0x97ABE641, 0x39A52924, 0xFEA56A00, 0x39C62924, 0xBFFEA900,
+    0x39C52924, 0xAEAB5501, 0x39C62124, 0xFAAA5500, 0x41E62124, 0xFFAA1500,
+    0x41E62924, 0xABAA5440, 0x41C63145, 0x6FFF5900, 0x41E63165, 0xEA5B9A01,
+    0x4A073165, 0xFF55A500, 0x4A073164, 0xFF955540, 0x4A073985, 0x6EAD5110,
+    0x52483165, 0x95EAB950, 0x524841E6, 0x19FAAA54, 0x524849E7, 0x506B5595,
+    0x52484A07, 0xAA50AA1B, 0x62CA4A07, 0x050095F4, 0x5AA939A5, 0x0155AAFB,
+    0x62CA41A6, 0x4095AABF, 0x6B0B4A27, 0x50A9AAE6, 0x734C4A27, 0x5055AAFF,
+    0x732C5248, 0x0195AAEB, 0x6B0B5A89, 0xE4AFFFEF, 0x83AD62A9, 0x15A405BE,
+    0x7B8D5A89, 0xF85AF9AF, 0x83AD62CA, 0x5940AAE9, 0x8C0F62CA, 0x00A555FF,
+    0x83CE5248, 0x05FB9AAF, 0x8BEF4A27, 0x00AA5AFF, 0x7B8D5A89, 0x6455546F,
+    0x734C5AA9, 0x5556AAE4, 0x734C62CA, 0x0541406F, 0x736C5A89, 0xFA545501,
+    0x734C5AA9, 0x9BAA5600, 0x7B6C6AEA, 0xB5A69450, 0x6B2B4A07, 0xEFBB5A1A,
+    0x736C4A07, 0xFFAAA900, 0x734C41C6, 0xFFAAFE15, 0x7B6C5248, 0xFF9AEBF8,
+    0x7B6D62CA, 0x6A50AABF, 0x7B6D62CA, 0x056AABFE, 0x7BAD62CB, 0x505559FF,
+    0x7B8D62CB, 0xAA0069EF, 0x7BAE62CA, 0xAA0045AB, 0x7B6D6AEB, 0xAA50059B,
+    0x734D6AEB, 0x5B5A50A5, 0x734D62CA, 0x059595E6, 0x6B2C5249, 0x159BAA5B,
+    0x62CA4A27, 0x766B2A2B, 0x4AAA18A2, 0x4692E1F5, 0x636E18C3, 0x41161A1B,
+    0x52683165, 0x945898E8, 0x528939A5, 0x17574646, 0x4A2741E6, 0x0B9317F7,
+    0x41E72944, 0x76757475, 0x4A2839C5, 0xD556562A, 0x41E73985, 0x8B9BAAAF,
+    0x52483165, 0x57671617, 0x39862944, 0x196E59AA, 0x39A62944, 0x266A6A3B,
+    0x41C63165, 0xC1D6419D, 0x39A52924, 0xF6F3B2A2, 0x39C63144, 0xA4A8AAE5,
+    0x4A2841C6, 0xF4F0E0E6, 0x41E72104, 0xBE6A1A1B, 0x4A072944, 0x9BA56450,
+    0x4A273165, 0x516579A9, 0x41E63144, 0xA705AB5A, 0x4A273144, 0xFA64A565,
+    0x41E63985, 0x6141E680, 0x41E63185, 0x8AD2AB66, 0x41E63164, 0xE4AFAA56,
+    0x4A273165, 0xE5506501, 0x4A273985, 0xABA95900, 0x4A073165, 0x1AFE5AA5,
+    0x52473145, 0x40AA55F9, 0x5A8839A6, 0x056550EA, 0x5A6941C6, 0x541501AB,
+    0x526839C6, 0x6A0414FA, 0x52683985, 0xAA0555FF, 0x5AA93185, 0xA550A5FF,
+    0x5A8941A5, 0x1AB9BAFF, 0x5A693165, 0xE4FABBAB, 0x5A894A07, 0x69ABBA90,
+    0x52483165, 0x1A66AABA, 0x5A883165, 0xA4BD6AA6, 0x62CA4A06, 0x0550A4F9,
+    0x6B0B39A6, 0x9064AAFF, 0x6B0B41E6, 0x5A556A0B, 0x734B39A5, 0x050550F9,
+    0x734C39C5, 0x14A4F9FF, 0x734C3985, 0x106AFBAA, 0x736C3985, 0xA459AAFA,
+    0x6B0B5228, 0x69AAA4E7, 0x734C5A89, 0xE4E55156, 0x732B5248, 0xB1965AEA,
+    0x7B8D5248, 0xF0415556, 0x7B8D5AA9, 0xBF6514EA, 0x734B41E7, 0x05A9FEFF,
+    0x736C5227, 0xA4AEAF1A, 0x6B2B5A89, 0xBFFF296C, 0x734C5248, 0x55FA9055,
+    0x734C5248, 0x00AFEA5A, 0x7B6D5248, 0xE901AAA5, 0x7BAE5A69, 0xFF5455A5,
+    0x7B8D5A89, 0xBFAA01BA, 0x7B8D5A89, 0x16FFE9FA, 0x7B8D41E6, 0x01FFFBFF,
+    0x7B6D41E6, 0x40FFFEEA, 0x7B6D5A89, 0x54BEAFAA, 0x734C62CA, 0xA91A45BE,
+    0x736C4A08, 0xBF0541EA, 0x62EA5228, 0x3F3C7A3A, 0x524810A3, 0x5A5A5B1B,
+    0x4A0710A2, 0xE9E9A9A4, 0x4A073985, 0x4B8D0C88, 0x522839A5, 0x518BAA27,
+    0x524839A5, 0x1F1A0A4A, 0x41E62944, 0x9692A6B3, 0x4A073985, 0xFC7868EA,
+    0x41E73985, 0x9B8A868B, 0x4A281061, 0x2B6AABAB, 0x31650861, 0xA441AAAF,
+    0x318518E3, 0x7479BFBB, 0x39A62924, 0x43D6D6D6, 0x41E62104, 0x74B4F1A5,
+    0x39C63144, 0x92A7A6A6, 0x4A2841C6, 0x74F5F5F5, 0x52483144, 0xA69495E9,
+    0x41E72924, 0x424251A3, 0x52482103, 0x94969B5A, 0x4A073185, 0x265200E4,
+    0x42073165, 0x2801409B, 0x41E62944, 0x95A51B6A, 0x41E62104, 0xEBD15019,
+    0x41E62924, 0xAF6A1F82, 0x41E62104, 0x5A0494FE, 0x42062124, 0x90A4EAFE,
+    0x4A063985, 0x4065FEAA, 0x4A0739C5, 0x95A99AB9, 0x4A273164, 0xBFFEEA11,
+    0x4A073164, 0xAAFF5AA4, 0x52472104, 0x564656EF, 0x524739C6, 0x6985459B,
+    0x52684A07, 0x6B099469, 0x4A283164, 0x0A5BABAF, 0x52682904, 0xFFF59191,
+    0x526841E6, 0x1A9FAABF, 0x52682924, 0xE5560A0B, 0x62C92924, 0xAFAAB8A4,
+    0x52683144, 0x401A7F6F, 0x5A892924, 0xEEE590D5, 0x62EA3185, 0x0A6EAEBE,
+    0x5AA93165, 0x9065FA57, 0x5AA93985, 0xAFA9015A, 0x52683165, 0xBF060169,
+    0x62EA39A6, 0x5594D0E4, 0x62EA41C6, 0xBE6F2F6F, 0x6B0B41E6, 0x0194A4F9,
+    0x734C49E7, 0x0095E5A1, 0x7B8D2944, 0x5145AAFA, 0x734C5248, 0x945115BF,
+    0x6B2B41C6, 0x6BABA900, 0x6B2B5248, 0xE5001550, 0x62EA41E6, 0x9B1A1A6A,
+    0x5AA941E6, 0xEA945055, 0x6B2B4A27, 0xAEA9B9F4, 0x7B6D62A9, 0x591004FD,
+    0x7B8D5248, 0x450515AB, 0x62EB41C6, 0x6AA9406B, 0x5A8939A6, 0xAAEAE991,
+    0x62CA5228, 0x406DAAA9, 0x62CA5228, 0x016A7EAA, 0x52493986, 0x01AA6A07,
+    0x732C41A6, 0xF99080E0, 0x7B8D5A89, 0x5A5601E9, 0x6B0B5227, 0x292A696B,
+    0x52472124, 0x5616575B, 0x4A072965, 0xE4E4E5A5, 0x5A6841C6, 0x2A7D5148,
+    0x4A271082, 0x2AABFEFF, 0x4A6918E3, 0xE950166F, 0x420720E3, 0x87D1D9D6,
+    0x52473164, 0xA4A4E4F8, 0x4A2739C6, 0x57571706, 0x4A080861, 0x1B1B5B1B,
+    0x52CB1904, 0x94F5A5A4, 0x3A2820E3, 0x52474642, 0x39C62903, 0xE7E3A2A3,
+    0x41C62103, 0x657574B4, 0x41C63164, 0xE6E6A292, 0x4A4841C6, 0x7474B4B4,
+    0x41E72103, 0xAAA654F4, 0x42072104, 0x51560A1F, 0x41E72944, 0x1A6AE4E0,
+    0x52483165, 0x010157AA, 0x41E63185, 0x62796915, 0x41C62924, 0x1AAAABEE,
+    0x41E62104, 0x0156FAFF, 0x42062924, 0xE4005B2F, 0x52482104, 0xFE950001,
+    0x4A272925, 0xAFFAA590, 0x52673185, 0x04FFE955, 0x4A272924, 0x41AAEBBA,
+    0x4A472944, 0xA9015AFA, 0x4A272945, 0xFFE90506, 0x5A682924, 0xAFFEE990,
+    0x52684A07, 0xA41BABA9, 0x52483985, 0x1AFE55A9, 0x5AAA39A5, 0xF451A955,
+    0x5A8939A5, 0x0BA5116A, 0x5A6941C6, 0xA45BBA41, 0x52683144, 0x1BEEAAFF,
+    0x62AA3985, 0x546AF9AA, 0x5AC93985, 0x05501FB9, 0x52683185, 0x15EA50FF,
+    0x524839A5, 0xAE56BE51, 0x5AA93165, 0x05A915FE, 0x5AAA3144, 0x50BA545A,
+    0x62CA3985, 0xE90540E5, 0x5A8941C6, 0x87A46E07, 0x62EA3985, 0x5A91F9BE,
+    0x6B0B5248, 0xB8255655, 0x62EB49E7, 0xB9B8B8E9, 0x6B0B3145, 0xFBFA9640,
+    0x62EA41C6, 0x6F6A4090, 0x7B8D4A27, 0x6814696E, 0x62CA5248, 0x95ED61D1,
+    0x6B0B49E7, 0x01EAAA5B, 0x6B0B3965, 0x55FF6A01, 0x62CA41C7, 0x55AB05E4,
+    0x734C41C7, 0xA90140FA, 0x6B2B49E7, 0x5B90A56F, 0x62CA3986, 0x55FF5A01,
+    0x5AAA39A6, 0xE5FFA505, 0x6B0B3986, 0xFFAAEA00, 0x732C41E7, 0xFFAABE00,
+    0x6AEB4A07, 0xBFBF5B94, 0x62CA4A28, 0x55BF50BF, 0x6B0C3965, 0xFAAAA901,
+    0x62EA41E6, 0x7A797A7C, 0x4A072945, 0x03070707, 0x4A072945, 0xA4E4A4E4,
+    0x522741C6, 0x60554A0B, 0x62A91081, 0x5A2A1E1A, 0x638E18E3, 0xA4A9F9F9,
+    0x426918C2, 0x97978686, 0x526839C5, 0xA7A7E155, 0x4A0741A6, 0xA3A3A267,
+    0x41E70841, 0xAFAFAF2F, 0x31650882, 0xFFAB51E5, 0x398518E3, 0xFFBFEDA8,
+    0x41E72924, 0xE5E6E1E5, 0x41C62944, 0x77362564, 0x41C63185, 0x9596A2E2,
+    0x4A2839A6, 0x24247474, 0x41C62104, 0x55AB5941, 0x41C62944, 0xE4595581,
+    0x39C62924, 0xFF46A9D5, 0x39A52924, 0x17E8005E, 0x39A62124, 0x55AAE902,
+    0x42272944, 0xA515BF94, 0x41E62944, 0xEF9455A6, 0x42263185, 0x46D500EA,
+    0x4A073165, 0x56FF401B, 0x4A473164, 0xA9AFFE90, 0x4A2739A5, 0x5A55FF80,
+    0x4A273985, 0x91A9EBFB, 0x4A2741C6, 0x4024FAAB, 0x4A2741C6, 0x7E005752,
+    0x524741C6, 0xE09550B4, 0x526839A5, 0x6FAA951A, 0x526941C6, 0xE4055964,
+    0x526841C6, 0xEFA99905, 0x524841A6, 0x47AB95A4, 0x4A073985, 0xEABBFE2B,
+    0x6B2B3185, 0xFA551554, 0x6AEB39A5, 0x6BA50001, 0x62A939A6, 0xFEFE9044,
+    0x6B0B5228, 0x5F5B0500, 0x5AA941E6, 0xAFFFFD52, 0x62AA4A27, 0xA9EA9A54,
+    0x62EA4A07, 0xFF5AAA1A, 0x62EA49E7, 0x97F91790, 0x6B0B4A07, 0x7A06A46A,
+    0x6B0B49E7, 0xE0A94655, 0x62EB4A07, 0x5B698690, 0x62CA4A07, 0xEABDEB60,
+    0x62EB5228, 0x5B565409, 0x62AA3985, 0xAAAFFA41, 0x62EA41E6, 0xAA56962F,
+    0x62EA41A6, 0xAF556A50, 0x5A894A27, 0x9BD555C4, 0x5A695227, 0xEA5615BB,
+    0x62CA4A07, 0xFAE59451, 0x62CA4A28, 0xFFFAA601, 0x736C5269, 0xFEEA50A4,
+    0x6B0B5A69, 0x47FFB996, 0x734C5A68, 0xF99541AA, 0x6B2C5228, 0xFBAA9506,
+    0x734D5228, 0xFFFAAA00, 0x734D5249, 0xAFFBAA50, 0x732C62AA, 0xAEBF1AB4,
+    0x732C62CA, 0x41AA405A, 0x62AA5228, 0x64253575, 0x4A072945, 0x06420307,
+    0x41E62945, 0x6968A8E8, 0x52483185, 0x90D55569, 0x5AA920E3, 0xEB561515,
+    0x526810A2, 0xABAF5A50, 0x41E610A2, 0xBABABAB4, 0x4A2741C6, 0xBAA6A3F3,
+    0x420739C6, 0xE3A3E3F3, 0x41E73165, 0x47070757, 0x39A63164, 0x45B85556,
+    0x39C63144, 0x8F8EA99A, 0x41E72944, 0xA9E5E5E1, 0x49E73144, 0x66676626,
+    0x41E63165, 0x87969291, 0x4A073185, 0x3A397979, 0x41E63185, 0xFEE59554,
+    0x41E639A5, 0x96E541D9, 0x41E62924, 0xEBEBA602, 0x41E63185, 0xD64B5A94,
+    0x41E63164, 0x17A5F5EF, 0x41E63185, 0x4095FED2, 0x41E639A5, 0xB84A075B,
+    0x41E63185, 0x10CBEFA9, 0x41E63985, 0x81DB90AB, 0x49E639A5, 0xAB0B0645,
+    0x41C639A5, 0xEA95FEAF, 0x4A0739A5, 0x5695E5A8, 0x4A273985, 0x0506AFDA,
+    0x4A2739A6, 0xA454466F, 0x5A8939A5, 0xFA415555, 0x62CA39A6, 0xBF950154,
+    0x62CA3985, 0xFEEA5005, 0x6AEB39A6, 0xFFAFA940, 0x7B6D49E7, 0xFFAA5540,
+    0x736C5248, 0xFBFA415A, 0x732B5A89, 0x466F951A, 0x6B2B5AA9, 0xB9697F64,
+    0x732C62AA, 0x6E599500, 0x6B0B5AA9, 0x6A56AB1A, 0x6B0B6289, 0xAA5419F9,
+    0x732C62CA, 0xA651001B, 0x6B0B5A89, 0x5B5B0605, 0x62EA5269, 0xFFA2557E,
+    0x62EA4A07, 0xFEFFAA90, 0x6B2B5269, 0xBE5AA906, 0x6B0B5249, 0x9A6A417E,
+    0x736D5248, 0xBF554514, 0x6B2C5228, 0xABAA5554, 0x6B0B5A69, 0xFAE944E9,
+    0x732C5228, 0xFAAB5607, 0x736C5248, 0xFFAA6950, 0x736C62AA, 0xFBE95400,
+    0x7B6C5A69, 0xBAFF1515, 0x732C5A69, 0xBAFF4500, 0x6B0C5A89, 0xBFBF5550,
+    0x6B0C62AA, 0xAE02AAE0, 0x83AE41A6, 0x925256FF, 0x734C5A69, 0xFB04115B,
+    0x7B6D5A8A, 0xFAA95050, 0x7B6D62CA, 0xFF95A554, 0x734D62AA, 0xFFAA5A01,
+    0x7B6D62AA, 0xFAAA0054, 0x7B8D62AA, 0xFBEA00A5, 0x62CA4A07, 0x36267566,
+    0x39A62925, 0x4A0B0B0B, 0x39C62945, 0xD9946479, 0x52682945, 0xEAD6D190,
+    0x5A8939A5, 0x469A9AEF, 0x52683165, 0x90969783, 0x4A473145, 0x75646060,
+    0x524841C5, 0xE4E8A9A9,
+};
+
+#endif /* RT_TEX_CRATE01_BC_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -71,6 +71,8 @@ rt_time     f_time      =-1;        /* frame-delta-(ms) (from command-line) */
 rt_si32     n_simd      = 0;        /* SIMD native size (from command-line) */
 rt_si32     k_size      = 0;        /* SIMD size-factor (from command-line) */
 rt_si32     s_type      = 0;        /* SIMD sub-variant (from command-line) */
+rt_bool     n_tune      = RT_FALSE;    /* SIMD autotune (from command-line) */
+rt_si32     t_simd      = 0;        /* SIMD tuning mask (from command-line) */
 rt_si32     t_pool      = 0;        /* Thread-pool size (from command-line) */
 #if RT_FULLSCREEN == 1
 rt_si32     w_size      = 0;        /* Window-rect size (from command-line) */
@@ -94,6 +96,10 @@ rt_bool     q_test      = RT_FALSE;       /* quake mode (from actual scene) */
 rt_si32     u_mode      = 0; /* update/render threadoff (from command-line) */
 rt_bool     o_mode      = RT_FALSE;        /* offscreen (from command-line) */
 rt_si32     a_mode      = RT_FSAA_NO;      /* FSAA mode (from command-line) */
+rt_si32     j_mode      = RT_SCHED_TILES;  /* scheduler (from command-line) */
+rt_si32     v_mode      = RT_PARTS_CHUNKS; /* partition (from command-line) */
+rt_si32     b_mode      = RT_BUFF_AUTO;    /* buffering (from command-line) */
+rt_bool     z_mode      = RT_FALSE;          /* costmap (from command-line) */
 
 /******************************************************************************/
 /********************************   PLATFORM   ********************************/
@@ -106,6 +112,11 @@ rt_si32     a_mode      = RT_FSAA_NO;      /* FSAA mode (from command-line) */
  */
 rt_time get_time();
 
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick();
+
 /*
  * Allocate memory from system heap.
  */
@@ -116,28 +127,6 @@ rt_pntr sys_alloc(rt_size size);
  */
 rt_void sys_free(rt_pntr ptr, rt_size size);
 
-/*
- * Initialize platform-specific pool of "thnum" threads (< 0 - no feedback).
- */
-rt_pntr init_threads(rt_si32 thnum, rt_Platform *pfm);
-
-/*
- * Terminate platform-specific pool of "thnum" threads.
- */
-rt_void term_threads(rt_pntr tdata, rt_si32 thnum);
-
-/*
- * Task platform-specific pool of "thnum" threads to update scene,
- * block until finished.
- */
-rt_void update_scene(rt_pntr tdata, rt_si32 thnum, rt_si32 phase);
-
-/*
- * Task platform-specific pool of "thnum" threads to render scene,
- * block until finished.
- */
-rt_void render_scene(rt_pntr tdata, rt_si32 thnum, rt_si32 phase);
-
 /*
  * Set current frame to screen.
  */
@@ -203,10 +192,6 @@ rt_void frame_to_screen(rt_ui32 *frame, rt_si32 x_row);
 
 #define KEY_MASK            0xFF
 
-/* thread's exception variables */
-rt_si32  eout = 0, emax = 0;
-rt_pstr *estr = RT_NULL;
-
 /* state tracking variables */
 rt_si32 d_prev = -1;        /* prev demo-scene */
 rt_si32 c_prev = -1;        /* prev camera-idx */
@@ -265,6 +250,26 @@ rt_void print_avgfps()
     RT_LOGI("AVG = %.2f\n", avg);
 }
 
+/*
+ * Set the fastest SIMD target for current scene and mode (within the set
+ * requested from command-line), update state-tracking SIMD variables.
+ */
+rt_void tune_target(rt_time time)
+{
+    rt_si32 size, type, simd;
+
+    simd = pfm->tune_simd(sc[d], time, t_simd);
+    size = (simd >> 16) & 0xFF;
+    type = (simd >> 8) & 0xFF;
+    simd = simd & 0xFF;
+
+    k_size = size;
+    s_type = type;
+    n_simd = simd;
+
+    a_mode = pfm->get_fsaa();
+}
+
 /*
  * Print current target config.
  */
@@ -286,8 +291,8 @@ rt_void print_target()
     RT_LOGI("Framebuffer X-res = %5d, Y-res = %4d, l %d, h %d  %s %s\n",
                                           x_res, y_res, l_mode, h_mode,
                                 p_mode ? "p" : " ", q_test ? "q" : " ");
-    RT_LOGI("Window-rect X-res = %5d, Y-res = %4d, u %d, o %d\n",
-                                          x_win, y_win, u_mode, o_mode);
+    RT_LOGI("Window-rect X-res = %5d, Y-res = %4d, u %d, o %d, b %d\n",
+                                  x_win, y_win, u_mode, o_mode, b_mode);
     RT_LOGI("Threads/affinity = %4d/%d, reserved = %d, d%2d, c%2d\n",
                          pfm->get_thnum(), RT_SETAFFINITY, 0, d+1, c+1);
 
@@ -314,6 +319,16 @@ rt_si32 main_step()
     {
         if (T_KEYS(RK_F4) || T_KEYS(RK_4))
         {
+            if (z_mode)
+            {
+                sc[d]->save_costs(scr_id);
+            }
+            /* checkpoint path-tracer's samples to resume later */
+            if (q_test)
+            {
+                sc[d]->save_accum(scr_id);
+                sc[d]->save_conv(scr_id);
+            }
             sc[d]->save_frame(scr_id++);
             switched = 1;
         }
@@ -485,6 +500,16 @@ rt_si32 main_step()
             o_mode = !o_mode;
             switched = 1;
         }
+        if (T_KEYS(RK_X))
+        {
+            rt_si32 i;
+            b_mode = (b_mode + 1) % (RT_BUFF_AUTO + 1); /* off, on, auto */
+            for (i = 0; i < RT_ARR_SIZE(sc_rt); i++)
+            {
+                sc[i]->set_buff(b_mode);
+            }
+            switched = 1;
+        }
         if (T_KEYS(RK_F12) || T_KEYS(RK_5))
         {
             h_mode = !h_mode;
@@ -591,6 +616,7 @@ rt_si32 main_step()
             }
             while (size != k_size);
             a_mode = pfm->get_fsaa();
+            n_tune = RT_FALSE; /* manual choice stays */
             switched = k_prev != k_size ? 1 : switched;
         }
         if (T_KEYS(RK_F7) || T_KEYS(RK_7))
@@ -611,6 +637,7 @@ rt_si32 main_step()
             }
             while (type != s_type);
             a_mode = pfm->get_fsaa();
+            n_tune = RT_FALSE; /* manual choice stays */
             switched = s_prev != s_type ? 1 : switched;
         }
         if (T_KEYS(RK_F8) || T_KEYS(RK_8))
@@ -646,6 +673,7 @@ rt_si32 main_step()
             }
             while (simd != n_simd);
             a_mode = pfm->get_fsaa();
+            n_tune = RT_FALSE; /* manual choice stays */
             switched = n_prev != n_simd ? 1 : switched;
         }
         if (T_KEYS(RK_F11) || T_KEYS(RK_1))
@@ -680,6 +708,10 @@ rt_si32 main_step()
 
         if (switched && img_id >= 0 && img_id <= 999)
         {
+            if (z_mode)
+            {
+                sc[g]->save_costs(img_id);
+            }
             sc[g]->save_frame(img_id++);
         }
 
@@ -700,6 +732,12 @@ rt_si32 main_step()
                 RT_LOGI("%s\n", str);
             }
 
+            /* re-pick (or take from cache) for new scene/mode */
+            if (n_tune)
+            {
+                tune_target(f_time >= 0 ? b_time + f_time * ttl : anim_time);
+            }
+
             print_target();
 
             d_prev = d;
@@ -723,6 +761,10 @@ rt_si32 main_step()
         cnt++;
         ttl++;
 
+        /* render into platform's current presentation buffer,
+         * kept as is if not usable by the engine directly */
+        sc[d]->set_frame(frame, x_row);
+
         sc[d]->render(f_time >= 0 ? b_time + f_time * ttl : anim_time);
 
         if (!h_mode)
@@ -741,21 +783,6 @@ rt_si32 main_step()
         return 0;
     }
 
-    if (eout != 0)
-    {
-        rt_si32 i;
-
-        for (i = 0; i < emax; i++)
-        {
-            if (estr[i] != RT_NULL)
-            {            
-                RT_LOGE("Exception: thread %d: %s\n", i, estr[i]);
-            }
-        }
-
-        return 0;
-    }
-
     if (!o_mode)
     {
         frame_to_screen(sc[d]->get_frame(), sc[d]->get_x_row());
@@ -783,6 +810,7 @@ rt_si32 args_init(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -f n, specify # of consecutive frames to render, n >= 0\n");
         RT_LOGI(" -g n, specify delta (ms) for consecutive frames, n >= 0\n");
         RT_LOGI(" -n n, override SIMD native size, where new simd is 1.16\n");
+        RT_LOGI(" -n 0, autotune SIMD target, fastest one, not the widest\n");
         RT_LOGI(" -k n, override SIMD size-factor, where new size is 1..4\n");
         RT_LOGI(" -s n, override SIMD sub-variant, where new type is 1.32\n");
         RT_LOGI(" -t n, override thread-pool size, where new size <= 1000\n");
@@ -801,7 +829,11 @@ rt_si32 args_init(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -o, offscreen-frame mode, turns off window-rect updates\n");
         RT_LOGI(" -a, enable 4x antialiasing by default, 8x not supported\n");
         RT_LOGI(" -a n, enable antialiasing, 2 for 2x, 4 for 4x, 8 for 8x\n");
-        RT_LOGI("options -d n  ... ... ... ... ...  -a n can all be mixed\n");
+        RT_LOGI(" -j n, render scheduling, 0 for row-interleave, 1 tiles\n");
+        RT_LOGI(" -v n, update partitions, 0 modulo, 1 chunks, 2 by cost\n");
+        RT_LOGI(" -B n, ray buffering, 0 direct, 1 per surface, 2 auto\n");
+        RT_LOGI(" -z, costmap mode, save per-tile costs along with images\n");
+        RT_LOGI("options -d n  ... ... ... ... ...  -j n can all be mixed\n");
         RT_LOGI("--------------------------------------------------------\n");
     }
 
@@ -939,6 +971,12 @@ rt_si32 args_init(rt_si32 argc, rt_char *argv[])
                 n_simd = t >= 128 ? t / 128 : t;
             }
             else
+            if (t == 0)
+            {
+                RT_LOGI("SIMD target autotune: %d\n", 1);
+                n_tune = RT_TRUE;
+            }
+            else
             {
                 RT_LOGI("SIMD native size value out of range\n");
                 return 0;
@@ -1178,6 +1216,53 @@ rt_si32 args_init(rt_si32 argc, rt_char *argv[])
             }
             RT_LOGI("Antialiasing request: %d\n", 1 << a_mode);
         }
+        if (k < argc && strcmp(argv[k], "-j") == 0 && ++k < argc)
+        {
+            t = argv[k][0] - '0';
+            if (strlen(argv[k]) == 1 && t >= 0 && t <= 1)
+            {
+                RT_LOGI("Render-scheduling mode: %d\n", t);
+                j_mode = t;
+            }
+            else
+            {
+                RT_LOGI("Render-scheduling value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-v") == 0 && ++k < argc)
+        {
+            t = argv[k][0] - '0';
+            if (strlen(argv[k]) == 1 && t >= 0 && t <= 2)
+            {
+                RT_LOGI("Update-partitioning mode: %d\n", t);
+                v_mode = t;
+            }
+            else
+            {
+                RT_LOGI("Update-partitioning value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-B") == 0 && ++k < argc)
+        {
+            t = argv[k][0] - '0';
+            if (strlen(argv[k]) == 1 && t >= 0 && t <= 2)
+            {
+                RT_LOGI("Ray-buffering mode: %d\n", t);
+                b_mode = t;
+            }
+            else
+            {
+                RT_LOGI("Ray-buffering value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-z") == 0 && !z_mode)
+        {
+            z_mode = RT_TRUE;
+            RT_LOGI("Costmap mode: %d\n", z_mode);
+        }
     }
 
     x_res = x_res * (w_size != 0 ? w_size : 1);
@@ -1200,9 +1285,8 @@ rt_si32 main_init()
     try
     {
         i = -1;
-        pfm = new rt_Platform(sys_alloc, sys_free, thnum,
-                              init_threads, term_threads,
-                              update_scene, render_scene);
+        /* system thread pool rethrows worker-threads' exceptions */
+        pfm = new rt_Platform(sys_alloc, sys_free, thnum);
     }
     catch (rt_Exception e)
     {
@@ -1217,6 +1301,9 @@ rt_si32 main_init()
         RT_LOGI("Requested antialiasing mode not supported, check options\n");
         return 0;
     }
+    pfm->set_sched(j_mode);
+    pfm->set_parts(v_mode);
+    pfm->set_timer(get_tick);
     tile_w = pfm->get_tile_w();
 
     try
@@ -1225,6 +1312,8 @@ rt_si32 main_init()
         {
             sc[i] = new(pfm) rt_Scene(sc_rt[i],
                                       x_res, y_res, x_row, frame, pfm);
+            sc[i]->set_costs(z_mode);
+            sc[i]->set_buff(b_mode);
         }
 
         pfm->set_cur_scene(sc[d]);
@@ -1249,6 +1338,9 @@ rt_si32 main_init()
         return 0;
     }
 
+    /* keep requested SIMD parameters as the set of targets for autotune */
+    t_simd = simd_init(n_simd, s_type, k_size);
+
     /* update state-tracking SIMD variables from currently chosen SIMD target */
     k_size = size;
     s_type = type;
@@ -1298,6 +1390,11 @@ rt_si32 main_init()
         RT_LOGI("%s\n", str);
     }
 
+    if (n_tune)
+    {
+        tune_target(b_time);
+    }
+
     d_prev = d;
     c_prev = c;
     n_prev = n_simd;
@@ -1318,6 +1415,10 @@ rt_si32 main_term()
 {
     if (img_id >= 0 && img_id <= 999)
     {
+        if (z_mode)
+        {
+            sc[d]->save_costs(img_id);
+        }
         sc[d]->save_frame(img_id++);
     }
 
@@ -11,6 +11,7 @@
 /******************************************************************************/
 
 #include <sys/time.h>
+#include <time.h>
 
 #include <X11/Xlib.h>
 #include <X11/Xatom.h>
@@ -25,95 +26,33 @@ rt_si32     depth;
 #define RT_XSHM 1
 #endif /* RT_XSHM */
 
+/* number of XShm images for direct rendering in true-color,
+ * X server reads one while the engine renders into the next */
+#ifndef RT_XSHM_NUM
+#define RT_XSHM_NUM 2
+#endif /* RT_XSHM_NUM */
+
 #if RT_XSHM
 #include <sys/shm.h>
 #include <X11/extensions/XShm.h>
 
-XShmSegmentInfo shminfo;
+XShmSegmentInfo shminfo[RT_XSHM_NUM];
+rt_si32     x_pend[RT_XSHM_NUM] = {0}; /* XShm completion is pending */
+rt_si32     x_comp      = 0; /* XShm completion event type */
 #endif /* RT_XSHM */
 
 rt_bool     xshm        = RT_FALSE;
-XImage     *ximage      = NULL;
+XImage     *ximage[RT_XSHM_NUM] = {NULL};
+rt_si32     x_num       = 1; /* number of images in use */
+rt_si32     x_cur       = 0; /* current image (rendered to) */
 GC          gc;
 XGCValues   gc_values   = {0};
 
-#include <pthread.h>
-
-pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
-
 #ifdef __APPLE__
 
 #undef  RT_XSHM /* XShm compiles on macOS with XQuartz, but fails at runtime */
 #define RT_XSHM 0
 
-#undef  RT_SETAFFINITY /* setting thread affinity is not present on macOS */
-#define RT_SETAFFINITY 0
-
-/*
- * Custom implementation of pthread barriers for macOS found at:
- * http://blog.albertarmea.com/post/47089939939/using-pthreadbarrier-on-mac-os-x
- * copied as is with minor format adjustments.
- */
-#include <errno.h>
-
-typedef int pthread_barrierattr_t;
-typedef struct
-{
-    pthread_mutex_t mutex;
-    pthread_cond_t cond;
-    int count;
-    int tripCount;
-} pthread_barrier_t;
-
-int pthread_barrier_init(pthread_barrier_t *barrier,
-                         const pthread_barrierattr_t *attr, unsigned int count)
-{
-    if(count == 0)
-    {
-        errno = EINVAL;
-        return -1;
-    }
-    if(pthread_mutex_init(&barrier->mutex, 0) < 0)
-    {
-        return -1;
-    }
-    if(pthread_cond_init(&barrier->cond, 0) < 0)
-    {
-        pthread_mutex_destroy(&barrier->mutex);
-        return -1;
-    }
-    barrier->tripCount = count;
-    barrier->count = 0;
-
-    return 0;
-}
-
-int pthread_barrier_destroy(pthread_barrier_t *barrier)
-{
-    pthread_cond_destroy(&barrier->cond);
-    pthread_mutex_destroy(&barrier->mutex);
-    return 0;
-}
-
-int pthread_barrier_wait(pthread_barrier_t *barrier)
-{
-    pthread_mutex_lock(&barrier->mutex);
-    ++(barrier->count);
-    if(barrier->count >= barrier->tripCount)
-    {
-        barrier->count = 0;
-        pthread_cond_broadcast(&barrier->cond);
-        pthread_mutex_unlock(&barrier->mutex);
-        return 1;
-    }
-    else
-    {
-        pthread_cond_wait(&barrier->cond, &(barrier->mutex));
-        pthread_mutex_unlock(&barrier->mutex);
-        return 0;
-    }
-}
-
 #endif /* __APPLE__ */
 
 /******************************************************************************/
@@ -124,6 +63,12 @@ rt_si32 main_init();
 rt_si32 main_loop();
 rt_si32 main_term();
 
+#if RT_XSHM
+XImage *xshm_image(rt_si32 scr_id, rt_si32 i);
+#endif /* RT_XSHM */
+
+rt_void sys_stat();
+
 /*
  * Program's main entry point.
  */
@@ -296,54 +241,29 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     XMapWindow(disp, win);
     XSync(disp, False);
 
+    rt_si32 i;
+
 #if RT_XSHM
-    do
-    {
-        /* create image,
-         * use preconfigured x_res, y_res for rendering,
-         * window resizing in runtime is not supported for now */
-        ximage = XShmCreateImage(disp,
-                                 DefaultVisual(disp, scr_id),
-                                 depth,
-                                 ZPixmap, NULL, &shminfo,
-                                 x_row, y_res);
-        if (ximage == NULL)
-        {
-            RT_LOGE("Couldn't create XShm image\n");
-            RT_LOGE("defaulting to (slower) non-XShm fallback\n");
-            break;
-        }
+    /* event type for async presentation */
+    x_comp = XShmGetEventBase(disp) + ShmCompletion;
 
-        /* get shared memory */
-        shminfo.shmid = shmget(IPC_PRIVATE,
-                               ximage->bytes_per_line * ximage->height,
-                               IPC_CREAT|0777);
-        if (shminfo.shmid < 0)
-        {
-            RT_LOGE("shmget failed with size = %d bytes\n",
-                                 ximage->bytes_per_line * ximage->height);
-            RT_LOGE("defaulting to (slower) non-XShm fallback\n");
-            XDestroyImage(ximage);
-            break;
-        }
+    /* multiple images only for direct rendering,
+     * 16-bit target is converted (and waited for) in place */
+    x_num = depth > 16 ? RT_XSHM_NUM : 1;
 
-        /* attach shared memory */
-        shminfo.shmaddr = ximage->data = (rt_char *)shmat(shminfo.shmid, 0, 0);
-        if (shminfo.shmaddr == (rt_char *)-1)
+    for (i = 0; i < x_num; i++)
+    {
+        ximage[i] = xshm_image(scr_id, i);
+
+        if (ximage[i] == NULL)
         {
-            RT_LOGE("shmat failed\n");
-            RT_LOGE("defaulting to (slower) non-XShm fallback\n");
-            XDestroyImage(ximage);
-            break;
+            RT_LOGE("defaulting to %s\n", i == 0 ?
+                    "(slower) non-XShm fallback" : "fewer XShm images");
+            x_num = i;
         }
-
-        shminfo.readOnly = False;
-        XShmAttach(disp, &shminfo);
-        shmctl(shminfo.shmid, IPC_RMID, 0);
-
-        xshm = RT_TRUE;
     }
-    while (0);
+
+    xshm = x_num > 0 ? RT_TRUE : RT_FALSE;
 #endif /* RT_XSHM */
 
     if (xshm == RT_FALSE)
@@ -355,12 +275,13 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         /* create image,
          * use preconfigured x_res, y_res for rendering,
          * window resizing in runtime is not supported for now */
-        ximage = XCreateImage(disp,
-                              DefaultVisual(disp, scr_id),
-                              depth,
-                              ZPixmap, 0, (rt_char *)f_ptr,
-                              x_res, y_res, pixel, x_row * pixel / 8);
-        if (ximage == NULL)
+        x_num = 1;
+        ximage[0] = XCreateImage(disp,
+                                 DefaultVisual(disp, scr_id),
+                                 depth,
+                                 ZPixmap, 0, (rt_char *)f_ptr,
+                                 x_res, y_res, pixel, x_row * pixel / 8);
+        if (ximage[0] == NULL)
         {
             RT_LOGE("Couldn't create X image\n");
             XDestroyWindow(disp, win);
@@ -372,16 +293,14 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     gc = XCreateGC(disp, win, 0, &gc_values);
     XSync(disp, False);
 
-    /* use true-color target directly */
+    /* use true-color target directly,
+     * frame_to_screen flips "frame" between images */
     if (depth > 16)
     {
-        frame = (rt_ui32 *)ximage->data;
-        x_row = ximage->bytes_per_line / 4;
+        frame = (rt_ui32 *)ximage[0]->data;
+        x_row = ximage[0]->bytes_per_line / 4;
     }
 
-    /* init sys_alloc's mutex */
-    pthread_mutex_init(&mutex, NULL);
-
     /* run main loop */
     ret = main_init();
     if (ret == 0)
@@ -391,8 +310,8 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     ret = main_loop();
     ret = main_term();
 
-    /* destroy sys_alloc's mutex */
-    pthread_mutex_destroy(&mutex);
+    /* print sys_alloc's contention stats */
+    sys_stat();
 
     if (w_size == 0)
     {
@@ -403,18 +322,24 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 #if RT_XSHM
     if (xshm == RT_TRUE)
     {
-        /* destroy image,
+        /* let X server finish with images */
+        XSync(disp, False);
+
+        /* destroy images,
          * detach shared memory */
-        XShmDetach(disp, &shminfo);
-        XDestroyImage(ximage);
-        shmdt(shminfo.shmaddr);
+        for (i = 0; i < x_num; i++)
+        {
+            XShmDetach(disp, &shminfo[i]);
+            XDestroyImage(ximage[i]);
+            shmdt(shminfo[i].shmaddr);
+        }
     }
 #endif /* RT_XSHM */
 
     if (xshm == RT_FALSE)
     {
         /* destroy image */
-        XDestroyImage(ximage);
+        XDestroyImage(ximage[0]);
     }
 
     XFreeGC(disp, gc);
@@ -438,6 +363,16 @@ rt_time get_time()
     return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
 }
 
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick()
+{
+    timespec tm;
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+    return (rt_time)tm.tv_sec * 1000000000 + (rt_time)tm.tv_nsec;
+}
+
 
 #if RT_POINTER == 64
 #if RT_ADDRESS == 32
@@ -466,6 +401,55 @@ rt_byte *s_ptr = RT_ADDRESS_MIN;
 #define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
 #endif /* macOS still cannot allocate with mmap within 32-bit range */
 
+#define RT_ALLOC_RANGE      0x00400000 /* per-thread address-range (4MB) */
+
+/* per-thread address-range reservation */
+static __thread
+rt_byte *t_ptr = RT_NULL;
+static __thread
+rt_byte *t_end = RT_NULL;
+
+/* sys_alloc's contention statistics */
+static
+rt_si32 s_cnt_alloc = 0; /* number of allocations */
+static
+rt_si32 s_cnt_range = 0; /* number of address-range reservations */
+static
+rt_si32 s_cnt_retry = 0; /* number of retries on shared s_ptr */
+static
+rt_si32 s_cnt_moved = 0; /* number of mmaps placed off the reservation */
+
+/*
+ * Reserve address-range of given "size" from shared s_ptr
+ * without locking, retry if other thread got there first.
+ */
+static
+rt_byte *sys_range(rt_size size)
+{
+    rt_byte *ptr, *old;
+
+    for (;;)
+    {
+        old = s_ptr;
+
+        /* loop around RT_ADDRESS_MAX boundary */
+        /* in 64/32-bit hybrid mode addresses can't have sign bit
+         * as MIPS64 sign-extends all 32-bit mem-loads by default */
+        ptr = old >= RT_ADDRESS_MAX - size ? RT_ADDRESS_MIN : old;
+
+        if (RT_ATOMIC_CAS(&s_ptr, old, ptr + size) == old)
+        {
+            break;
+        }
+
+        RT_ATOMIC_ADD(&s_cnt_retry, 1);
+    }
+
+    RT_ATOMIC_ADD(&s_cnt_range, 1);
+
+    return ptr;
+}
+
 #endif /* (RT_POINTER - RT_ADDRESS) */
 
 /*
@@ -473,25 +457,41 @@ rt_byte *s_ptr = RT_ADDRESS_MIN;
  */
 rt_pntr sys_alloc(rt_size size)
 {
-    pthread_mutex_lock(&mutex);
-
 #if (RT_POINTER - RT_ADDRESS) != 0
 
-    /* loop around RT_ADDRESS_MAX boundary */
-    /* in 64/32-bit hybrid mode addresses can't have sign bit
-     * as MIPS64 sign-extends all 32-bit mem-loads by default */
-    if (s_ptr >= RT_ADDRESS_MAX - size)
+    /* advance with allocation granularity */
+    /* in case when page-size differs from default 4096 bytes
+     * mmap should round toward closest correct page boundary */
+    rt_size step = ((size + 4095) / 4096) * 4096;
+    rt_byte *adr;
+
+    /* large allocations take their own address-range,
+     * smaller ones are placed within thread's reservation */
+    if (step > RT_ALLOC_RANGE / 4)
+    {
+        adr = sys_range(step);
+    }
+    else
     {
-        s_ptr  = RT_ADDRESS_MIN;
+        if (t_ptr == RT_NULL || t_end - t_ptr < step)
+        {
+            t_ptr = sys_range(RT_ALLOC_RANGE);
+            t_end = t_ptr + RT_ALLOC_RANGE;
+        }
+
+        adr = t_ptr;
+        t_ptr += step;
     }
 
-    rt_pntr ptr = mmap(s_ptr, size, PROT_READ | PROT_WRITE,
+    rt_pntr ptr = mmap(adr, size, PROT_READ | PROT_WRITE,
                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 
-    /* advance with allocation granularity */
-    /* in case when page-size differs from default 4096 bytes
-     * mmap should round toward closest correct page boundary */
-    s_ptr = (rt_byte *)ptr + ((size + 4095) / 4096) * 4096;
+    RT_ATOMIC_ADD(&s_cnt_alloc, 1);
+
+    if (ptr != adr)
+    {
+        RT_ATOMIC_ADD(&s_cnt_moved, 1);
+    }
 
 #else /* (RT_POINTER - RT_ADDRESS) */
 
@@ -505,8 +505,6 @@ rt_pntr sys_alloc(rt_size size)
 
 #endif /* RT_DEBUG */
 
-    pthread_mutex_unlock(&mutex);
-
 #if (RT_POINTER - RT_ADDRESS) != 0
 
     if ((rt_byte *)ptr >= RT_ADDRESS_MAX - size)
@@ -529,8 +527,6 @@ rt_pntr sys_alloc(rt_size size)
  */
 rt_void sys_free(rt_pntr ptr, rt_size size)
 {
-    pthread_mutex_lock(&mutex);
-
 #if (RT_POINTER - RT_ADDRESS) != 0
 
     munmap(ptr, size);
@@ -546,269 +542,179 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
     RT_LOGI("FREED PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
 
 #endif /* RT_DEBUG */
+}
 
-    pthread_mutex_unlock(&mutex);
+/*
+ * Print sys_alloc's contention statistics.
+ */
+rt_void sys_stat()
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    RT_LOGI("sys_alloc: %d allocs, %d ranges, %d retries, %d moved\n",
+            s_cnt_alloc, s_cnt_range, s_cnt_retry, s_cnt_moved);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
 }
 
 /******************************************************************************/
-/*****************************   MULTI-THREADING   ****************************/
+/*******************************   EVENT-LOOP   *******************************/
 /******************************************************************************/
 
-struct rt_THREAD;
-
-/* platform-specific pool
- * of "thnum" threads */
-struct rt_THREAD_POOL
-{
-    rt_Platform        *pfm;
-    rt_si32             cmd;
-    rt_si32             thnum;
-    rt_THREAD          *thread;
-    pthread_barrier_t   barr[2];
-};
-
-/* platform-specific thread */
-struct rt_THREAD
-{
-    rt_THREAD_POOL     *tpool;
-    rt_si32             index;
-    pthread_t           pthr;
-};
+#if RT_XSHM
 
 /*
- * Worker thread's entry point.
+ * Create XShm image with given index, return NULL on failure.
  */
-rt_pntr worker_thread(rt_pntr p)
+XImage *xshm_image(rt_si32 scr_id, rt_si32 i)
 {
-    rt_THREAD *thread = (rt_THREAD *)p;
-    rt_si32 ti = thread->index;
-
-    while (thread->tpool->cmd < 0) /* <- wait for barriers */
-    {
-        sched_yield();
-    }
+    XShmSegmentInfo *info = &shminfo[i];
+    XImage *image = NULL;
 
-    while (1)
+    do
     {
-        /* every worker-thread waits signal from main thread */
-        pthread_barrier_wait(&thread->tpool->barr[0]);
-
-        rt_Platform *pfm = thread->tpool->pfm;
-
-        if (pfm == RT_NULL)
+        /* create image,
+         * use preconfigured x_res, y_res for rendering,
+         * window resizing in runtime is not supported for now */
+        image = XShmCreateImage(disp,
+                                DefaultVisual(disp, scr_id),
+                                depth,
+                                ZPixmap, NULL, info,
+                                x_row, y_res);
+        if (image == NULL)
         {
+            RT_LOGE("Couldn't create XShm image\n");
             break;
         }
 
-        rt_si32 cmd = thread->tpool->cmd;
-
-        /* if one thread throws an exception,
-         * other threads are still allowed to proceed
-         * in the same run, but not in the next one */
-        if (eout == 0)
-        try
+        /* get shared memory */
+        info->shmid = shmget(IPC_PRIVATE,
+                             image->bytes_per_line * image->height,
+                             IPC_CREAT|0777);
+        if (info->shmid < 0)
         {
-            rt_Scene *scene = pfm->get_cur_scene();
+            RT_LOGE("shmget failed with size = %d bytes\n",
+                                 image->bytes_per_line * image->height);
+            XDestroyImage(image);
+            break;
+        }
 
-            switch (cmd & 0x3)
-            {
-                case 1:
-                scene->update_slice(ti, (cmd >> 2) & 0xFF);
-                break;
+#if (RT_POINTER - RT_ADDRESS) != 0
 
-                case 2:
-                scene->render_slice(ti, (cmd >> 2) & 0xFF);
-                break;
+        /* attach shared memory within 32-bit address range (if possible)
+         * for the engine to render into it without reallocating frame */
+        rt_size step = ((image->bytes_per_line * image->height
+                                         + 4095) / 4096) * 4096;
 
-                default:
-                break;
-            };
-        }
-        catch (rt_Exception e)
+        info->shmaddr = (rt_char *)shmat(info->shmid, sys_range(step), 0);
+        if (info->shmaddr == (rt_char *)-1)
         {
-            estr[ti] = e.err;
-            eout = 1;
+            info->shmaddr = (rt_char *)shmat(info->shmid, 0, 0);
         }
 
-        /* every worker-thread signals to main thread when done */
-        pthread_barrier_wait(&thread->tpool->barr[1]);
-    }
-
-    /* every worker-thread signals to main thread when done */
-    pthread_barrier_wait(&thread->tpool->barr[1]);
-
-    return RT_NULL;
-}
-
-/*
- * Initialize platform-specific pool of "thnum" threads (< 0 - no feedback).
- */
-rt_pntr init_threads(rt_si32 thnum, rt_Platform *pfm)
-{
-    rt_bool feedback = thnum < 0 ? RT_FALSE : RT_TRUE;
-    thnum = thnum < 0 ? -thnum : thnum;
-
-    eout = 0; emax = thnum;
-    estr = (rt_pstr *)malloc(sizeof(rt_pstr) * thnum);
-
-    if (estr == RT_NULL)
-    {
-        throw rt_Exception("out of memory for estr in init_threads");
-    }
-
-    memset(estr, 0, sizeof(rt_pstr) * thnum);
-
-#if RT_SETAFFINITY
-
-    cpu_set_t cpuset_pr, cpuset_th;
-    pthread_t pthr = pthread_self();
-    pthread_getaffinity_np(pthr, sizeof(cpu_set_t), &cpuset_pr);
-
-#endif /* RT_SETAFFINITY */
-
-    rt_THREAD_POOL *tpool = (rt_THREAD_POOL *)malloc(sizeof(rt_THREAD_POOL));
-
-    if (tpool == RT_NULL)
-    {
-        throw rt_Exception("out of memory for tpool in init_threads");
-    }
-
-    tpool->pfm = pfm;
-    tpool->cmd = -1;
-    tpool->thnum = thnum;
-    tpool->thread = (rt_THREAD *)malloc(sizeof(rt_THREAD) * thnum);
-
-    if (tpool->thread == RT_NULL)
-    {
-        throw rt_Exception("out of memory for thread data in init_threads");
-    }
+#else /* (RT_POINTER - RT_ADDRESS) */
 
-    rt_si32 i, a;
+        /* attach shared memory */
+        info->shmaddr = (rt_char *)shmat(info->shmid, 0, 0);
 
-    for (i = 0, a = 0; i < thnum; i++, a++)
-    {
-#if RT_SETAFFINITY
+#endif /* (RT_POINTER - RT_ADDRESS) */
 
-        while (!CPU_ISSET(a, &cpuset_pr))
-        {
-            a++;
-            if (a == CPU_SETSIZE)
-            {
-                if (feedback)
-                {
-                    thnum = i;
-                    break;
-                }
-                else
-                {
-                    a = 0;
-                }
-            }
-        }
-        if (thnum == i)
+        if (info->shmaddr == (rt_char *)-1)
         {
+            RT_LOGE("shmat failed\n");
+            XDestroyImage(image);
             break;
         }
 
-#endif /* RT_SETAFFINITY */
-
-        rt_THREAD *thread = tpool->thread;
-
-        thread[i].tpool = tpool;
-        thread[i].index = i;
-        pthread_create(&thread[i].pthr, NULL, worker_thread, &thread[i]);
+        image->data = info->shmaddr;
 
-#if RT_SETAFFINITY
+        info->readOnly = False;
+        XShmAttach(disp, info);
+        shmctl(info->shmid, IPC_RMID, 0);
 
-        CPU_ZERO(&cpuset_th);
-        CPU_SET(a, &cpuset_th);
-        pthread_setaffinity_np(thread[i].pthr, sizeof(cpu_set_t), &cpuset_th);
-
-#endif /* RT_SETAFFINITY */
-    }
-
-    pthread_barrier_init(&tpool->barr[0], NULL, thnum + 1);
-    pthread_barrier_init(&tpool->barr[1], NULL, thnum + 1);
-
-    if (feedback)
-    {
-        pfm->set_thnum(thnum);
+        return image;
     }
-    tpool->thnum = thnum;
-    tpool->cmd = 0;
+    while (0);
 
-    return tpool;
+    return NULL;
 }
 
 /*
- * Terminate platform-specific pool of "thnum" threads.
+ * Match XShm completion event for segment "arg".
  */
-rt_void term_threads(rt_pntr tdata, rt_si32 thnum)
+static
+Bool xshm_done(Display *disp, XEvent *event, XPointer arg)
 {
-    rt_si32 i;
-    rt_THREAD_POOL *tpool = (rt_THREAD_POOL *)tdata;
-
-    /* signal all worker-threads to terminate */
-    tpool->cmd = 0;
-    tpool->pfm = RT_NULL;
-    pthread_barrier_wait(&tpool->barr[0]);
-    /* wait for all worker-threads to finish */
-    pthread_barrier_wait(&tpool->barr[1]);
-
-    for (i = 0; i < tpool->thnum; i++)
-    {
-        rt_THREAD *thread = tpool->thread;
-
-        pthread_join(thread[i].pthr, NULL);
-    }
-
-    pthread_barrier_destroy(&tpool->barr[0]);
-    pthread_barrier_destroy(&tpool->barr[1]);
-
-    free(tpool->thread);
-    free(tpool);
-
-    free(estr);
-    estr = RT_NULL;
-    eout = emax = 0;
+    return event->type == x_comp
+        && ((XShmCompletionEvent *)event)->shmseg ==
+           ((XShmSegmentInfo *)arg)->shmseg;
 }
 
 /*
- * Task platform-specific pool of "thnum" threads to update scene,
- * block until finished.
+ * Wait until X server is done reading XShm image with given index,
+ * other events are left in the queue for the event loop.
  */
-rt_void update_scene(rt_pntr tdata, rt_si32 thnum, rt_si32 phase)
+static
+rt_void xshm_wait(rt_si32 i)
 {
-    rt_THREAD_POOL *tpool = (rt_THREAD_POOL *)tdata;
+    XEvent event;
 
-    /* signal all worker-threads to update scene */
-    tpool->cmd = 1 | ((phase & 0xFF) << 2);
-    pthread_barrier_wait(&tpool->barr[0]);
-    /* wait for all worker-threads to finish */
-    pthread_barrier_wait(&tpool->barr[1]);
+    if (x_pend[i] != 0)
+    {
+        XIfEvent(disp, &event, xshm_done, (XPointer)&shminfo[i]);
+        x_pend[i] = 0;
+    }
 }
 
+#endif /* RT_XSHM */
+
 /*
- * Task platform-specific pool of "thnum" threads to render scene,
- * block until finished.
+ * Convert row of 32-bit pixels to 16-bit (RGB565),
+ * 4 pixels at a time within 64-bit words (SWAR).
  */
-rt_void render_scene(rt_pntr tdata, rt_si32 thnum, rt_si32 phase)
+static
+rt_void convert_row(rt_ui16 *idata, rt_ui32 *frame, rt_si32 x_res)
 {
-    rt_THREAD_POOL *tpool = (rt_THREAD_POOL *)tdata;
+    rt_ui64 p0, p1;
+    rt_si32 j;
 
-    /* signal all worker-threads to render scene */
-    tpool->cmd = 2 | ((phase & 0xFF) << 2);
-    pthread_barrier_wait(&tpool->barr[0]);
-    /* wait for all worker-threads to finish */
-    pthread_barrier_wait(&tpool->barr[1]);
-}
+    for (j = 0; j + 4 <= x_res; j += 4)
+    {
+        memcpy(&p0, frame + j + 0, sizeof(rt_ui64));
+        memcpy(&p1, frame + j + 2, sizeof(rt_ui64));
 
-/******************************************************************************/
-/*******************************   EVENT-LOOP   *******************************/
-/******************************************************************************/
+        p0 = (p0 & ULL(0x00F8000000F80000)) >> 8 |
+             (p0 & ULL(0x0000FC000000FC00)) >> 5 |
+             (p0 & ULL(0x000000F8000000F8)) >> 3;
+        p1 = (p1 & ULL(0x00F8000000F80000)) >> 8 |
+             (p1 & ULL(0x0000FC000000FC00)) >> 5 |
+             (p1 & ULL(0x000000F8000000F8)) >> 3;
+
+        /* pack 16-bit results from both 32-bit halves */
+        p0 = (p0 & 0x0000FFFF) | (p0 >> 16 & 0xFFFF0000);
+        p1 = (p1 & 0x0000FFFF) | (p1 >> 16 & 0xFFFF0000);
+
+#if RT_ENDIAN == 0
+        p0 = p0 | p1 << 32;
+#else /* RT_ENDIAN == 1 */
+        p0 = p0 << 32 | p1;
+#endif /* RT_ENDIAN */
+
+        memcpy(idata + j, &p0, sizeof(rt_ui64));
+    }
+
+    for (; j < x_res; j++)
+    {
+        idata[j] = (frame[j] & 0x00F80000) >> 8 |
+                   (frame[j] & 0x0000FC00) >> 5 |
+                   (frame[j] & 0x000000F8) >> 3;
+    }
+}
 
 /*
  * Set current frame to screen.
+ * Presentation is asynchronous with XShm, image's memory
+ * is written again only after X server is done reading it.
  */
 rt_void frame_to_screen(rt_ui32 *frame, rt_si32 x_row)
 {
@@ -817,32 +723,37 @@ rt_void frame_to_screen(rt_ui32 *frame, rt_si32 x_row)
         return;
     }
 
+    XImage *image = ximage[x_cur];
+
     if (depth == 16)
     {
-        rt_si32 i, j;
+        rt_si32 i;
+
+#if RT_XSHM
+        xshm_wait(x_cur);
+#endif /* RT_XSHM */
 
         for (i = 0; i < y_res; i++)
         {
-            rt_ui16 *idata = (rt_ui16 *)ximage->data +
-                             i * (ximage->bytes_per_line / 2);
+            rt_ui16 *idata = (rt_ui16 *)image->data +
+                             i * (image->bytes_per_line / 2);
 
-            for (j = 0; j < x_res; j++)
-            {
-                idata[j] = (frame[i * x_row + j] & 0x00F80000) >> 8 |
-                           (frame[i * x_row + j] & 0x0000FC00) >> 5 |
-                           (frame[i * x_row + j] & 0x000000F8) >> 3;
-            }
+            convert_row(idata, frame + i * x_row, x_res);
         }
     }
     else
-    if (frame != ::frame)
+    if (frame != (rt_ui32 *)image->data)
     {
         rt_si32 i;
 
+#if RT_XSHM
+        xshm_wait(x_cur);
+#endif /* RT_XSHM */
+
         for (i = 0; i < y_res; i++)
         {
-            rt_ui32 *idata = (rt_ui32 *)ximage->data +
-                             i * (ximage->bytes_per_line / 4);
+            rt_ui32 *idata = (rt_ui32 *)image->data +
+                             i * (image->bytes_per_line / 4);
 
             memcpy(idata, frame + i * x_row, x_res * sizeof(rt_ui32));
         }
@@ -851,18 +762,38 @@ rt_void frame_to_screen(rt_ui32 *frame, rt_si32 x_row)
 #if RT_XSHM
     if (xshm == RT_TRUE)
     {
-        /* put XShm image to the screen */
-        XShmPutImage(disp, win, gc, ximage, 0, 0, 0, 0, x_res, y_res, False);
+        /* put XShm image to the screen,
+         * request completion event */
+        XShmPutImage(disp, win, gc, image, 0, 0, 0, 0, x_res, y_res, True);
+        x_pend[x_cur] = 1;
     }
 #endif /* RT_XSHM */
 
     if (xshm == RT_FALSE)
     {
-        /* put X image to the screen */
-        XPutImage(disp, win, gc, ximage, 0, 0, 0, 0, x_res, y_res);
+        /* put X image to the screen,
+         * its data is sent before return */
+        XPutImage(disp, win, gc, image, 0, 0, 0, 0, x_res, y_res);
     }
 
-    XSync(disp, False);
+    /* don't wait for X server's round-trip */
+    XFlush(disp);
+
+#if RT_XSHM
+    if (xshm == RT_TRUE && depth > 16)
+    {
+        /* flip to the next image, if rendered into directly
+         * wait for X server to release it (from earlier frames) */
+        x_cur = (x_cur + 1) % x_num;
+
+        if (frame == (rt_ui32 *)image->data)
+        {
+            xshm_wait(x_cur);
+        }
+
+        ::frame = (rt_ui32 *)ximage[x_cur]->data;
+    }
+#endif /* RT_XSHM */
 }
 
 /*
@@ -880,6 +811,22 @@ rt_si32 main_loop()
             XEvent event;
             XNextEvent(disp, &event);
 
+#if RT_XSHM
+            if (event.type == x_comp && xshm == RT_TRUE)
+            {
+                rt_si32 i;
+
+                /* XShm image is released by X server */
+                for (i = 0; i < x_num; i++)
+                {
+                    if (xshm_done(disp, &event, (XPointer)&shminfo[i]))
+                    {
+                        x_pend[i] = 0;
+                    }
+                }
+            }
+#endif /* RT_XSHM */
+
             if (event.type == KeyPress)
             {
                 key = XLookupKeysym((XKeyEvent *)&event, 0);
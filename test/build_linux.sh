@@ -13,6 +13,11 @@ make -f core_make_x64.mk build -j4
 make -f core_make_x64.mk strip
 
 
+make -f bench_make_x64.mk build -j4
+
+make -f bench_make_x64.mk strip
+
+
 # RooT demo compilation requires Xext development library in addition to g++
 
 cd ../root
@@ -0,0 +1,1188 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "engine.h"
+#include "rtimag.h"
+#include "all_scn.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * core_bench.cpp: Headless batch renderer and benchmark.
+ *
+ * Renders any compiled-in scene (demo or test) with a given configuration
+ * without opening a window, and reports per-phase timings of the engine
+ * (update phases 0.5-3, tiling, render) as min/median/p99 over N frames.
+ * Results can also be written to a JSON file for tracking regressions.
+ *
+ * Update and render phases run on a pool of worker threads,
+ * the same way as in the demo application (RooT).
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define RT_X_RES            800
+#define RT_Y_RES            480
+
+#define BENCH_FRAMES        64  /* default number of measured frames */
+#define BENCH_WARMUP        4   /* default number of warm-up frames */
+
+#define BENCH_GROUPS        4096 /* texel-fetch groups per pass */
+#define BENCH_PASSES        256  /* texel-fetch passes per layout */
+
+/******************************************************************************/
+/***************************   VARS, FUNCS, TYPES   ***************************/
+/******************************************************************************/
+
+#include "scn_test01.h"
+#include "scn_test02.h"
+#include "scn_test03.h"
+#include "scn_test04.h"
+#include "scn_test05.h"
+#include "scn_test06.h"
+#include "scn_test07.h"
+#include "scn_test08.h"
+#include "scn_test09.h"
+#include "scn_test10.h"
+#include "scn_test11.h"
+#include "scn_test12.h"
+#include "scn_test13.h"
+#include "scn_test14.h"
+#include "scn_test15.h"
+#include "scn_test16.h"
+#include "scn_test17.h"
+#include "scn_test18.h"
+#include "scn_test19.h"
+
+rt_SCENE   *sc_rt[]     =
+{
+    &scn_demo01::sc_root,
+    &scn_demo02::sc_root,
+    &scn_demo03::sc_root,
+    &scn_test01::sc_root,
+    &scn_test02::sc_root,
+    &scn_test03::sc_root,
+    &scn_test04::sc_root,
+    &scn_test05::sc_root,
+    &scn_test06::sc_root,
+    &scn_test07::sc_root,
+    &scn_test08::sc_root,
+    &scn_test09::sc_root,
+    &scn_test10::sc_root,
+    &scn_test11::sc_root,
+    &scn_test12::sc_root,
+    &scn_test13::sc_root,
+    &scn_test14::sc_root,
+    &scn_test15::sc_root,
+    &scn_test16::sc_root,
+    &scn_test17::sc_root,
+    &scn_test18::sc_root,
+    &scn_test19::sc_root,
+};
+
+rt_pstr     sc_nm[]     =
+{
+    "demo01", "demo02", "demo03",
+    "test01", "test02", "test03", "test04", "test05", "test06",
+    "test07", "test08", "test09", "test10", "test11", "test12",
+    "test13", "test14", "test15", "test16", "test17", "test18",
+    "test19",
+};
+
+rt_pstr     ph_nm[RT_PHASE_NUM + 1] =
+{
+    "update0.5", "update1", "update2", "bounds", "snode", "ssort",
+    "filter", "lsort", "csort", "update3", "tiling", "render", "frame",
+};
+
+rt_si32     x_res       = RT_X_RES;
+rt_si32     y_res       = RT_Y_RES;
+rt_si32     x_row       = (RT_X_RES+RT_SIMD_WIDTH-1) & ~(RT_SIMD_WIDTH-1);
+rt_si32     thnum       = RT_THREADS_NUM;
+
+rt_Platform*pfm         = RT_NULL;
+rt_Scene   *scene       = RT_NULL;
+
+rt_si32     d           = 0;        /* scene-index (from command-line) */
+rt_si32     f_num       = BENCH_FRAMES; /* measured (from command-line) */
+rt_si32     b_num       = BENCH_WARMUP; /* warming-up (from command-line) */
+rt_time     f_time      = 16;       /* frame-delta-(ms) (from command-line) */
+rt_si32     n_simd      = 0;        /* SIMD native size (from command-line) */
+rt_si32     k_size      = 0;        /* SIMD size-factor (from command-line) */
+rt_si32     s_type      = 0;        /* SIMD sub-variant (from command-line) */
+rt_si32     m_num       = 1;        /* path-tracer spp (from command-line) */
+rt_si32     c_num       = 0;    /* convergence (1/1000) (from command-line) */
+rt_si32     a_mode      = RT_FSAA_NO;   /* antialiasing (from command-line) */
+rt_si32     j_mode      = RT_SCHED_TILES; /* scheduling (from command-line) */
+rt_si32     v_mode      = RT_PARTS_CHUNKS; /* partitions (from command-line) */
+rt_si32     B_mode      = RT_BUFF_AUTO;    /* buffering (from command-line) */
+rt_bool     q_mode      = RT_FALSE;     /* quality mode (from command-line) */
+rt_bool     q_test      = RT_FALSE;     /* quality mode (from actual scene) */
+rt_bool     u_mode      = RT_FALSE; /* unoptimized mode (from command-line) */
+rt_bool     l_mode      = RT_FALSE;     /* log-off mode (from command-line) */
+rt_si32     i_mode      = 0;            /* imaging mode (from command-line) */
+rt_si32     o_mode      = 0;      /* accum-saving mode (from command-line) */
+rt_si32     w_mode      = 0;    /* accum-resuming mode (from command-line) */
+rt_si32     z_mode      = 0;     /* accum-merging mode (from command-line) */
+rt_si32     h_num       = 1;        /* path-tracer seed (from command-line) */
+rt_si32     T_mode      = 0;     /* tonemap resolve mode (from command-line) */
+rt_si32     E_num       = 100;   /* exposure in percents (from command-line) */
+rt_si32     L_num       = 0;  /* texel-fetch log2 size (from command-line) */
+rt_bool     p_mode      = RT_FALSE;    /* profiler mode (from command-line) */
+rt_bool     e_mode      = RT_FALSE;     /* overlap mode (from command-line) */
+rt_bool     R_mode      = RT_FALSE;     /* reusing mode (from command-line) */
+rt_bool     C_mode      = RT_FALSE;      /* camera mode (from command-line) */
+rt_pstr     r_name      = RT_NULL;  /* JSON results file (from command-line) */
+
+/* per-frame timings (ns) for each phase,
+ * the whole frame goes last */
+rt_time    *ph_t[RT_PHASE_NUM + 1] = {0};
+
+/* texel-fetch rates (Mtexels/s)
+ * for row-major and tiled layouts */
+rt_real     tx_r[2]     = {0.0f, 0.0f};
+
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick();
+
+/*
+ * Allocate memory from system heap.
+ */
+rt_pntr sys_alloc(rt_size size);
+
+/*
+ * Free memory from system heap.
+ */
+rt_void sys_free(rt_pntr ptr, rt_size size);
+
+/*
+ * Parse non-negative decimal number, return -1 if malformed.
+ */
+rt_si32 parse_num(rt_pstr str)
+{
+    rt_si32 l, r, t;
+
+    for (l = strlen(str), r = 1, t = 0; l > 0; l--, r *= 10)
+    {
+        if (str[l-1] < '0' || str[l-1] > '9')
+        {
+            return -1;
+        }
+        t += (str[l-1] - '0') * r;
+    }
+
+    return strlen(str) > 0 ? t : -1;
+}
+
+/*
+ * Compare timings for sorting.
+ */
+int time_cmp(const void *p1, const void *p2)
+{
+    rt_time t1 = *(rt_time *)p1;
+    rt_time t2 = *(rt_time *)p2;
+
+    return t1 < t2 ? -1 : t1 > t2 ? +1 : 0;
+}
+
+/*
+ * Sort timings of a given phase and get min/median/p99 (in microseconds).
+ */
+rt_void time_stat(rt_time *t, rt_si32 n, rt_real *ret)
+{
+    qsort(t, n, sizeof(rt_time), time_cmp);
+
+    ret[0] = (rt_real)t[0] / 1000.0f;
+    ret[1] = (rt_real)(n % 2 ? t[n/2] : (t[n/2-1] + t[n/2]) / 2) / 1000.0f;
+    ret[2] = (rt_real)t[RT_MAX(0, (n * 99 + 99) / 100 - 1)] / 1000.0f;
+}
+
+/*
+ * Run all frames, warming-up ones are not recorded.
+ */
+rt_void bench_run()
+{
+    rt_si32 i, j;
+    rt_time t_beg;
+
+    for (i = -b_num; i < f_num; i++)
+    {
+        t_beg = get_tick();
+
+        /* camera-only motion, static lists are kept in reusing mode */
+        if (C_mode)
+        {
+            scene->update(q_test ? 0 : (i + b_num) * f_time,
+                          RT_CAMERA_ROTATE_LEFT);
+        }
+
+        /* path-tracer accumulates samples over a static scene,
+         * otherwise animation advances with each frame */
+        scene->render(q_test ? 0 : (i + b_num) * f_time);
+
+        if (i < 0)
+        {
+            continue;
+        }
+
+        ph_t[RT_PHASE_NUM][i] = get_tick() - t_beg;
+
+        for (j = 0; j < RT_PHASE_NUM; j++)
+        {
+            ph_t[j][i] = scene->get_phase(j);
+        }
+    }
+}
+
+/*
+ * Run texel-fetch micro-benchmark for row-major and 4x4-tiled layouts.
+ * Each fetch-group of 16 lanes samples a 4x4 pixel block projected onto
+ * the texture with random position, rotation and scale (1/4 to 8 texels
+ * per pixel), the same way SIMD gathers in the tracer's texture mapping.
+ */
+rt_void bench_tex()
+{
+    rt_si32 n = 1 << L_num, m = n - 1;
+    rt_si32 i, j, k, l, x, y;
+    rt_ui32 acc = 0, seed = 1;
+
+    rt_TEX tex;
+    tex.x_dim = n;
+    tex.y_dim = n;
+    tex.ptex  = pfm->alloc(n * n * 4, RT_ALIGN);
+
+    rt_ui32 *buf[2];
+    buf[0] = (rt_ui32 *)tex.ptex;
+    buf[1] = (rt_ui32 *)pfm->alloc(n * n * 4, RT_ALIGN);
+
+    for (i = 0; i < n * n; i++)
+    {
+        buf[0][i] = (rt_ui32)i * 2654435761u;
+    }
+
+    swizzle_image(&tex, buf[1]);
+
+    /* base position (u, v) and lane steps (du, dv)
+     * in 16.16 fixed-point texel coords */
+    rt_si32 *grp = (rt_si32 *)
+                   pfm->alloc(BENCH_GROUPS * 4 * sizeof(rt_si32), RT_ALIGN);
+
+    for (k = 0; k < BENCH_GROUPS; k++)
+    {
+        rt_real r[4];
+
+        for (j = 0; j < 4; j++)
+        {
+            seed = seed * 214013 + 2531011;
+            r[j] = (rt_real)(seed >> 8) / (rt_real)(1 << 24);
+        }
+
+        rt_real scl = RT_POW(2.0f, r[2] * 5.0f - 2.0f) * 65536.0f;
+
+        grp[k*4+0] = (rt_si32)(r[0] * n * 65536.0f);
+        grp[k*4+1] = (rt_si32)(r[1] * n * 65536.0f);
+        grp[k*4+2] = (rt_si32)(RT_COSA(r[3] * 360.0f) * scl);
+        grp[k*4+3] = (rt_si32)(RT_SINA(r[3] * 360.0f) * scl);
+    }
+
+    for (l = 0; l < 2; l++)
+    {
+        rt_ui32 *p = buf[l];
+        rt_time t_beg = get_tick();
+
+        for (i = 0; i < BENCH_PASSES; i++)
+        {
+            /* shift all groups each pass to avoid
+             * measuring cache-resident texels only */
+            rt_ui32 s = (rt_ui32)i * 0x9E3779B9u;
+
+            for (k = 0; k < BENCH_GROUPS; k++)
+            {
+                rt_ui32 *g = (rt_ui32 *)grp + k * 4;
+
+                for (j = 0; j < 16; j++)
+                {
+                    rt_ui32 u = g[0] + s + (j & 3) * g[2] - (j >> 2) * g[3];
+                    rt_ui32 v = g[1] - s + (j & 3) * g[3] + (j >> 2) * g[2];
+
+                    x = (u >> 16) & m;
+                    y = (v >> 16) & m;
+
+                    acc += p[l ? RT_TEX_TILED(x, y, L_num) : (y << L_num) + x];
+                }
+            }
+        }
+
+        rt_time t_end = get_tick() - t_beg;
+
+        tx_r[l] = (rt_real)BENCH_PASSES * BENCH_GROUPS * 16 * 1000.0f /
+                  (rt_real)RT_MAX(t_end, 1);
+    }
+
+    if (!l_mode)
+    {
+        RT_LOGI("------------------  TEXEL FETCH  -----------------------\n");
+        RT_LOGI("Texture = %dx%d, fetches = %d per layout (%08X)\n",
+                n, n, BENCH_PASSES * BENCH_GROUPS * 16, acc);
+        RT_LOGI("row-major %9.1f Mtexels/s %9.1f MB/s\n",
+                tx_r[0], tx_r[0] * 4.0f);
+        RT_LOGI("tiled 4x4 %9.1f Mtexels/s %9.1f MB/s\n",
+                tx_r[1], tx_r[1] * 4.0f);
+    }
+}
+
+/*
+ * Print results and write them to JSON file (if requested).
+ */
+rt_void bench_out()
+{
+    rt_si32 j, simd = n_simd * 128;
+    rt_real st[RT_PHASE_NUM + 1][3];
+
+    for (j = 0; j <= RT_PHASE_NUM; j++)
+    {
+        time_stat(ph_t[j], f_num, st[j]);
+    }
+
+    if (!l_mode)
+    {
+        RT_LOGI("------------------  BENCH RESULTS  ---------------------\n");
+        RT_LOGI("phase (us)         min        median           p99\n");
+
+        for (j = 0; j <= RT_PHASE_NUM; j++)
+        {
+            RT_LOGI("%-10s %13.1f %13.1f %13.1f\n",
+                    ph_nm[j], st[j][0], st[j][1], st[j][2]);
+        }
+
+        RT_LOGI("--------------------------------------------------------\n");
+    }
+
+    if (r_name == RT_NULL)
+    {
+        return;
+    }
+
+    FILE *file = fopen(r_name, "w");
+
+    if (file == RT_NULL)
+    {
+        throw rt_Exception("couldn't open results file for writing");
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"scene\": \"%s\",\n", sc_nm[d]);
+    fprintf(file, "  \"x_res\": %d,\n", x_res);
+    fprintf(file, "  \"y_res\": %d,\n", y_res);
+    fprintf(file, "  \"simd\": \"%dx%dv%d\",\n", simd, k_size, s_type);
+    fprintf(file, "  \"ptr_fp\": \"%d%s%d\",\n",
+                    RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
+    fprintf(file, "  \"threads\": %d,\n", pfm->get_thnum());
+    fprintf(file, "  \"fsaa\": %d,\n", 1 << a_mode);
+    fprintf(file, "  \"pt_spp\": %d,\n", q_test ? m_num : 0);
+    fprintf(file, "  \"pt_conv\": %d,\n", q_test ? c_num : 0);
+    fprintf(file, "  \"pt_left\": %d,\n", scene->get_conv_num());
+    fprintf(file, "  \"pt_seed\": %d,\n", h_num);
+    fprintf(file, "  \"pt_tone\": %d,\n", q_test ? T_mode : 0);
+    fprintf(file, "  \"pt_expo\": %d,\n", q_test ? E_num : 100);
+    fprintf(file, "  \"sched\": %d,\n", j_mode);
+    fprintf(file, "  \"parts\": %d,\n", v_mode);
+    fprintf(file, "  \"buff\": %d,\n", B_mode);
+    fprintf(file, "  \"opts\": \"%s\",\n",
+                    u_mode ? "none" : R_mode ? "full+reuse" : "full");
+    fprintf(file, "  \"camera\": %d,\n", C_mode);
+    fprintf(file, "  \"pipe\": %d,\n", e_mode);
+    fprintf(file, "  \"frames\": %d,\n", f_num);
+    fprintf(file, "  \"warmup\": %d,\n", b_num);
+
+    if (L_num != 0)
+    {
+        fprintf(file, "  \"texfetch\": { \"size\": %d, \"linear\": %.1f, "
+                      "\"tiled\": %.1f },\n", 1 << L_num, tx_r[0], tx_r[1]);
+    }
+
+    fprintf(file, "  \"units\": \"us\",\n");
+    fprintf(file, "  \"phases\": {\n");
+
+    for (j = 0; j <= RT_PHASE_NUM; j++)
+    {
+        fprintf(file, "    \"%s\": { \"min\": %.1f, \"median\": %.1f, "
+                      "\"p99\": %.1f }%s\n", ph_nm[j],
+                      st[j][0], st[j][1], st[j][2],
+                      j < RT_PHASE_NUM ? "," : "");
+    }
+
+    fprintf(file, "  }\n");
+    fprintf(file, "}\n");
+
+    fclose(file);
+
+    if (!l_mode) RT_LOGI("Results saved to: %s\n", r_name);
+}
+
+/******************************************************************************/
+/**********************************   MAIN   **********************************/
+/******************************************************************************/
+
+rt_si32 main(rt_si32 argc, rt_char *argv[])
+{
+    rt_si32 k, t, n = RT_ARR_SIZE(sc_rt);
+
+    for (k = 1; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-l") == 0)
+        {
+            l_mode = RT_TRUE;
+        }
+    }
+
+    if (argc >= 2 && !l_mode)
+    {
+        RT_LOGI("--------------------------------------------------------\n");
+        RT_LOGI("Usage options are given below:\n");
+        RT_LOGI(" -d name, specify scene by name: demo01..03, test01..19\n");
+        RT_LOGI(" -d n, specify scene by index, where 1 <= n <= scn_num\n");
+        RT_LOGI(" -f n, specify # of measured frames to render, n >= 1\n");
+        RT_LOGI(" -b n, specify # of warm-up frames before measured ones\n");
+        RT_LOGI(" -g n, specify delta (ms) for consecutive frames, n >= 0\n");
+        RT_LOGI(" -m n, specify # of path-tracer samples per frame, n >= 1\n");
+        RT_LOGI(" -c n, adaptive path-tracer, error threshold n/1000 >= 1\n");
+        RT_LOGI(" -h n, specify path-tracer seed for split renders, n >= 1\n");
+        RT_LOGI(" -o n, save path-tracer accumulation at the end, n is idx\n");
+        RT_LOGI(" -w n, resume with path-tracer accumulation saved by -o n\n");
+        RT_LOGI(" -z n, merge with path-tracer accumulations saved by -o n\n");
+        RT_LOGI(" -T n, path-tracer tonemap: 1 clamp, 2 reinhard, 3 filmic\n");
+        RT_LOGI(" -E n, path-tracer exposure in percents with -T n, n >= 1\n");
+        RT_LOGI(" -L n, texel-fetch micro-benchmark, 2^n-wide tex, 4 to 13\n");
+        RT_LOGI(" -n n, override SIMD native size, where new simd is 1.16\n");
+        RT_LOGI(" -k n, override SIMD size-factor, where new size is 1..4\n");
+        RT_LOGI(" -s n, override SIMD sub-variant, where new type is 1.32\n");
+        RT_LOGI(" -t n, override thread-pool size, where new size <= 1000\n");
+        RT_LOGI(" -x n, override x-resolution, where new x-value <= 65535\n");
+        RT_LOGI(" -y n, override y-resolution, where new y-value <= 65535\n");
+        RT_LOGI(" -j n, render scheduling, 0 for row-interleave, 1 tiles\n");
+        RT_LOGI(" -v n, update partitions, 0 modulo, 1 chunks, 2 by cost\n");
+        RT_LOGI(" -B n, ray buffering, 0 direct, 1 per surface, 2 auto\n");
+        RT_LOGI(" -r file, write results (min/median/p99) to JSON file\n");
+        RT_LOGI(" -i n, save image at the end of the run, n is image-idx\n");
+        RT_LOGI(" -l, enable log-off mode, no printing to file and screen\n");
+        RT_LOGI(" -u, enable unoptimized mode, render with RT_OPTS_NONE\n");
+        RT_LOGI(" -q, enable quality mode, activate path-tracing lighting\n");
+        RT_LOGI(" -p, enable profiler mode, save per-thread times (prf*)\n");
+        RT_LOGI(" -e, enable overlap mode, pipeline update with rendering\n");
+        RT_LOGI(" -R, enable reusing mode, add RT_OPTS_REUSE to options\n");
+        RT_LOGI(" -C, enable camera mode, rotate camera before each frame\n");
+        RT_LOGI(" -a, enable 4x antialiasing by default, 8x not supported\n");
+        RT_LOGI(" -a n, enable antialiasing, 2 for 2x, 4 for 4x, 8 for 8x\n");
+        RT_LOGI("--------------------------------------------------------\n");
+    }
+
+    for (k = 1; k < argc; k++)
+    {
+        if (k < argc && strcmp(argv[k], "-d") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            for (d = 0; t < 0 && d < n; d++)
+            {
+                if (strcmp(argv[k], sc_nm[d]) == 0)
+                {
+                    t = d + 1;
+                }
+            }
+            if (t >= 1 && t <= n)
+            {
+                d = t-1;
+                if (!l_mode) RT_LOGI("Scene overridden: %s\n", sc_nm[d]);
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Scene name/index value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-f") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1)
+            {
+                if (!l_mode) RT_LOGI("Number-of-frames: %d\n", t);
+                f_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Number-of-frames value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-b") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 0)
+            {
+                if (!l_mode) RT_LOGI("Warm-up-frames: %d\n", t);
+                b_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Warm-up-frames value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-g") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 0)
+            {
+                if (!l_mode) RT_LOGI("Frame-delta (ms): %d\n", t);
+                f_time = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Frame-delta (ms) value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-m") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1)
+            {
+                if (!l_mode) RT_LOGI("Path-tracer samples: %d\n", t);
+                m_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Path-tracer samples value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-c") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1)
+            {
+                if (!l_mode) RT_LOGI("Convergence threshold: %d/1000\n", t);
+                c_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Convergence threshold value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-n") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t == 1   || t == 2   || t == 4   || t == 8    || t == 16
+            ||  t == 128 || t == 256 || t == 512 || t == 1024 || t == 2048)
+            {
+                if (!l_mode) RT_LOGI("SIMD native size overridden: %d\n", t);
+                n_simd = t >= 128 ? t / 128 : t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("SIMD native size value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-k") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 4)
+            {
+                if (!l_mode) RT_LOGI("SIMD size-factor overridden: %d\n", t);
+                k_size = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("SIMD size-factor value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-s") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t == 1 || t == 2 || t == 4 || t == 8
+            ||  t == 16 || t == 32)
+            {
+                if (!l_mode) RT_LOGI("SIMD sub-variant overridden: %d\n", t);
+                s_type = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("SIMD sub-variant value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-t") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 1000)
+            {
+                if (!l_mode) RT_LOGI("Thread-pool size overridden: %d\n", t);
+                thnum = -t; /* negative value - no feedback */
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Thread-pool size value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-x") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 65535)
+            {
+                if (!l_mode) RT_LOGI("X-resolution overridden: %d\n", t);
+                x_res = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("X-resolution value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-y") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 65535)
+            {
+                if (!l_mode) RT_LOGI("Y-resolution overridden: %d\n", t);
+                y_res = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Y-resolution value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-j") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t == RT_SCHED_ROWS || t == RT_SCHED_TILES)
+            {
+                if (!l_mode) RT_LOGI("Render scheduling overridden: %d\n", t);
+                j_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Render scheduling value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-v") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t == RT_PARTS_MODULO || t == RT_PARTS_CHUNKS
+            ||  t == RT_PARTS_COSTS)
+            {
+                if (!l_mode) RT_LOGI("Update partitions overridden: %d\n", t);
+                v_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Update partitions value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-B") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= RT_BUFF_OFF && t <= RT_BUFF_AUTO)
+            {
+                if (!l_mode) RT_LOGI("Ray buffering overridden: %d\n", t);
+                B_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Ray buffering value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-r") == 0 && ++k < argc)
+        {
+            if (!l_mode) RT_LOGI("Results file: %s\n", argv[k]);
+            r_name = argv[k];
+        }
+        if (k < argc && strcmp(argv[k], "-h") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1)
+            {
+                if (!l_mode) RT_LOGI("Path-tracer seed: %d\n", t);
+                h_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Path-tracer seed value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-T") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 0 && t <= 3)
+            {
+                if (!l_mode) RT_LOGI("Tonemap mode: %d\n", t);
+                T_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Tonemap mode value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-E") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1)
+            {
+                if (!l_mode) RT_LOGI("Exposure percents: %d\n", t);
+                E_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Exposure value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-L") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 4 && t <= 13)
+            {
+                if (!l_mode) RT_LOGI("Texel-fetch size: %d\n", 1 << t);
+                L_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Texel-fetch size value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-o") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 999)
+            {
+                if (!l_mode) RT_LOGI("Accum-save-index: %d\n", t);
+                o_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Accum-save-index value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-w") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 999)
+            {
+                if (!l_mode) RT_LOGI("Accum-resume-index: %d\n", t);
+                w_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Accum-resume-index value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-z") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 1 && t <= 999)
+            {
+                if (!l_mode) RT_LOGI("Accum-merge-index: %d\n", t);
+                z_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Accum-merge-index value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-i") == 0 && ++k < argc)
+        {
+            t = parse_num(argv[k]);
+            if (t >= 0 && t <= 999)
+            {
+                if (!l_mode) RT_LOGI("Image-index: %d\n", t);
+                i_mode = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Image-index value out of range\n");
+                return 1;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-u") == 0)
+        {
+            if (!l_mode) RT_LOGI("Unoptimized mode enabled\n");
+            u_mode = RT_TRUE;
+        }
+        if (k < argc && strcmp(argv[k], "-q") == 0)
+        {
+            if (!l_mode) RT_LOGI("Quality mode enabled\n");
+            q_mode = RT_TRUE;
+        }
+        if (k < argc && strcmp(argv[k], "-p") == 0)
+        {
+            if (!l_mode) RT_LOGI("Profiler mode enabled\n");
+            p_mode = RT_TRUE;
+        }
+        if (k < argc && strcmp(argv[k], "-e") == 0)
+        {
+            if (!l_mode) RT_LOGI("Overlap mode enabled\n");
+            e_mode = RT_TRUE;
+        }
+        if (k < argc && strcmp(argv[k], "-R") == 0)
+        {
+            if (!l_mode) RT_LOGI("Reusing mode enabled\n");
+            R_mode = RT_TRUE;
+        }
+        if (k < argc && strcmp(argv[k], "-C") == 0)
+        {
+            if (!l_mode) RT_LOGI("Camera mode enabled\n");
+            C_mode = RT_TRUE;
+        }
+        if (k < argc && strcmp(argv[k], "-a") == 0)
+        {
+            rt_si32 aa_map[10] =
+            {
+                RT_FSAA_NO, RT_FSAA_NO, RT_FSAA_2X, RT_FSAA_2X,
+                RT_FSAA_4X, RT_FSAA_4X, RT_FSAA_4X, RT_FSAA_4X,
+                RT_FSAA_8X, RT_FSAA_8X
+            };
+            a_mode = RT_FSAA_4X;
+            if (++k < argc)
+            {
+                t = argv[k][0] - '0';
+                if (strlen(argv[k]) == 1 && t >= 0 && t <= 9)
+                {
+                    a_mode = aa_map[t];
+                }
+                else
+                {
+                    k--;
+                }
+            }
+            if (!l_mode) RT_LOGI("Antialiasing request: %d\n", 1 << a_mode);
+        }
+    }
+
+    x_row = (x_res+RT_SIMD_WIDTH-1) & ~(RT_SIMD_WIDTH-1);
+
+    rt_si32 ret = 0, size, type, simd = 0;
+
+    try
+    {
+        /* system thread pool rethrows worker-threads' exceptions */
+        pfm = new rt_Platform(sys_alloc, sys_free, thnum);
+
+        simd = pfm->set_simd(simd_init(n_simd, s_type, k_size));
+        if (a_mode != pfm->set_fsaa(a_mode))
+        {
+            throw rt_Exception("requested antialiasing mode not supported");
+        }
+        pfm->set_sched(j_mode);
+        pfm->set_parts(v_mode);
+        pfm->set_timer(get_tick);
+
+        size = (simd >> 16) & 0xFF;
+        type = (simd >> 8) & 0xFF;
+        simd = simd & 0xFF;
+
+        /* test converted internal SIMD variables against new command-line format */
+        if ((k_size != 0 && k_size != size)
+        ||  (s_type != 0 && s_type != type)
+        ||  (n_simd != 0 && n_simd != simd && n_simd != simd * size))
+        {
+            throw rt_Exception("chosen SIMD target not supported");
+        }
+
+        /* update state-tracking SIMD variables from currently chosen SIMD target */
+        k_size = size;
+        s_type = type;
+        n_simd = simd;
+
+        for (k = 0; k <= RT_PHASE_NUM; k++)
+        {
+            ph_t[k] = (rt_time *)pfm->alloc(f_num * sizeof(rt_time), RT_ALIGN);
+        }
+
+        scene = new(pfm) rt_Scene(sc_rt[d], x_res, y_res, x_row, RT_NULL, pfm);
+        pfm->set_cur_scene(scene);
+
+        scene->set_opts(u_mode ? RT_OPTS_NONE :
+                        RT_OPTS_FULL | (R_mode ? RT_OPTS_REUSE : 0));
+        q_test = scene->set_pton(q_mode ? m_num : 0) > 0 ? q_mode : 0;
+
+        /* auto mode picks the faster of the two by render times */
+        scene->set_buff(B_mode);
+
+        /* converged tiles are skipped in adaptive mode */
+        scene->set_conv(q_test ? (rt_real)c_num / 1000.0f : 0.0f);
+
+        /* split renders need different seeds to be merged */
+        scene->set_seed(h_num);
+
+        /* color-planes are resolved by the engine if tonemap is set */
+        scene->set_tone(q_test ? T_mode : 0);
+        scene->set_expo((rt_real)E_num / 100.0f);
+
+        /* loaded samples are kept on the first update */
+        if (q_test && w_mode)
+        {
+            scene->load_accum(w_mode, 0);
+        }
+        if (q_test && z_mode)
+        {
+            scene->load_accum(z_mode, 1);
+        }
+
+        /* ring buffer keeps measured frames only */
+        scene->set_prof(p_mode ? f_num : 0);
+
+        /* frames are shown one render call late */
+        scene->set_pipe(e_mode);
+
+        if (!l_mode)
+        {
+            RT_LOGI("------------------  BENCH CONFIG  ----------------------\n");
+            RT_LOGI("Scene = %s, threads = %d, frames = %d (+%d warm-up)\n",
+                            sc_nm[d], pfm->get_thnum(), f_num, b_num);
+            RT_LOGI("SIMD size/type = %4dx%dv%d, FSAA = %d %s, PT = %d spp\n",
+                                   n_simd * 128, k_size, s_type, 1 << a_mode,
+                                   a_mode ? "(spp)" : "(off)", q_test ? m_num : 0);
+            RT_LOGI("Framebuffer X-res = %5d, Y-res = %4d, ptr/fp = %d%s%d\n",
+                    x_res, y_res, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f",
+                    RT_ELEMENT);
+        }
+
+        if (L_num != 0)
+        {
+            bench_tex();
+        }
+
+        bench_run();
+
+        if (!l_mode && scene->get_conv() > 0.0f)
+        {
+            RT_LOGI("Adaptive PT: %d tiles left to converge\n",
+                    scene->get_conv_num());
+        }
+
+        /* render the last frame pending in overlap mode */
+        scene->set_pipe(0);
+
+        if (i_mode)
+        {
+            scene->save_frame(i_mode);
+        }
+
+        if (p_mode)
+        {
+            scene->save_prof(i_mode);
+        }
+
+        if (q_test && o_mode)
+        {
+            scene->save_accum(o_mode);
+            scene->save_conv(o_mode);
+        }
+
+        bench_out();
+    }
+    catch (const rt_Exception &e)
+    {
+        if (!l_mode) RT_LOGE("Exception: %s\n", e.err);
+
+        ret = 1;
+    }
+
+    if (scene != RT_NULL)
+    {
+        delete scene;
+        scene = RT_NULL;
+    }
+
+    if (pfm != RT_NULL)
+    {
+        delete pfm;
+        pfm = RT_NULL;
+    }
+
+    return ret;
+}
+
+/******************************************************************************/
+/**********************************   UTILS   *********************************/
+/******************************************************************************/
+
+#include "rtzero.h"
+
+#if RT_POINTER == 64
+
+#if RT_ADDRESS == 32
+
+#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000040000000)
+#define RT_ADDRESS_MAX      ((rt_byte *)0x0000000080000000)
+
+#else /* RT_ADDRESS == 64 */
+
+#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000140000000)
+#define RT_ADDRESS_MAX      ((rt_byte *)0x0000080000000000)
+
+#endif /* RT_ADDRESS */
+
+rt_byte *s_ptr = RT_ADDRESS_MIN;
+
+#endif /* RT_POINTER */
+
+#include <time.h>
+
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick()
+{
+    timespec tm;
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+    return (rt_time)tm.tv_sec * 1000000000 + (rt_time)tm.tv_nsec;
+}
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+#include <sys/mman.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
+#endif /* macOS still cannot allocate with mmap within 32-bit range */
+
+#define RT_ALLOC_RANGE      0x00400000 /* per-thread address-range (4MB) */
+
+/* per-thread address-range reservation */
+static __thread
+rt_byte *t_ptr = RT_NULL;
+static __thread
+rt_byte *t_end = RT_NULL;
+
+/*
+ * Reserve address-range of given "size" from shared s_ptr
+ * without locking, retry if other thread got there first.
+ */
+static
+rt_byte *sys_range(rt_size size)
+{
+    rt_byte *ptr, *old;
+
+    for (;;)
+    {
+        old = s_ptr;
+
+        /* loop around RT_ADDRESS_MAX boundary */
+        /* in 64/32-bit hybrid mode addresses can't have sign bit
+         * as MIPS64 sign-extends all 32-bit mem-loads by default */
+        ptr = old >= RT_ADDRESS_MAX - size ? RT_ADDRESS_MIN : old;
+
+        if (RT_ATOMIC_CAS(&s_ptr, old, ptr + size) == old)
+        {
+            break;
+        }
+    }
+
+    return ptr;
+}
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+/*
+ * Allocate memory from system heap.
+ */
+rt_pntr sys_alloc(rt_size size)
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    /* advance with allocation granularity */
+    /* in case when page-size differs from default 4096 bytes
+     * mmap should round toward closest correct page boundary */
+    rt_size step = ((size + 4095) / 4096) * 4096;
+    rt_byte *adr;
+
+    /* large allocations take their own address-range,
+     * smaller ones are placed within thread's reservation */
+    if (step > RT_ALLOC_RANGE / 4)
+    {
+        adr = sys_range(step);
+    }
+    else
+    {
+        if (t_ptr == RT_NULL || t_end - t_ptr < step)
+        {
+            t_ptr = sys_range(RT_ALLOC_RANGE);
+            t_end = t_ptr + RT_ALLOC_RANGE;
+        }
+
+        adr = t_ptr;
+        t_ptr += step;
+    }
+
+    rt_pntr ptr = mmap(adr, size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+#else /* (RT_POINTER - RT_ADDRESS) */
+
+    rt_pntr ptr = malloc(size);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    if ((rt_byte *)ptr >= RT_ADDRESS_MAX - size)
+    {
+        throw rt_Exception("address exceeded allowed range in sys_alloc");
+    }
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+    if (ptr == RT_NULL)
+    {
+        throw rt_Exception("alloc failed with NULL address in sys_alloc");
+    }
+
+    return ptr;
+}
+
+/*
+ * Free memory from system heap.
+ */
+rt_void sys_free(rt_pntr ptr, rt_size size)
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    munmap(ptr, size);
+
+#else /* (RT_POINTER - RT_ADDRESS) */
+
+    free(ptr);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+}
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
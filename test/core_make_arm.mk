@@ -25,7 +25,8 @@ LIB_PATH =
 
 LIB_LIST =                                  \
         -lm                                 \
-        -lstdc++
+        -lstdc++                            \
+        -lpthread
 
 
 build: core_test_arm_v1 core_test_arm_v2
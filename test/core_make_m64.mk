@@ -25,7 +25,8 @@ LIB_PATH =
 
 LIB_LIST =                                  \
         -lm                                 \
-        -lstdc++
+        -lstdc++                            \
+        -lpthread
 
 
 build: build_le build_be
@@ -32,7 +32,8 @@ LIB_PATH =
 
 LIB_LIST =                                  \
         -lm                                 \
-        -lstdc++
+        -lstdc++                            \
+        -lpthread
 
 
 build: core_test_p32Bg4 core_test_p32Bp7 core_test_p32Bp8 core_test_p32Bp9
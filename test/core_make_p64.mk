@@ -31,7 +31,8 @@ LIB_PATH =
 
 LIB_LIST =                                  \
         -lm                                 \
-        -lstdc++
+        -lstdc++                            \
+        -lpthread
 
 
 build: build_p9 build_le build_be
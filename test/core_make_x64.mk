@@ -39,11 +39,14 @@ LIB_PATH =
 
 LIB_LIST =                                  \
         -lm                                 \
-        -lstdc++
+        -lstdc++                            \
+        -lpthread
 
 
-build: core_test_x64_32 core_test_x64_64 core_test_x64f32 core_test_x64f64
-clang: core_test.x64_32 core_test.x64_64 core_test.x64f32 core_test.x64f64
+build: core_test_x64_32 core_test_x64_64 core_test_x64f32 core_test_x64f64 \
+       core_test_x64f32g64 core_test_x64f32h16
+clang: core_test.x64_32 core_test.x64_64 core_test.x64f32 core_test.x64f64 \
+       core_test.x64f32g64 core_test.x64f32h16
 
 strip:
 	strip core_test.x64*
@@ -56,6 +59,8 @@ macOS:
 	mv core_test.x64_64 core_test.o64_64
 	mv core_test.x64f32 core_test.o64f32
 	mv core_test.x64f64 core_test.o64f64
+	mv core_test.x64f32g64 core_test.o64f32g64
+	mv core_test.x64f32h16 core_test.o64f32h16
 
 macRD:
 	rm -fr core_test.x64*.dSYM/
@@ -91,6 +96,26 @@ core_test_x64f32:
         -DRT_EMBED_STDOUT=0 -DRT_EMBED_FILEIO=0 -DRT_EMBED_TEX=1 \
         ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o core_test.x64f32
 
+core_test_x64f32g64:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=2+4+8 -DRT_256_R8=4 -DRT_256=1+2+8 \
+        -DRT_512_R8=1+2 -DRT_512=1+2 -DRT_1K4=1+2 -DRT_SIMD_COMPAT_SSE=2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_GEOMETRY=64 \
+        -DRT_DEBUG=0 -DRT_PATH="../" \
+        -DRT_EMBED_STDOUT=0 -DRT_EMBED_FILEIO=0 -DRT_EMBED_TEX=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o core_test.x64f32g64
+
+core_test_x64f32h16:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=2+4+8 -DRT_256_R8=4 -DRT_256=1+2+8 \
+        -DRT_512_R8=1+2 -DRT_512=1+2 -DRT_1K4=1+2 -DRT_SIMD_COMPAT_SSE=2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_PLANE_HALF=1 \
+        -DRT_DEBUG=0 -DRT_PATH="../" \
+        -DRT_EMBED_STDOUT=0 -DRT_EMBED_FILEIO=0 -DRT_EMBED_TEX=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o core_test.x64f32h16
+
 core_test_x64f64:
 	g++ -O3 -g \
         -DRT_LINUX -DRT_X64 -DRT_128=2+4+8 -DRT_256_R8=4 -DRT_256=1+2+8 \
@@ -128,6 +153,26 @@ core_test.x64f32:
         -DRT_EMBED_STDOUT=0 -DRT_EMBED_FILEIO=0 -DRT_EMBED_TEX=1 \
         ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o core_test.x64f32
 
+core_test.x64f32g64:
+	clang++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=2+4+8 -DRT_256_R8=4 -DRT_256=1+2+8 \
+        -DRT_512_R8=1+2 -DRT_512=1+2 -DRT_1K4=1+2 -DRT_SIMD_COMPAT_SSE=2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_GEOMETRY=64 \
+        -DRT_DEBUG=0 -DRT_PATH="../" \
+        -DRT_EMBED_STDOUT=0 -DRT_EMBED_FILEIO=0 -DRT_EMBED_TEX=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o core_test.x64f32g64
+
+core_test.x64f32h16:
+	clang++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=2+4+8 -DRT_256_R8=4 -DRT_256=1+2+8 \
+        -DRT_512_R8=1+2 -DRT_512=1+2 -DRT_1K4=1+2 -DRT_SIMD_COMPAT_SSE=2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        -DRT_PLANE_HALF=1 \
+        -DRT_DEBUG=0 -DRT_PATH="../" \
+        -DRT_EMBED_STDOUT=0 -DRT_EMBED_FILEIO=0 -DRT_EMBED_TEX=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o core_test.x64f32h16
+
 core_test.x64f64:
 	clang++ -O3 -g \
         -DRT_LINUX -DRT_X64 -DRT_128=2+4+8 -DRT_256_R8=4 -DRT_256=1+2+8 \
@@ -174,3 +219,7 @@ core_test.x64f64:
 # use (replace): RT_ADDRESS=32, rename the binary to core_test.x64_**
 # 64-bit packed SIMD mode (fp64/int64) is supported on 64-bit targets,
 # use (replace): RT_ELEMENT=64, rename the binary to core_test.x64*64
+# mixed-precision mode (fp64 geometry, fp32 SIMD) rebases world to camera,
+# use (add): RT_GEOMETRY=64 to fp32 builds, see core_test.x64f32g64 above
+# fp16 color-planes for path-tracer halve accumulation memory traffic,
+# use (add): RT_PLANE_HALF=1 to fp32 builds, see core_test.x64f32h16 above
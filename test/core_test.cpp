@@ -14,7 +14,7 @@
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define SUB_TEST            18
+#define SUB_TEST            19
 #define CYC_SIZE            3
 
 #define RT_X_RES            800
@@ -62,12 +62,21 @@ rt_bool     o_mode      = RT_FALSE;     /* optimal mode (from command-line) */
 rt_bool     q_mode      = RT_FALSE;     /* quality mode (from command-line) */
 rt_bool     q_test      = RT_FALSE;     /* quality mode (from actual scene) */
 rt_si32     a_mode      = RT_FSAA_NO;   /* antialiasing (from command-line) */
+rt_bool     m_mode      = RT_FALSE;     /* costmap mode (from command-line) */
+rt_bool     u_mode      = RT_FALSE;     /* overlap mode (from command-line) */
+rt_bool     j_mode      = RT_FALSE;     /* reusing mode (from command-line) */
+rt_si32     t_num       = 1;       /* number-of-threads (from command-line) */
 
 /*
  * Get system time in milliseconds.
  */
 rt_time get_time();
 
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick();
+
 /*
  * Allocate memory from system heap.
  */
@@ -78,6 +87,11 @@ rt_pntr sys_alloc(rt_size size);
  */
 rt_void sys_free(rt_pntr ptr, rt_size size);
 
+/*
+ * Print sys_alloc's contention statistics.
+ */
+rt_void sys_stat();
+
 /*
  * Copy frames.
  */
@@ -182,9 +196,23 @@ rt_void frame_max(rt_ui32 *fd)
 }
 
 /*
- * Common instance of platform container.
+ * Move camera before rendering given frame (in reusing mode).
+ * Every other frame is camera-only, the rest reuse all lists
+ * in static scenes.
  */
-rt_Platform pfm(sys_alloc, sys_free);
+rt_void frame_cam(rt_si32 j)
+{
+    if (j_mode && j % 2 != 0)
+    {
+        scene->update(q_test ? 0 : j * f_time, RT_CAMERA_ROTATE_LEFT);
+    }
+}
+
+/*
+ * Common instance of platform container,
+ * created after command-line is parsed.
+ */
+rt_Platform *pfm = RT_NULL;
 
 /******************************************************************************/
 /*******************************   SUB TEST  1   ******************************/
@@ -196,8 +224,8 @@ rt_Platform pfm(sys_alloc, sys_free);
 
 rt_void o_test01()
 {
-    scene = new(&pfm) rt_Scene(&scn_test01::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test01::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  1 */
@@ -212,8 +240,8 @@ rt_void o_test01()
 
 rt_void o_test02()
 {
-    scene = new(&pfm) rt_Scene(&scn_test02::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test02::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  2 */
@@ -228,8 +256,8 @@ rt_void o_test02()
 
 rt_void o_test03()
 {
-    scene = new(&pfm) rt_Scene(&scn_test03::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test03::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  3 */
@@ -244,8 +272,8 @@ rt_void o_test03()
 
 rt_void o_test04()
 {
-    scene = new(&pfm) rt_Scene(&scn_test04::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test04::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  4 */
@@ -260,8 +288,8 @@ rt_void o_test04()
 
 rt_void o_test05()
 {
-    scene = new(&pfm) rt_Scene(&scn_test05::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test05::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  5 */
@@ -276,8 +304,8 @@ rt_void o_test05()
 
 rt_void o_test06()
 {
-    scene = new(&pfm) rt_Scene(&scn_test06::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test06::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  6 */
@@ -292,8 +320,8 @@ rt_void o_test06()
 
 rt_void o_test07()
 {
-    scene = new(&pfm) rt_Scene(&scn_test07::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test07::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  7 */
@@ -308,8 +336,8 @@ rt_void o_test07()
 
 rt_void o_test08()
 {
-    scene = new(&pfm) rt_Scene(&scn_test08::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test08::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  8 */
@@ -324,8 +352,8 @@ rt_void o_test08()
 
 rt_void o_test09()
 {
-    scene = new(&pfm) rt_Scene(&scn_test09::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test09::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST  9 */
@@ -340,8 +368,8 @@ rt_void o_test09()
 
 rt_void o_test10()
 {
-    scene = new(&pfm) rt_Scene(&scn_test10::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test10::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 10 */
@@ -356,8 +384,8 @@ rt_void o_test10()
 
 rt_void o_test11()
 {
-    scene = new(&pfm) rt_Scene(&scn_test11::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test11::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 11 */
@@ -372,8 +400,8 @@ rt_void o_test11()
 
 rt_void o_test12()
 {
-    scene = new(&pfm) rt_Scene(&scn_test12::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test12::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 12 */
@@ -388,8 +416,8 @@ rt_void o_test12()
 
 rt_void o_test13()
 {
-    scene = new(&pfm) rt_Scene(&scn_test13::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test13::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 13 */
@@ -404,8 +432,8 @@ rt_void o_test13()
 
 rt_void o_test14()
 {
-    scene = new(&pfm) rt_Scene(&scn_test14::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test14::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 14 */
@@ -420,8 +448,8 @@ rt_void o_test14()
 
 rt_void o_test15()
 {
-    scene = new(&pfm) rt_Scene(&scn_test15::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test15::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 15 */
@@ -436,8 +464,8 @@ rt_void o_test15()
 
 rt_void o_test16()
 {
-    scene = new(&pfm) rt_Scene(&scn_test16::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test16::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 16 */
@@ -452,8 +480,8 @@ rt_void o_test16()
 
 rt_void o_test17()
 {
-    scene = new(&pfm) rt_Scene(&scn_test17::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test17::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 17 */
@@ -468,12 +496,28 @@ rt_void o_test17()
 
 rt_void o_test18()
 {
-    scene = new(&pfm) rt_Scene(&scn_test18::sc_root,
-                               x_res, y_res, x_row, RT_NULL, &pfm);
+    scene = new(pfm) rt_Scene(&scn_test18::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
 }
 
 #endif /* SUB_TEST 18 */
 
+/******************************************************************************/
+/*******************************   SUB TEST 19   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 19
+
+#include "scn_test19.h"
+
+rt_void o_test19()
+{
+    scene = new(pfm) rt_Scene(&scn_test19::sc_root,
+                               x_res, y_res, x_row, RT_NULL, pfm);
+}
+
+#endif /* SUB_TEST 19 */
+
 /******************************************************************************/
 /*********************************   TABLES   *********************************/
 /******************************************************************************/
@@ -553,6 +597,10 @@ testXX o_test[SUB_TEST] =
 #if SUB_TEST >= 18
     o_test18,
 #endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    o_test19,
+#endif /* SUB_TEST 19 */
 };
 
 /******************************************************************************/
@@ -587,6 +635,7 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -y n, override y-resolution, where new y-value <= 65535\n");
         RT_LOGI(" -d n, override diff-threshold for qualification, n >= 0\n");
         RT_LOGI(" -c n, override counter of redundant test cycles, n >= 1\n");
+        RT_LOGI(" -t n, override thread-pool size, where new size <= 1000\n");
         RT_LOGI(" -i n, append image-idx within imaging mode, 0 <= n <= 9\n");
         RT_LOGI(" -v, enable verbose mode, print all pixel spots (> diff)\n");
         RT_LOGI(" -p, enable pixhunt mode, print isolated pixels (> diff)\n");
@@ -595,34 +644,45 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -l, enable log-off mode, no printing to file and screen\n");
         RT_LOGI(" -o, enable optimal mode, omit unoptimized rendering run\n");
         RT_LOGI(" -q, enable quality mode, activate path-tracing lighting\n");
+        RT_LOGI(" -m, enable costmap mode, save per-tile/per-thread costs\n");
+        RT_LOGI(" -u, enable overlap mode, pipeline update with rendering\n");
+        RT_LOGI(" -j, enable reusing mode, reuse lists with moving camera\n");
         RT_LOGI(" -a, enable 4x antialiasing by default, 8x not supported\n");
         RT_LOGI(" -a n, enable antialiasing, 2 for 2x, 4 for 4x, 8 for 8x\n");
         RT_LOGI(" -t tex1 tex2 texn, convert images in data/textures/tex*\n");
+        RT_LOGI(" -r tex1 tex2 texn, compress images into 4x4-blocks tex*\n");
         RT_LOGI(" -z, plot Fresnel/Gamma functions & antialiasing samples\n");
-        RT_LOGI("options -b n ... -a n can be mixed, -t/-z are standalone\n");
+        RT_LOGI("options -b n ... -a n can be mixed, -t/-r/-z: standalone\n");
         RT_LOGI("--------------------------------------------------------\n");
     }
 
     if (argc >= 2 && strcmp(argv[1], "-z") == 0)
     {
         if (!l_mode) RT_LOGI("Plotting samples/functions: ");
+        pfm = new rt_Platform(sys_alloc, sys_free);
         o_test[0]();
         scene->plot_frags();
         scene->plot_funcs();
         scene->plot_trigs();
         delete scene;
         scene = RT_NULL;
+        delete pfm;
+        pfm = RT_NULL;
         if (!l_mode) RT_LOGI("Done!\n");
         return 0;
     }
 
-    if (argc >= 3 && strcmp(argv[1], "-t") == 0)
+    /* "-t" followed by a number is the thread-pool size */
+    if (argc >= 3 && ((strcmp(argv[1], "-t") == 0
+                  &&   (argv[2][0] < '0' || argv[2][0] > '9'))
+                  ||   strcmp(argv[1], "-r") == 0))
     {
         if (!l_mode) RT_LOGI("Converting textures:\n[");
         rt_Heap *hp = new rt_Heap(sys_alloc, sys_free);
         for (k = 2; k < argc; k++)
         {
-            r = convert_image(hp, argv[k]);
+            r = convert_image(hp, argv[k], argv[1][1] == 'r' ?
+                              RT_TEX_BCOLOR : RT_TEX_PCOLOR);
             if (r == 0)
             {
                 if (!l_mode) RT_LOGI("x");
@@ -838,6 +898,23 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
                 return 0;
             }
         }
+        if (k < argc && strcmp(argv[k], "-t") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= 1000)
+            {
+                if (!l_mode) RT_LOGI("Thread-pool size overridden: %d\n", t);
+                t_num = t;
+            }
+            else
+            {
+                if (!l_mode) RT_LOGI("Thread-pool size value out of range\n");
+                return 0;
+            }
+        }
         if (k < argc && strcmp(argv[k], "-v") == 0 && !v_mode)
         {
             v_mode = RT_TRUE;
@@ -881,6 +958,21 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
             q_mode = RT_TRUE;
             if (!l_mode) RT_LOGI("Quality mode enabled: %d\n", q_mode);
         }
+        if (k < argc && strcmp(argv[k], "-m") == 0 && !m_mode)
+        {
+            m_mode = RT_TRUE;
+            if (!l_mode) RT_LOGI("Costmap mode enabled: %d\n", m_mode);
+        }
+        if (k < argc && strcmp(argv[k], "-u") == 0 && !u_mode)
+        {
+            u_mode = RT_TRUE;
+            if (!l_mode) RT_LOGI("Overlap mode enabled: %d\n", u_mode);
+        }
+        if (k < argc && strcmp(argv[k], "-j") == 0 && !j_mode)
+        {
+            j_mode = RT_TRUE;
+            if (!l_mode) RT_LOGI("Reusing mode enabled: %d\n", j_mode);
+        }
         if (k < argc && strcmp(argv[k], "-a") == 0)
         {
             rt_si32 aa_map[10] =
@@ -928,14 +1020,19 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     rt_si32 tile_w = 0;
     rt_si32 size, type, simd = 0;
 
-    simd = (&pfm)->set_simd(simd_init(n_simd, s_type, k_size));
-    if (a_mode != (&pfm)->set_fsaa(a_mode))
+    /* system thread pool with exact number of threads (no feedback) */
+    pfm = new rt_Platform(sys_alloc, sys_free, -t_num);
+
+    simd = pfm->set_simd(simd_init(n_simd, s_type, k_size));
+    if (a_mode != pfm->set_fsaa(a_mode))
     {
         if (!l_mode)
         RT_LOGI("Requested antialiasing mode not supported, check options\n");
+        delete pfm;
         return 0;
     }
-    tile_w = (&pfm)->get_tile_w();
+    tile_w = pfm->get_tile_w();
+    pfm->set_timer(get_tick);
 
     size = (simd >> 16) & 0xFF;
     type = (simd >> 8) & 0xFF;
@@ -948,6 +1045,7 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     {
         if (!l_mode)
         RT_LOGI("Chosen SIMD target not supported, check -n/-k/-s options\n");
+        delete pfm;
         return 0;
     }
 
@@ -980,8 +1078,8 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
                     i+1, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
         try
         {
-            (&pfm)->set_simd(simd_init(n_simd, s_type, k_size));
-            a_mode = (&pfm)->get_fsaa();
+            pfm->set_simd(simd_init(n_simd, s_type, k_size));
+            a_mode = pfm->get_fsaa();
 
             if (!o_mode)
             { /* -->---->-- skip run0 -->---->-- */
@@ -997,6 +1095,7 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
             for (j = 0; j < r_test; j++)
             {
+                frame_cam(j);
                 scene->render(q_test ? 0 : j * f_time);
             }
 
@@ -1030,16 +1129,22 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
             o_test[i]();
 
-            scene->set_opts(RT_OPTS_FULL);
+            scene->set_opts(RT_OPTS_FULL | (j_mode ? RT_OPTS_REUSE : 0));
             q_test = scene->set_pton(q_mode);
+            scene->set_costs(m_mode);
+            scene->set_pipe(u_mode);
 
             time1 = get_time();
 
             for (j = 0; j < r_test; j++)
             {
+                frame_cam(j);
                 scene->render(q_test ? 0 : j * f_time);
             }
 
+            /* render the last frame pending in overlap mode */
+            scene->set_pipe(0);
+
             time2 = get_time();
             tF = time2 - time1;
             if (!l_mode) RT_LOGI("Time F = %d\n", (rt_si32)tF);
@@ -1059,6 +1164,11 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
                 scene->save_frame((i+1) * 10 + 1 + RT_MAX(0, -i_mode*1000));
             }
 
+            if (m_mode)
+            {
+                scene->save_costs((i+1) * 10 + 1 + RT_MAX(0, -i_mode*1000));
+            }
+
             if (!o_mode)
             { /* -->---->-- skip diff -->---->-- */
 
@@ -1095,6 +1205,16 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
     sys_free(frame, x_row * y_res * sizeof(rt_ui32));
 
+    delete pfm;
+    pfm = RT_NULL;
+
+#if (defined RT_LINUX)
+
+    if (!l_mode)
+    sys_stat();
+
+#endif /* RT_LINUX */
+
 #if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
 
     if (!l_mode)
@@ -1147,6 +1267,19 @@ rt_time get_time()
     return (rt_time)(tm.QuadPart * 1000 / fr.QuadPart);
 }
 
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick()
+{
+    LARGE_INTEGER fr;
+    QueryPerformanceFrequency(&fr);
+    LARGE_INTEGER tm;
+    QueryPerformanceCounter(&tm);
+    return (rt_time)(tm.QuadPart / fr.QuadPart * 1000000000 +
+                     tm.QuadPart % fr.QuadPart * 1000000000 / fr.QuadPart);
+}
+
 DWORD s_step = 0;
 
 SYSTEM_INFO s_sys = {0};
@@ -1244,6 +1377,18 @@ rt_time get_time()
     return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
 }
 
+#include <time.h>
+
+/*
+ * Get system time in nanoseconds (high-resolution).
+ */
+rt_time get_tick()
+{
+    timespec tm;
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+    return (rt_time)tm.tv_sec * 1000000000 + (rt_time)tm.tv_nsec;
+}
+
 #if (RT_POINTER - RT_ADDRESS) != 0
 
 #include <sys/mman.h>
@@ -1252,31 +1397,97 @@ rt_time get_time()
 #define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
 #endif /* macOS still cannot allocate with mmap within 32-bit range */
 
+#define RT_ALLOC_RANGE      0x00400000 /* per-thread address-range (4MB) */
+
+/* per-thread address-range reservation */
+static __thread
+rt_byte *t_ptr = RT_NULL;
+static __thread
+rt_byte *t_end = RT_NULL;
+
+/* sys_alloc's contention statistics */
+static
+rt_si32 s_cnt_alloc = 0; /* number of allocations */
+static
+rt_si32 s_cnt_range = 0; /* number of address-range reservations */
+static
+rt_si32 s_cnt_retry = 0; /* number of retries on shared s_ptr */
+static
+rt_si32 s_cnt_moved = 0; /* number of mmaps placed off the reservation */
+
+/*
+ * Reserve address-range of given "size" from shared s_ptr
+ * without locking, retry if other thread got there first.
+ */
+static
+rt_byte *sys_range(rt_size size)
+{
+    rt_byte *ptr, *old;
+
+    for (;;)
+    {
+        old = s_ptr;
+
+        /* loop around RT_ADDRESS_MAX boundary */
+        /* in 64/32-bit hybrid mode addresses can't have sign bit
+         * as MIPS64 sign-extends all 32-bit mem-loads by default */
+        ptr = old >= RT_ADDRESS_MAX - size ? RT_ADDRESS_MIN : old;
+
+        if (RT_ATOMIC_CAS(&s_ptr, old, ptr + size) == old)
+        {
+            break;
+        }
+
+        RT_ATOMIC_ADD(&s_cnt_retry, 1);
+    }
+
+    RT_ATOMIC_ADD(&s_cnt_range, 1);
+
+    return ptr;
+}
+
 #endif /* (RT_POINTER - RT_ADDRESS) */
 
 /*
  * Allocate memory from system heap.
- * Not thread-safe due to common static ptr.
  */
 rt_pntr sys_alloc(rt_size size)
 {
 #if (RT_POINTER - RT_ADDRESS) != 0
 
-    /* loop around RT_ADDRESS_MAX boundary */
-    /* in 64/32-bit hybrid mode addresses can't have sign bit
-     * as MIPS64 sign-extends all 32-bit mem-loads by default */
-    if (s_ptr >= RT_ADDRESS_MAX - size)
+    /* advance with allocation granularity */
+    /* in case when page-size differs from default 4096 bytes
+     * mmap should round toward closest correct page boundary */
+    rt_size step = ((size + 4095) / 4096) * 4096;
+    rt_byte *adr;
+
+    /* large allocations take their own address-range,
+     * smaller ones are placed within thread's reservation */
+    if (step > RT_ALLOC_RANGE / 4)
     {
-        s_ptr  = RT_ADDRESS_MIN;
+        adr = sys_range(step);
     }
+    else
+    {
+        if (t_ptr == RT_NULL || t_end - t_ptr < step)
+        {
+            t_ptr = sys_range(RT_ALLOC_RANGE);
+            t_end = t_ptr + RT_ALLOC_RANGE;
+        }
 
-    rt_pntr ptr = mmap(s_ptr, size, PROT_READ | PROT_WRITE,
+        adr = t_ptr;
+        t_ptr += step;
+    }
+
+    rt_pntr ptr = mmap(adr, size, PROT_READ | PROT_WRITE,
                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 
-    /* advance with allocation granularity */
-    /* in case when page-size differs from default 4096 bytes
-     * mmap should round toward closest correct page boundary */
-    s_ptr = (rt_byte *)ptr + ((size + 4095) / 4096) * 4096;
+    RT_ATOMIC_ADD(&s_cnt_alloc, 1);
+
+    if (ptr != adr)
+    {
+        RT_ATOMIC_ADD(&s_cnt_moved, 1);
+    }
 
 #else /* (RT_POINTER - RT_ADDRESS) */
 
@@ -1331,6 +1542,19 @@ rt_void sys_free(rt_pntr ptr, rt_size size)
 #endif /* RT_DEBUG */
 }
 
+/*
+ * Print sys_alloc's contention statistics.
+ */
+rt_void sys_stat()
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    RT_LOGI("sys_alloc: %d allocs, %d ranges, %d retries, %d moved\n",
+            s_cnt_alloc, s_cnt_range, s_cnt_retry, s_cnt_moved);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+}
+
 #endif /* ------------- OS specific ----------------------------------------- */
 
 /******************************************************************************/
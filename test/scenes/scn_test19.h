@@ -0,0 +1,208 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2025 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_SCN_TEST19_H
+#define RT_SCN_TEST19_H
+
+#include "format.h"
+
+#include "all_mat.h"
+#include "all_obj.h"
+
+namespace scn_test19
+{
+
+/******************************************************************************/
+/**********************************   BASE   **********************************/
+/******************************************************************************/
+
+rt_PLANE pl_floor01 =
+{
+    {      /*   RT_I,       RT_J,       RT_K    */
+/* min */   {  -10.0,      -10.0,      -RT_INF  },
+/* max */   {  +10.0,      +30.0,      +RT_INF  },
+        {
+/* OUTER        RT_U,       RT_V    */
+/* scl */   {    1.0,        1.0    },
+/* rot */              0.0           ,
+/* pos */   {    0.0,        0.0    },
+
+/* mat */   &mt_plain01_gray01,
+        },
+        {
+/* INNER        RT_U,       RT_V    */
+/* scl */   {    1.0,        1.0    },
+/* rot */              0.0           ,
+/* pos */   {    0.0,        0.0    },
+
+/* mat */   &mt_plain01_gray02,
+        },
+    },
+};
+
+/******************************************************************************/
+/*********************************   CRATES   *********************************/
+/******************************************************************************/
+
+/* crate with mip-mapped bilinear filtering,
+ * placed next to the nearest-filtered ob_cube01 */
+rt_OBJECT ob_cube02[] =
+{
+    OB_CUBE01_MAT(&mt_plain01_crate02)
+};
+
+/* crate with 4x4-block compressed texture,
+ * also mip-mapped and bilinear-filtered */
+rt_OBJECT ob_cube03[] =
+{
+    OB_CUBE01_MAT(&mt_plain01_crate03)
+};
+
+rt_OBJECT ob_crates01[] =
+{
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {   -3.0,        0.0,        1.0    },
+        },
+        RT_OBJ_ARRAY(&ob_cube01)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        0.0,        1.0    },
+        },
+        RT_OBJ_ARRAY(&ob_cube02)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {   +3.0,        0.0,        1.0    },
+        },
+        RT_OBJ_ARRAY(&ob_cube03)
+    },
+};
+
+/******************************************************************************/
+/*********************************   CAMERA   *********************************/
+/******************************************************************************/
+
+rt_OBJECT ob_camera01[] =
+{
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {  -95.0,        0.0,        0.0    },
+/* pos */   {    0.0,      -10.0,        0.0    },
+        },
+        RT_OBJ_CAMERA(&cm_camera01)
+    },
+};
+
+/******************************************************************************/
+/*********************************   LIGHTS   *********************************/
+/******************************************************************************/
+
+rt_OBJECT ob_light01[] =
+{
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        0.0,        0.0    },
+        },
+        RT_OBJ_LIGHT(&lt_light01)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        0.0,        0.0    },
+        },
+        RT_OBJ_SPHERE(&sp_bulb01)
+    },
+};
+
+/******************************************************************************/
+/**********************************   TREE   **********************************/
+/******************************************************************************/
+
+rt_OBJECT ob_tree[] =
+{
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        0.0,        0.0    },
+        },
+        RT_OBJ_PLANE(&pl_floor01)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        0.0,        0.0    },
+        },
+        RT_OBJ_ARRAY(&ob_crates01)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,       +8.0,        0.0    },
+        },
+        RT_OBJ_ARRAY(&ob_crates01)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,      +24.0,        0.0    },
+        },
+        RT_OBJ_ARRAY(&ob_crates01)
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        6.0,        8.0    },
+        },
+        RT_OBJ_ARRAY(&ob_light01),
+    },
+    {
+        {  /*   RT_X,       RT_Y,       RT_Z    */
+/* scl */   {    1.0,        1.0,        1.0    },
+/* rot */   {    0.0,        0.0,        0.0    },
+/* pos */   {    0.0,        0.0,        4.0    },
+        },
+        RT_OBJ_ARRAY(&ob_camera01)
+    },
+};
+
+/******************************************************************************/
+/**********************************   SCENE   *********************************/
+/******************************************************************************/
+
+rt_SCENE sc_root =
+{
+    RT_OBJ_ARRAY(&ob_tree),
+    /* list of optimizations to be turned off *
+     * refer to core/engine/format.h for defs */
+    RT_OPTS_PT
+    /* turning off GAMMA|FRESNEL opts in turn *
+     * enables respective GAMMA|FRESNEL props */
+};
+
+} /* namespace scn_test19 */
+
+#endif /* RT_SCN_TEST19_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/